@@ -12,6 +12,7 @@
 
 #define CNFGOGL
 #define CNFGOGL_NEED_EXTENSION
+#define CNFG_COMPACT_QUADS
 #define CNFG_IMPLEMENTATION
 #include "rawdraw_sf.h"
 
@@ -20,7 +21,6 @@
 
 #ifdef ANDROID
 	#define GLES_VER_TARG "100"
-	#define TARGET_OFFSCREEN
 #elif defined(USE_WINDOWS)
 	#define GLES_VER_TARG "150"
 #else
@@ -30,16 +30,26 @@
 
 GLuint * colorDepthPairs; // numColorDepthPairs * 2 
 int numColorDepthPairs;
-GLuint debugTexture;
 GLuint frameBuffer;
 
 GLint drawProgram;
 GLint drawProgramModelViewUniform;
-GLint textureProgram;
-GLint textureProgramModelViewUniform;
-GLint textureProgramTextureUniform;
+
+// Instanced stereo version of the above, if the GL supports it.
+tsoStereo stereo;
+int stereoOK;
+GLint stereoDrawProgram;
 short windowW, windowH;
 
+// World-space lines and labels, recorded once per frame and drawn for every view.
+tsoDebugDraw debugDraw;
+
+// The debug text, shown on the desktop and on a quad layer in the headset.
+tsoQuadLayer debugPanel;
+char debugBuffer[16384];
+CNFGTextBlock notReadyText;
+double debugPanelTime;
+
 XrCompositionLayerProjectionView saveLayerProjectionView;
 
 tsoContext TSO;
@@ -60,6 +70,10 @@ tsoContext TSO;
 #define GL_DEPTH_COMPONENT24 0x81A6
 #endif
 
+#ifndef GL_DEPTH_COMPONENT32F
+#define GL_DEPTH_COMPONENT32F 0x8CAC
+#endif
+
 #ifndef GL_MAJOR_VERSION
 #define GL_MAJOR_VERSION   0x821B
 #endif
@@ -71,10 +85,7 @@ tsoContext TSO;
 void (*minXRglGenFramebuffers)( GLsizei n, GLuint *ids );
 void (*minXRglBindFramebuffer)( GLenum target, GLuint framebuffer );
 void (*minXRglFramebufferTexture2D)( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level );
-void (*minXRglUniformMatrix4fv)( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
-void (*minXRglVertexAttribPointer)( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer);
 void (*minXRwglSwapIntervalEXT)(int interval);
-void (*minXRglBlitNamedFramebuffer)( GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
 void (*minXRglActiveTexture)( GLenum texture );
 void (*minXRglUniform1i)( GLint location, GLint v0 );
 
@@ -83,10 +94,7 @@ void EnumOpenGLExtensions()
 	minXRglGenFramebuffers = CNFGGetProcAddress( "glGenFramebuffers" );
 	minXRglBindFramebuffer = CNFGGetProcAddress( "glBindFramebuffer" );
 	minXRglFramebufferTexture2D = CNFGGetProcAddress( "glFramebufferTexture2D" );
-	minXRglUniformMatrix4fv = CNFGGetProcAddress( "glUniformMatrix4fv" );
-	minXRglVertexAttribPointer = CNFGGetProcAddress( "glVertexAttribPointer" );
 	minXRwglSwapIntervalEXT = CNFGGetProcAddress( "wglSwapIntervalEXT" );
-	minXRglBlitNamedFramebuffer = CNFGGetProcAddress( "glBlitNamedFramebuffer" );
 	minXRglActiveTexture = CNFGGetProcAddress( "glActiveTexture" );
 	minXRglUniform1i = CNFGGetProcAddress( "glUniform1i" );
 }
@@ -108,7 +116,7 @@ int SetupRendering()
 
 		"#version " GLES_VER_TARG "\n"
 		"varying "PRECISIONB" vec4 vc;"
-		"void main() { gl_FragColor = vec4(vc/255.0); }" 
+		"void main() { gl_FragColor = vc; }" 
 	);
 
 	if( drawProgram <= 0 )
@@ -119,48 +127,49 @@ int SetupRendering()
 
 	CNFGglUseProgram( drawProgram );
 	drawProgramModelViewUniform = CNFGglGetUniformLocation ( drawProgram , "modelViewProjMatrix" );
-	CNFGglBindAttribLocation( drawProgram, 0, "vPos" );
-	CNFGglBindAttribLocation( drawProgram, 1, "vColor" );
-
-	textureProgram = CNFGGLInternalLoadShader(
-		"#version " GLES_VER_TARG "\n"
-		"uniform mat4 modelViewProjMatrix;"
-		"attribute vec3 vPos;"
-		"attribute vec2 vUV;"
-		"varying "PRECISIONB" vec2 uv;"
-		"void main() { gl_Position = vec4( modelViewProjMatrix * vec4( vPos.xyz, 1.0 ) ); uv = vUV; }",
-
-		"#version " GLES_VER_TARG "\n"
-		"varying "PRECISIONB" vec2 uv;"
-		"uniform sampler2D texture;"
-		"void main() { gl_FragColor = vec4(texture2D(texture, uv).rgb, 1.0); }" 
-	);
 
-	if( textureProgram <= 0 )
+	if( tsoDebugDrawInit( &debugDraw ) )
 	{
-		TSOPENXR_ERROR( "Error: Cannot load shader\n" );
+		TSOPENXR_ERROR( "Error: No buffer objects for debug drawing\n" );
 		return -1;
 	}
+	CNFGglBindAttribLocation( drawProgram, 0, "vPos" );
+	CNFGglBindAttribLocation( drawProgram, 1, "vColor" );
 
-	CNFGglUseProgram( textureProgram );
-	textureProgramModelViewUniform = CNFGglGetUniformLocation ( textureProgram , "modelViewProjMatrix" );
-	textureProgramTextureUniform = CNFGglGetUniformLocation ( textureProgram , "texture" );
-	CNFGglBindAttribLocation( textureProgram, 0, "vPos" );
-	CNFGglBindAttribLocation( textureProgram, 1, "vUV" );
+#ifndef ANDROID
+	// Same shader, but drawing both eyes per draw call.
+	if( tsoStereoInit( &stereo ) == 0 )
+	{
+		// Let the stereo shaders read view matrices that are updated after the draws are issued.
+		const char * lateLatch = ( tsoEnableLateLatch( &TSO, 1 ) == 0 ) ? TSO_LATE_LATCH_GLSL : "";
+		char vs[4096];
+		snprintf( vs, sizeof( vs ), "#version " GLES_VER_TARG "\n%s%s%s"
+			"attribute vec3 vPos;"
+			"attribute vec4 vColor;"
+			"varying "PRECISIONB" vec4 vc;"
+			"void main() { gl_Position = tsoStereoPosition( vec4( vPos.xyz, 1.0 ) ); vc = vColor; }",
+			stereo.shaderHeader, lateLatch, TSO_STEREO_GLSL );
+		stereoDrawProgram = CNFGGLInternalLoadShader( vs,
+			"#version " GLES_VER_TARG "\n"
+			"varying "PRECISIONB" vec4 vc;"
+			"void main() { gl_FragColor = vc; }" 
+		);
 
-	glGenTextures(1, &debugTexture);
-	glBindTexture(GL_TEXTURE_2D, debugTexture);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-#ifdef TARGET_OFFSCREEN
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 256, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
-#else
-	uint32_t colordata[] = { 0xff000000, 0xff0000ff, 0xff00ff00, 0xffff0000 };
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, colordata );
+		stereoOK = stereoDrawProgram > 0;
+		if( stereoOK )
+		{
+			tsoStereoBindProgram( &stereo, stereoDrawProgram );
+			tsoLateLatchBindProgram( stereoDrawProgram );
+			CNFGglUseProgram( stereoDrawProgram );
+			CNFGglBindAttribLocation( stereoDrawProgram, 0, "vPos" );
+			CNFGglBindAttribLocation( stereoDrawProgram, 1, "vColor" );
+		}
+		else
+		{
+			TSOPENXR_INFO( "Instanced stereo shader did not compile, drawing each eye separately.\n" );
+		}
+	}
 #endif
-	glBindTexture(GL_TEXTURE_2D, 0);
 
 	int err = glGetError();
 	if( err )
@@ -180,7 +189,8 @@ uint32_t CreateDepthTexture(uint32_t colorTexture, int width, int height )
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, 0 );
+	// Reverse-Z spreads precision evenly over distance, but only with a floating point depth buffer.
+	glTexImage2D(GL_TEXTURE_2D, 0, TSO.tsoReverseZ ? GL_DEPTH_COMPONENT32F : GL_DEPTH_COMPONENT, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, 0 );
 	return depthTexture;
 }
 
@@ -201,8 +211,33 @@ uint32_t GetDepthTextureFromColorTexture( uint32_t colorTexture, int width, int
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Pass a matrix to draw one view, or NULL to draw both eyes at once with the stereo programs.
+void DrawScene( const float * modelViewProjMat )
+{
+	CNFGglUseProgram( modelViewProjMat ? drawProgram : stereoDrawProgram );
+	glLineWidth( 2.0 );
+	if( modelViewProjMat )
+		tsoDebugDrawView( &debugDraw, drawProgramModelViewUniform, modelViewProjMat );
+	else
+		tsoDebugDrawStereo( &debugDraw, &stereo );
+}
+
+// Only runs when the panel is marked dirty; the compositor shows the last image in between.
+int DrawDebugPanel( tsoContext * ctx, tsoQuadLayer * ql )
+{
+	glClearColor( 0.05f, 0.05f, 0.05f, 0.8f );
+	glClear( GL_COLOR_BUFFER_BIT );
+	CNFGInternalResize( ql->width, ql->height );
+	CNFGPenX = 1;
+	CNFGPenY = 1;
+	CNFGColor( 0xffffffff );
+	CNFGDrawText( debugBuffer, 2 );
+	CNFGFlushRender();
+	CNFGInternalResize( windowW, windowH );
+	return 0;
+}
 
-int RenderLayer(tsoContext * ctx, XrTime predictedDisplayTime, XrCompositionLayerProjectionView * projectionLayerViews, int viewCountOutput )
+int RenderLayer(tsoContext * ctx, XrTime predictedDisplayTime, XrCompositionLayerProjectionView * projectionLayerViews, const tsoViewMatrices * matrices, int viewCountOutput )
 {
 	
 	// If each view has a separate swapchain which is acquired, rendered to, and released.
@@ -220,90 +255,48 @@ int RenderLayer(tsoContext * ctx, XrTime predictedDisplayTime, XrCompositionLaye
 
 	glClearColor(0.05f, 0.05f, 0.15f, 1.0f);
 #ifndef ANDROID
-	glClearDepth(1.0f);
+	glClearDepth(TSO.tsoReverseZ ? 0.0f : 1.0f);
 #endif
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
 
-	// Render view to the appropriate part of the swapchain image.
-	for (uint32_t i = 0; i < viewCountOutput; i++)
-	{
-		XrCompositionLayerProjectionView * layerView = projectionLayerViews + i;
-		glViewport(layerView->subImage.imageRect.offset.x,
-				   layerView->subImage.imageRect.offset.y,
-				   layerView->subImage.imageRect.extent.width,
-				   layerView->subImage.imageRect.extent.height);
-
-		const float nearZ = 0.05f;
-		const float farZ = 100.0f;
-		float projMat[16];
-		float invViewMat[16];
-		float viewMat[16];
-		float modelViewProjMat[16];
-		tsoUtilInitProjectionMat( layerView, projMat, invViewMat, viewMat, modelViewProjMat, GRAPHICS_OPENGL, nearZ, farZ);
-
-		// Actually start rendering
-		glEnable( GL_BLEND );
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);  
-		
-		CNFGglUseProgram( drawProgram );
-		minXRglUniformMatrix4fv( drawProgramModelViewUniform, 1, GL_FALSE, modelViewProjMat );
+	glEnable( GL_BLEND );
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);  
 
-		{
-			static const float Vertices[] = { 
-				0, 0, 0, 1, 0, 0, 
-				0, 0, 0, 0, 1, 0, 
-				0, 0, 0, 0, 0, 1 };
-			static const uint32_t Colors[] = {
-				0xff0000ff, 0xff0000ff,
-				0xff00ff00, 0xff00ff00,
-				0xffff0000, 0xffff0000, 
-				};
-				
-			static const int GeometryIndices[] = {
-				0, 1, 2, 3, 4, 5,
-			};
-
-			CNFGglEnableVertexAttribArray(0);
-			CNFGglEnableVertexAttribArray(1);
-			minXRglVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, Vertices);
-			minXRglVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_FALSE, 0, Colors);
-
-			glLineWidth( 2.0 );
-
-			glDrawElements( GL_LINES, 6, GL_UNSIGNED_INT, GeometryIndices );
-		}
-		
-		
-		CNFGglUseProgram( textureProgram );
-		minXRglUniformMatrix4fv( textureProgramModelViewUniform, 1, GL_FALSE, modelViewProjMat );
-		{
-			minXRglUniform1i( textureProgramTextureUniform, 0 );
-			glBindTexture(GL_TEXTURE_2D, debugTexture);
-			static const float Vertices[] = { 
-				0, 0, 0,  0, 0, 1,  1, 0, 0,  1, 0, 1 };
-			static const float UVs[] = {
-				1, 0,  1, 1,  0, 0,  0, 1 };
-			static const int GeometryIndices[] = {
-				0, 1, 2, 2, 1, 3,
-			};
-
-			CNFGglEnableVertexAttribArray(0);
-			CNFGglEnableVertexAttribArray(1);
-			minXRglVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, Vertices);
-			minXRglVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 0, UVs);
-
-			glDrawElements( GL_TRIANGLES, 6, GL_UNSIGNED_INT, GeometryIndices );
-			glBindTexture(GL_TEXTURE_2D, 0);
-		}
+	// Stage axes, a label, and axes on each hand that is tracked.
+	const XrPosef identity = { { 0, 0, 0, 1 }, { 0, 0, 0 } };
+	const float labelPos[3] = { 0, 0.15f, 0 };
+	tsoDebugDrawReset( &debugDraw );
+	tsoDebugAxes( &debugDraw, &identity, 1.0f );
+	tsoDebugText( &debugDraw, &matrices[0], labelPos, 0.05f, 0xffffffff, "Stage origin" );
+	for( int h = 0; h < 2; h++ )
+	{
+		XrSpaceLocation handLocation = { XR_TYPE_SPACE_LOCATION };
+		if( xrLocateSpace( ctx->tsoHandSpace[h], ctx->tsoStageSpace, predictedDisplayTime, &handLocation ) == XR_SUCCESS &&
+			( handLocation.locationFlags & XR_SPACE_LOCATION_POSITION_VALID_BIT ) )
+			tsoDebugAxes( &debugDraw, &handLocation.pose, 0.1f );
+	}
 
-		// Show debug view.
-		if( i == 0 && minXRglBlitNamedFramebuffer )
+	if( stereoOK && tsoStereoBegin( &stereo, projectionLayerViews, matrices, viewCountOutput ) == 0 )
+	{
+		// Both eyes in one pass, each object drawn once.
+		DrawScene( 0 );
+		tsoStereoEnd( &stereo );
+	}
+	else
+	{
+		// Render view to the appropriate part of the swapchain image.
+		for (uint32_t i = 0; i < viewCountOutput; i++)
 		{
-			int targh = layerView->subImage.imageRect.extent.width*windowH/windowW;
-			int thofs = (layerView->subImage.imageRect.extent.height-targh)/2;
-			minXRglBlitNamedFramebuffer( frameBuffer, 0, 0, thofs, layerView->subImage.imageRect.extent.width, targh+thofs, 0, 0, windowW, windowH, GL_COLOR_BUFFER_BIT, GL_LINEAR );
+			XrCompositionLayerProjectionView * layerView = projectionLayerViews + i;
+			tsoGPUTimerView( ctx, i );
+			glViewport(layerView->subImage.imageRect.offset.x,
+					   layerView->subImage.imageRect.offset.y,
+					   layerView->subImage.imageRect.extent.width,
+					   layerView->subImage.imageRect.extent.height);
+
+			// Computed once per frame by tsoRenderFrame; the debug geometry is already in world space.
+			DrawScene( matrices[i].viewProj );
 		}
-
 	}
 	minXRglBindFramebuffer(GL_FRAMEBUFFER, 0);
 	tsoReleaseSwapchain( &TSO, 0 );
@@ -329,16 +322,28 @@ int main()
 	glGetIntegerv(GL_MAJOR_VERSION, &major);
 	glGetIntegerv(GL_MINOR_VERSION, &minor);
 	
-	if( ( r = tsoInitialize( &TSO, major, minor, TSO_DO_DEBUG | TSO_DOUBLEWIDE, "TSOpenXR Example", 0 ) ) ) return r;
+	if( ( r = tsoInitialize( &TSO, major, minor, TSO_DO_DEBUG | TSO_DOUBLEWIDE | TSO_GPU_TIMING, "TSOpenXR Example", 0 ) ) ) return r;
 	
 	// Assign a layer render function.
-	TSO.tsoRenderLayer = RenderLayer;
+	TSO.tsoRenderLayerEx = RenderLayer;
 
 	EnumOpenGLExtensions();
 
 	if( SetupRendering() ) return -1;
+
+	// Optional, falls back to regular depth if there is no glClipControl.
+	tsoEnableReverseZ( &TSO, 1 );
 	
 	if ( ( r = tsoDefaultCreateActions( &TSO ) ) ) return r;
+
+	// Debug text on a panel in front of the stage origin, at eye height.
+	tsoQuadLayerCreate( &TSO, &debugPanel, 1024, 512, 1.0f, 0.5f, DrawDebugPanel );
+	debugPanel.dynamic = 1; // Live stats; a static image would mean a new swapchain per redraw.
+	debugPanel.pose.position.y = 1.5f;
+	debugPanel.pose.position.z = -1.5f;
+
+	// Show the left eye on the desktop, but only 30 times a second.
+	tsoSetMirror( &TSO, 0, 30, 0, 0 );
 	
 	// Disable vsync, on appropriate system.
 	#ifdef USE_WINDOWS
@@ -366,7 +371,7 @@ int main()
 			CNFGPenX = 1;
 			CNFGPenY = 1;
 			CNFGColor( 0xffffffff );
-			CNFGDrawText( "Session Not Ready.", 2 );
+			CNFGDrawTextCached( &notReadyText, "Session Not Ready.", 2 );
 			CNFGSwapBuffers();
 			OGUSleep(100000);
 			continue;
@@ -377,8 +382,6 @@ int main()
 			return r;
 		}
 
-
-		CNFGClearFrame();
 		CNFGGetDimensions( &windowW, &windowH );
 
 		if ( ( r = tsoRenderFrame( &TSO ) ) )
@@ -386,18 +389,6 @@ int main()
 			return r;
 		}
 
-		#ifdef TARGET_OFFSCREEN
-		minXRglBindFramebuffer( GL_FRAMEBUFFER, frameBuffer );
-		minXRglFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, debugTexture, 0);
-		minXRglFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, GetDepthTextureFromColorTexture( debugTexture, windowW, windowH ), 0);
-
-		glClearColor(0.05f, 0.05f, 0.05f, 1.0f);
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
-		#endif
-
-		glViewport( 0, 0, windowW, windowH );
-
-		char debugBuffer[16384];
 		char * dbg = debugBuffer;
 		dbg += snprintf( dbg, sizeof(debugBuffer)-1-(dbg-debugBuffer), 
 			"Rect: %d,%d [%d,%d]\n"
@@ -463,23 +454,36 @@ int main()
 			handResults[1], floatState[1].isActive, floatState[1].currentState,
 			handResults[2], boolState[0].isActive, boolState[0].currentState,
 			handResults[3], boolState[1].isActive, boolState[1].currentState );
-			
-		CNFGPenX = 1;
-		CNFGPenY = 1;
-		CNFGColor( 0xffffffff );
-		CNFGDrawText( debugBuffer, 2 );
-
-		CNFGSwapBuffers();
-
-		// Tricky: If we are doing off-screen rendering, we have to copy-pasta our debug window into a texture.
-#ifndef TARGET_OFFSCREEN
-		glReadBuffer(GL_FRONT);
-		glBindTexture(GL_TEXTURE_2D, debugTexture);
-		glCopyTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, 0, 0, windowW, windowH, 0 );
-		glBindTexture(GL_TEXTURE_2D, 0);
-#else
-		minXRglBindFramebuffer( GL_FRAMEBUFFER, 0 );
-#endif
+
+		const tsoFrameStats * stats = &TSO.tsoStats;
+		dbg += snprintf( dbg, sizeof(debugBuffer)-1-(dbg-debugBuffer), 
+			"\nCPU ms Wait %6.3f Begin %6.3f Render %6.3f End %6.3f\n"
+			"GPU ms Render %6.3f Eye0 %6.3f Eye1 %6.3f (frame %d)\n"
+			"GPU done %6.3f ms after begin, %6.3f ms latency, %6.3f ms slack, queue %d\n",
+			stats->cpuWaitFrame * 1000.0, stats->cpuBeginFrame * 1000.0,
+			stats->cpuRender * 1000.0, stats->cpuEndFrame * 1000.0,
+			stats->gpuRender * 1000.0, stats->gpuView[0] * 1000.0, stats->gpuView[1] * 1000.0,
+			stats->gpuFrameNumber,
+			stats->gpuDoneAfterBegin * 1000.0, stats->gpuLatency * 1000.0,
+			stats->gpuDoneBeforeDisplay * 1000.0, stats->gpuQueueDepth );
+
+		// No one reads the stats faster than a few times a second.
+		if( OGGetAbsoluteTime() - debugPanelTime >= 0.25 )
+		{
+			debugPanelTime = OGGetAbsoluteTime();
+			debugPanel.dirty = 1;
+		}
+
+		// The window only updates at the mirror rate, so it never holds up the headset.
+		if( tsoMirrorToWindow( &TSO, windowW, windowH ) )
+		{
+			glViewport( 0, 0, windowW, windowH );
+			CNFGPenX = 1;
+			CNFGPenY = 1;
+			CNFGColor( 0xffffffff );
+			CNFGDrawTextAtlas( debugBuffer, 2 );
+			CNFGSwapBuffers();
+		}
 		if( OGGetAbsoluteTime() - dSecondTime >= 1 )
 		{
 			dSecondTime++;
@@ -489,6 +493,9 @@ int main()
 		iFPS++;
 	}
 
+	tsoStereoDestroy( &stereo );
+	tsoDebugDrawDestroy( &debugDraw );
+	CNFGFreeTextBlock( &notReadyText );
 	return tsoTeardown( &TSO );
 }
 
@@ -22,6 +22,9 @@ extern "C" {
 		->Caveat->If using CNFG_HAS_XSHAPE, then, we do something realy wacky.
 	CNFGRASTERIZER -> Software-rasterize the rawdraw calls, and, use
 		CNFGUpdateScreenWithBitmap to send video to webpage.
+		CNFG_HAS_XSHM -> On X11, render into MIT-SHM shared memory and present with
+			XShmPutImage instead of copying frames over the socket. Link with -lXext.
+			Falls back to XPutImage if the server can't do it (i.e. remote displays).
 	CNFGCONTEXTONLY -> Don't add any drawing functions, only opening a window to
 		get an OpenGL context.
 
@@ -68,6 +71,12 @@ Usually tested combinations:
 	#endif
 #endif
 
+//Define CNFG_COMPACT_QUADS to send rectangles, segments and pixels to the OpenGL
+//backend as 20-byte instanced quads instead of six full vertices.
+#if defined( CNFG_COMPACT_QUADS ) && ( !defined( CNFGOGL ) || defined( CNFGRASTERIZER ) || defined( CNFGHTTP ) )
+	#undef CNFG_COMPACT_QUADS
+#endif
+
 typedef struct {
     short x, y; 
 } RDPoint; 
@@ -83,6 +92,33 @@ void CNFGDrawText( const char * text, short scale );
 //Determine how large a given test would be to draw.
 void CNFGGetTextExtents( const char * text, int * w, int * h, int textsize  );
 
+//Retained text.  Draws like CNFGDrawText, but keeps the generated geometry in
+//`block` and re-emits it with a single copy as long as the text, scale, pen
+//position, color and line width are unchanged.  Zero the block before first
+//use.  Backends without batching just call CNFGDrawText.
+typedef struct
+{
+	char * text;
+	short scale;
+	int penx, peny;
+	uint32_t color;
+	float width;
+	int quadmode; //CNFGCompactQuads when it was recorded.
+	int compact; //Can be 0 even with quadmode, if something didn't fit in compact quads.
+	int count, capacity; //Vertices, or quads if compact.
+	float * verts;
+	int16_t * quads;
+	uint32_t * colors;
+} CNFGTextBlock;
+
+void CNFGDrawTextCached( CNFGTextBlock * block, const char * text, short scale );
+void CNFGFreeTextBlock( CNFGTextBlock * block );
+
+//Draws text as one textured quad per character from a glyph atlas that is
+//rendered on the CPU once per scale and line width.  Cheapest for text that
+//changes every frame.  Only with CNFGOGL, elsewhere it calls CNFGDrawText.
+void CNFGDrawTextAtlas( const char * text, short scale );
+
 //Draws a box, outline as whatever the last CNFGColor was set to but also draws
 //a rectangle as a background as whatever CNFGDialogColor is set to.
 void CNFGDrawBox( short x1, short y1, short x2, short y2 );
@@ -101,6 +137,11 @@ void CNFGUpdateScreenWithBitmap( uint32_t * data, int w, int h );
 //on different systems.
 void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h );
 
+//Like CNFGBlitImage, but only the rw x rh area at rx, ry in data has changed
+//since this same buffer was last blitted.  With CNFGOGL the rest is still in
+//a texture cached by size, elsewhere it just calls CNFGBlitImage.
+void CNFGBlitImageRect( uint32_t * data, int x, int y, int w, int h, int rx, int ry, int rw, int rh );
+
 // Only supported with CNFGOGL
 #ifdef CNFGOGL
 void CNFGDeleteTex( unsigned int tex );
@@ -206,6 +247,21 @@ void 	CNFGEmitQuad( float cx0, float cy0, float cx1, float cy1, float cx2, float
 extern int 	CNFGVertPlace;
 extern float CNFGVertDataV[CNFG_BATCH*3];
 extern uint32_t CNFGVertDataC[CNFG_BATCH];
+
+#ifdef CNFG_COMPACT_QUADS
+//Quads are four int16 corners in CNFG_QUAD_SUBPIXEL_BITS fixed point and one color.
+//That only reaches +/-CNFG_QUAD_MAXCOORD pixels; quads beyond it are sent as triangles.
+#ifndef CNFG_QUAD_SUBPIXEL_BITS
+#define CNFG_QUAD_SUBPIXEL_BITS 2
+#endif
+#define CNFG_QUAD_BATCH (CNFG_BATCH/2)
+#define CNFG_QUAD_MAXCOORD ( 32767.f / (1<<CNFG_QUAD_SUBPIXEL_BITS) )
+void	CNFGEmitBackendQuads( const int16_t * corners, const uint32_t * colors, int num_quads );
+extern int	CNFGCompactQuads; //Set by the backend if it can draw compact quads.
+extern int 	CNFGQuadPlace;
+extern int16_t CNFGQuadDataV[CNFG_QUAD_BATCH*8];
+extern uint32_t CNFGQuadDataC[CNFG_QUAD_BATCH];
+#endif
 #endif
 
 #define CNFG_KEY_FOCUS 0xf000
@@ -523,6 +579,18 @@ void tdMode( int mode );
 void tdSetViewport( float leftx, float topy, float rightx, float bottomy, float pixx, float pixy );
 void tdFinalPoint( float * pin, float * pout );
 
+//Batched versions. pin and pout are packed xyz triples, and may be the same buffer.
+//tdFinalPointArray folds the modelview and projection together once per call.
+void tdPTransformArray( const float * pin, float * f, float * pout, int count );
+void tdFinalPointArray( const float * pin, float * pout, int count );
+
+//Emit 3D lines and polys through tdFinalPointArray.  Anything with a vertex outside
+//the depth range, or that lands outside the range of a short on screen, is dropped,
+//not clipped.
+#define tdPOLYMAXVERTS 64
+void tdTackSegments( const float * pin, int segments ); //pin holds segments*2 points.
+void tdTackPoly( const float * pin, int verts );
+
 float tdNoiseAt( int x, int y );
 float tdFLerp( float a, float b, float t );
 float tdPerlin2D( float x, float y );
@@ -778,6 +846,13 @@ int CNFGLastScancode = 0;
 #define USE_RAM_MFS
 #endif
 
+//On Linux, sockets are non-blocking and driven by an edge-triggered epoll
+//set instead of being select()'d one at a time every tick.
+#if defined( __linux__ ) && !defined( CNFGHTTP_NO_EPOLL )
+#define CNFGHTTP_EPOLL
+#include <stdlib.h>
+#endif
+
 //single_file_http.c base from https://github.com/cntools/httptest.
 //scroll to bottom for implementation.
 
@@ -831,9 +906,8 @@ struct MFSFileEntry
 struct MFSFileInfo
 {
 	uint32_t filelen;
-#ifdef USE_RAM_MFS
 	uint32_t offset;
-#else
+#ifndef USE_RAM_MFS
 	FILE * file;
 #endif
 };
@@ -847,6 +921,11 @@ struct MFSFileInfo
 int8_t MFSOpenFile( const char * fname, struct MFSFileInfo * mfi );
 int32_t MFSReadSector( uint8_t* data, struct MFSFileInfo * mfi ); //returns # of bytes left in file.
 void MFSClose( struct MFSFileInfo * mfi );
+#ifdef CNFGHTTP_EPOLL
+//Sends the rest of the file straight to a non-blocking socket until it
+//would block.  Returns # of bytes left in file, or -1 on error.
+int32_t MFSSendFile( int socket, struct MFSFileInfo * mfi );
+#endif
 
 
 
@@ -902,12 +981,25 @@ int TCPCanSend( int socket, int size );
 int TCPDoneSend( int socket );
 int EndTCPWrite( int socket );
 
+#ifndef HTTP_CONNECTIONS
 #define HTTP_CONNECTIONS 50
+#endif
+#ifndef HTTP_LISTEN_BACKLOG
+#define HTTP_LISTEN_BACKLOG 64
+#endif
 #ifndef MAX_HTTP_PATHLEN
 #define MAX_HTTP_PATHLEN 80
 #endif
 #define HTTP_SERVER_TIMEOUT		500
 
+//Largest websocket payload we send at once.  Must fit a 16-bit length.
+#ifndef CNFGHTTP_WS_CHUNK
+#define CNFGHTTP_WS_CHUNK 16384
+#endif
+#if CNFGHTTP_WS_CHUNK > 65535
+#error CNFGHTTP_WS_CHUNK must fit in a 16-bit websocket length.
+#endif
+
 
 #define HTTP_STATE_NONE        0
 #define HTTP_STATE_WAIT_METHOD 1
@@ -957,6 +1049,15 @@ struct HTTPConnection
 	int socket;
 	uint8_t corked_data[4096];
 	int corked_data_place;
+
+#ifdef CNFGHTTP_EPOLL
+	//Set by EPOLLOUT, cleared when a send comes up short.  Whatever did
+	//not fit waits in outpending until the socket drains.
+	uint8_t  can_send:1;
+	uint8_t * outpending;
+	int outpendinglen;
+	int outpendingmax;
+#endif
 };
 
 extern struct HTTPConnection HTTPConnections[HTTP_CONNECTIONS];
@@ -1174,7 +1275,7 @@ static void DoHTTP( uint8_t timed )
 
 void  HTTPTick( uint8_t timed )
 {
-	uint8_t i;
+	int i;
 	for( i = 0; i < HTTP_CONNECTIONS; i++ )
 	{
 		if( curhttp ) { HTDEBUG( "HTTPRXQ\n" ); break; }
@@ -1251,6 +1352,23 @@ void  HTTPHandleInternalCallback( )
 		return;
 	}
 
+#ifdef CNFGHTTP_EPOLL
+	{
+		int32_t left = MFSSendFile( curhttp->socket, &curhttp->data.filedescriptor );
+		if( left < 0 )
+		{
+			HTTPClose( );
+			return;
+		}
+		//It only stops early if the socket is full.
+		if( left ) curhttp->can_send = 0;
+		curhttp->bytesleft = left;
+		if( !curhttp->bytesleft )
+			curhttp->isdone = 1;
+		return;
+	}
+#endif
+
 	DataStartPacket();
 
 	for( i = 0; i < 2 && curhttp->bytesleft; i++ )
@@ -1330,6 +1448,12 @@ void http_disconnetcb(int conn ) {
 	{
 		if( !HTTPConnections[r].is_dynamic ) MFSClose( &HTTPConnections[r].data.filedescriptor );
 		HTTPConnections[r].state = 0;
+#ifdef CNFGHTTP_EPOLL
+		free( HTTPConnections[r].outpending );
+		HTTPConnections[r].outpending = 0;
+		HTTPConnections[r].outpendinglen = 0;
+		HTTPConnections[r].outpendingmax = 0;
+#endif
 	}
 }
 
@@ -1360,6 +1484,9 @@ int httpserver_connectcb( int socket )
 		{
 			HTTPConnections[i].socket = socket;
 			HTTPConnections[i].state = HTTP_STATE_WAIT_METHOD;
+#ifdef CNFGHTTP_EPOLL
+			HTTPConnections[i].can_send = 1;
+#endif
 			break;
 		}
 	}
@@ -1657,15 +1784,27 @@ uint8_t WSPOPMASK()
 uint16_t htons(uint16_t hostshort);
 #endif
 
+#ifdef CNFGHTTP_EPOLL
+#include <sys/epoll.h>
+#include <sys/sendfile.h>
+#include <errno.h>
+#endif
+
 #include <fcntl.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
 
 static  int serverSocket;
+#ifdef CNFGHTTP_EPOLL
+static  int httpEpoll = -1;
+static  int httpSpareFd = -1;
+static  int httpAcceptRetry;
+#define HTTP_EPOLL_LISTENER (~(uint64_t)0)
+#endif
 
 uint8_t * databuff_ptr;
-uint8_t   databuff[1536];
+uint8_t   databuff[CNFGHTTP_WS_CHUNK+16];
 int cork_binary_rx;
 
 
@@ -1681,6 +1820,10 @@ int sockets[HTTP_CONNECTIONS];
 
 void et_espconn_disconnect( int socket )
 {
+#ifdef CNFGHTTP_EPOLL
+	//The close is deferred, so make sure no more events show up for it.
+	epoll_ctl( httpEpoll, EPOLL_CTL_DEL, socket, 0 );
+#endif
 	shutdown( socket, SHUT_RDWR );
 	int i;
 	//printf( "Shut: %d\n", socket );
@@ -1725,8 +1868,23 @@ void PushString( const char * data )
 	databuff_ptr += len;
 }
 
+#ifdef CNFGHTTP_EPOLL
+static struct HTTPConnection * HTTPConnectionFromSocket( int socket )
+{
+	int i;
+	if( curhttp && curhttp->socket == socket ) return curhttp;
+	for( i = 0; i < HTTP_CONNECTIONS; i++ )
+		if( sockets[i] == socket ) return &HTTPConnections[i];
+	return 0;
+}
+#endif
+
 int TCPCanSend( int socket, int size )
 {
+#ifdef CNFGHTTP_EPOLL
+	struct HTTPConnection * h = HTTPConnectionFromSocket( socket );
+	if( h ) return h->can_send;
+#endif
 	fd_set write_fd_set;
 	struct timeval tv;
 	tv.tv_sec = 0;
@@ -1779,11 +1937,69 @@ int TCPDoneSend( int socket )
 }
 
 
+#ifdef CNFGHTTP_EPOLL
+//Pushes out whatever a short send left behind.  Returns -1 on error.
+static int HTTPFlushPending( struct HTTPConnection * h )
+{
+	int sent = 0;
+	if( !h->outpendinglen )
+	{
+		h->can_send = 1;
+		return 0;
+	}
+	while( sent < h->outpendinglen )
+	{
+		int r = send( h->socket, h->outpending + sent, h->outpendinglen - sent, MSG_NOSIGNAL );
+		if( r < 0 )
+		{
+			if( errno != EAGAIN && errno != EWOULDBLOCK ) return -1;
+			break;
+		}
+		sent += r;
+	}
+	memmove( h->outpending, h->outpending + sent, h->outpendinglen - sent );
+	h->outpendinglen -= sent;
+	h->can_send = !h->outpendinglen;
+	return 0;
+}
+#endif
+
 int EndTCPWrite( int socket )
 {
+#ifdef CNFGHTTP_EPOLL
+	struct HTTPConnection * h = HTTPConnectionFromSocket( socket );
+	int len = databuff_ptr - databuff;
+	int r = 0;
+	databuff_ptr = databuff;
+
+	//Don't let new data jump ahead of what is still queued.
+	if( !h || !h->outpendinglen )
+	{
+		r = send( socket, databuff, len, MSG_NOSIGNAL );
+		if( r < 0 )
+		{
+			if( errno != EAGAIN && errno != EWOULDBLOCK ) return r;
+			r = 0;
+		}
+	}
+	if( r < len && h )
+	{
+		int need = h->outpendinglen + len - r;
+		if( need > h->outpendingmax )
+		{
+			h->outpendingmax = need * 2;
+			h->outpending = realloc( h->outpending, h->outpendingmax );
+		}
+		memcpy( h->outpending + h->outpendinglen, databuff + r, len - r );
+		h->outpendinglen = need;
+		h->can_send = 0;
+	}
+	return len;
+#else
 	int r = send( socket, databuff, databuff_ptr-databuff, MSG_NOSIGNAL );
 	databuff_ptr = databuff;
 	return r;
+#endif
 }
 
 void TermHTTPServer()
@@ -1791,11 +2007,158 @@ void TermHTTPServer()
 	shutdown( serverSocket, SHUT_RDWR );
 }
 
+//Reads whatever is waiting on connection i and feeds it to the parser.
+//Returns 1 if data was handled, 0 if there was none and -1 if the
+//connection is gone.
+static int HTTPReceive( int i )
+{
+	int dco = HTTPConnections[i].corked_data_place;
+	uint8_t data[8192];
+	memcpy( data, HTTPConnections[i].corked_data, dco );
+	int len = recv( sockets[i], data+dco, 8192-dco, 0 );
+#ifdef CNFGHTTP_EPOLL
+	if( len < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK ) ) return 0;
+#endif
+	if( len > 0 )
+	{
+		cork_binary_rx = 0;
+		http_recvcb( i, data, len+dco );
+		if( cork_binary_rx )
+		{
+			int to_cork = len;
+			if( to_cork > sizeof( HTTPConnections[i].corked_data ) + HTTPConnections[i].corked_data_place )
+			{
+				http_disconnetcb( i );
+				closesocket ( sockets[i] );
+				sockets[i] = 0;
+				fprintf( stderr, "Error: too much data to buffer on websocket\n" );
+				return -1;
+			}
+			else
+			{
+				memcpy( HTTPConnections[i].corked_data + dco, data + dco, to_cork );
+				HTTPConnections[i].corked_data_place += to_cork;
+			}
+		}
+		else
+		{
+			HTTPConnections[i].corked_data_place = 0;
+		}
+		return 1;
+	}
+	else
+	{
+		http_disconnetcb( i );
+		closesocket( sockets[i] );
+		sockets[i] = 0;
+		return -1;
+	}
+}
+
+#ifdef CNFGHTTP_EPOLL
+static void HTTPAcceptAll()
+{
+	struct linger lx;
+	lx.l_onoff = 1;
+	lx.l_linger = 0;
+
+	httpAcceptRetry = 0;
+	if( httpSpareFd < 0 )
+		httpSpareFd = open( "/dev/null", O_RDONLY | O_CLOEXEC );
+
+	//Edge triggered, so take everything that is waiting.  If we stop early
+	//we will not be told about the rest of the backlog again.
+	for( ;; )
+	{
+		int tsocket = accept( serverSocket, 0, 0 );
+		if( tsocket < 0 )
+		{
+			if( errno == EAGAIN || errno == EWOULDBLOCK ) break;
+			if( errno == EINTR || errno == ECONNABORTED ) continue;
+			if( ( errno == EMFILE || errno == ENFILE ) && httpSpareFd >= 0 )
+			{
+				//Out of descriptors.  Give up the spare one so we can take
+				//the connection off the backlog and drop it.
+				close( httpSpareFd );
+				tsocket = accept( serverSocket, 0, 0 );
+				if( tsocket >= 0 ) closesocket( tsocket );
+				httpSpareFd = open( "/dev/null", O_RDONLY | O_CLOEXEC );
+				if( tsocket >= 0 )
+				{
+					fprintf( stderr, "Warning: Out of file descriptors, dropped a connection.\n" );
+					continue;
+				}
+			}
+			//Could not drain it, try again next tick.
+			httpAcceptRetry = 1;
+			break;
+		}
+
+		//Disable the linger here, too.
+		setsockopt( tsocket, SOL_SOCKET, SO_LINGER, &lx, sizeof( lx ) );
+		fcntl( tsocket, F_SETFL, fcntl( tsocket, F_GETFL, 0 ) | O_NONBLOCK );
+
+		int r = httpserver_connectcb( tsocket );
+		if( r == -1 )
+		{
+			closesocket( tsocket );
+			continue;
+		}
+		sockets[r] = tsocket;
+
+		struct epoll_event ev;
+		ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		ev.data.u64 = ( (uint64_t)tsocket << 32 ) | r;
+		epoll_ctl( httpEpoll, EPOLL_CTL_ADD, tsocket, &ev );
+	}
+}
+
+static void HTTPPollEvents()
+{
+	struct epoll_event evs[64];
+	int n = epoll_wait( httpEpoll, evs, 64, HTTP_POLL_TIMEOUT );
+	int k;
+	if( httpAcceptRetry ) HTTPAcceptAll();
+	for( k = 0; k < n; k++ )
+	{
+		uint32_t e = evs[k].events;
+		if( evs[k].data.u64 == HTTP_EPOLL_LISTENER )
+		{
+			HTTPAcceptAll();
+			continue;
+		}
+
+		int i = (int)( evs[k].data.u64 & 0xffffffff );
+		int fd = (int)( evs[k].data.u64 >> 32 );
+
+		//Closed (and maybe reused) earlier in this batch.
+		if( i >= HTTP_CONNECTIONS || sockets[i] != fd ) continue;
+
+		if( e & EPOLLOUT )
+		{
+			if( HTTPFlushPending( &HTTPConnections[i] ) < 0 )
+			{
+				http_disconnetcb( i );
+				closesocket( sockets[i] );
+				sockets[i] = 0;
+				continue;
+			}
+		}
+		if( e & ( EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR ) )
+		{
+			while( sockets[i] == fd && HTTPReceive( i ) > 0 );
+		}
+	}
+}
+#endif
+
 int TickHTTP()
 {
+#ifndef CNFGHTTP_EPOLL
 	int i;
 	//struct pollfd allpolls[HTTP_CONNECTIONS+1];
 	short mappedhttp[HTTP_CONNECTIONS+1];
+#endif
 	if( serverSocket == 0 ) return -1;
 
 	do
@@ -1814,9 +2177,9 @@ int TickHTTP()
 		QueryPerformanceCounter( &li );
 		now = (double)li.QuadPart / (double)lpf.QuadPart;
 #else
-		struct timeval tv;
-		gettimeofday( &tv, 0 );
-		now = ((double)tv.tv_usec)/1000000. + (tv.tv_sec);
+		struct timespec ts;
+		clock_gettime( CLOCK_MONOTONIC, &ts );
+		now = ((double)ts.tv_nsec)/1000000000. + (ts.tv_sec);
 #endif
 		double dl = now - last;
 		if( dl > .1 )
@@ -1845,6 +2208,9 @@ int TickHTTP()
 		//Do something to watch all currently-waiting sockets.
 		poll( allpolls, pollct, HTTP_POLL_TIMEOUT ); 
 */
+#ifdef CNFGHTTP_EPOLL
+		HTTPPollEvents();
+#else
 		//If there's faults, bail.
 		if( TCPException( serverSocket ) )
 		{
@@ -1901,43 +2267,10 @@ int TickHTTP()
 			}
 			else if( TCPCanRead( sockets[i] ) )
 			{
-				int dco = HTTPConnections[i].corked_data_place;
-				uint8_t data[8192];
-				memcpy( data, HTTPConnections[i].corked_data, dco );
-				int len = recv( sockets[wc], data+dco, 8192-dco, 0 );
-				if( len )
-				{
-					cork_binary_rx = 0;
-					http_recvcb( wc, data, len+dco );
-					if( cork_binary_rx )
-					{
-						int to_cork = len;
-						if( to_cork > sizeof( HTTPConnections[i].corked_data ) + HTTPConnections[i].corked_data_place )
-						{
-							http_disconnetcb( wc );
-							closesocket ( sockets[wc] );
-							sockets[wc] = 0;
-							fprintf( stderr, "Error: too much data to buffer on websocket\n" );
-						}
-						else
-						{
-							memcpy( HTTPConnections[i].corked_data + dco, data + dco, to_cork );
-							HTTPConnections[i].corked_data_place += to_cork;
-						}
-					}
-					else
-					{
-						HTTPConnections[i].corked_data_place = 0;
-					}
-				}
-				else
-				{
-					http_disconnetcb( wc );
-					closesocket( sockets[wc] );
-					sockets[wc] = 0;
-				}
+				HTTPReceive( wc );
 			}
 		}
+#endif
 	}
 #if HTTP_POLL_TIMEOUT != 0
 	while(1);
@@ -2016,7 +2349,7 @@ int RunHTTP( int port )
 	}
 
 	//Finally listen.
-	if( listen( serverSocket, 5 ) == -1 )
+	if( listen( serverSocket, HTTP_LISTEN_BACKLOG ) == -1 )
 	{
 		fprintf(stderr, "Could not lieten to socket.");
 		closesocket( serverSocket );
@@ -2024,6 +2357,22 @@ int RunHTTP( int port )
 		return -1;
 	}
 
+#ifdef CNFGHTTP_EPOLL
+	struct epoll_event ev;
+	httpEpoll = epoll_create1( 0 );
+	if( httpEpoll < 0 )
+	{
+		fprintf( stderr, "Error: Cannot create epoll set.\n" );
+		closesocket( serverSocket );
+		serverSocket = 0;
+		return -1;
+	}
+	fcntl( serverSocket, F_SETFL, fcntl( serverSocket, F_GETFL, 0 ) | O_NONBLOCK );
+	ev.events = EPOLLIN | EPOLLET;
+	ev.data.u64 = HTTP_EPOLL_LISTENER;
+	epoll_ctl( httpEpoll, EPOLL_CTL_ADD, serverSocket, &ev );
+#endif
+
 	return 0;
 }
 
@@ -2113,168 +2462,195 @@ uint8_t hex2byte( const char * c )
 
 #ifdef USE_RAM_MFS
 
+//gzip -9 of tools/rawdraw_http_files/index.html
 unsigned char webpage_buffer[] = {
-	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3b, 0x6b, 0x73, 0xda, 0xc8, 0xb2, 0x9f, 0xe1, 0x57, 0x4c, 0xb8, 0x75, 0x37, 0x60, 0x83, 0xc4, 0xc3, 0x76, 0xbc, 0xc6, 0x76, 
-	0x15, 0xb6, 0x71, 0xe2, 0x73, 0x6c, 0xc7, 0xd7, 0xe0, 0x4d, 0x52, 0xa9, 0x14, 0x25, 0xa4, 0x01, 0x69, 0x2d, 0x24, 0x56, 0x0f, 0x03, 0xd9, 0xf8, 0xbf, 0x9f, 0xee, 0x9e, 0xd1, 0x13, 0x61, 0x9c, 
-	0x3d, 0xbb, 0x97, 0xc4, 0x20, 0xcd, 0xf4, 0xf4, 0xf4, 0x6b, 0xfa, 0x31, 0x1a, 0xb1, 0xe3, 0x37, 0x17, 0x1f, 0xcf, 0x87, 0x5f, 0xee, 0xfa, 0xcc, 0x0c, 0x66, 0xf6, 0x69, 0xf9, 0x58, 0xfc, 0x94, 
-	0x8e, 0x4d, 0xae, 0x19, 0xf0, 0x5b, 0x3a, 0x9e, 0xf1, 0x40, 0x63, 0xba, 0xa9, 0x79, 0x3e, 0x0f, 0x4e, 0x2a, 0x0f, 0xc3, 0xcb, 0xc6, 0x61, 0x85, 0x3a, 0x02, 0x2b, 0xb0, 0xf9, 0xa9, 0xee, 0x98, 
-	0x41, 0x30, 0x3f, 0x56, 0xc5, 0x1d, 0xb6, 0xfb, 0xc1, 0x4a, 0x5c, 0x95, 0xc6, 0xae, 0xb1, 0x62, 0x7f, 0xb2, 0xb1, 0xa6, 0x3f, 0x4e, 0x3d, 0x37, 0x74, 0x8c, 0x86, 0xee, 0xda, 0xae, 0x77, 0xc4, 
-	0xfe, 0xa7, 0x09, 0x9f, 0xc3, 0x66, 0x97, 0x3d, 0x23, 0x98, 0xe1, 0xea, 0xe1, 0x8c, 0x3b, 0x01, 0x3b, 0x62, 0x7f, 0xba, 0x4f, 0xdc, 0x9b, 0xd8, 0xee, 0xe2, 0x88, 0x99, 0x96, 0x61, 0x70, 0xa7, 
-	0xcb, 0x16, 0x96, 0x11, 0x98, 0x27, 0xad, 0x66, 0xf3, 0x7f, 0xbb, 0xcc, 0xe4, 0xd6, 0xd4, 0x0c, 0xc4, 0x0d, 0x0e, 0x3d, 0x56, 0xa3, 0xc9, 0x8e, 0x55, 0x49, 0xf0, 0x31, 0x4d, 0x4a, 0xcd, 0x27, 
-	0x15, 0x01, 0x7f, 0x44, 0xf0, 0x33, 0xcd, 0x9b, 0x5a, 0xce, 0x11, 0x4c, 0x3a, 0xd7, 0x0c, 0xc3, 0x72, 0xa6, 0x47, 0x4d, 0xc1, 0x87, 0x61, 0x3d, 0xb1, 0xc1, 0xf0, 0xcb, 0x75, 0xff, 0xa4, 0x32, 
-	0x77, 0x7d, 0x2b, 0x70, 0x9d, 0x23, 0x6d, 0xec, 0xbb, 0x76, 0x18, 0xf0, 0xee, 0xf7, 0x86, 0xe5, 0x18, 0x7c, 0x79, 0xd4, 0x21, 0xd0, 0xd2, 0xb1, 0xae, 0x39, 0x4f, 0x9a, 0x2f, 0x69, 0xda, 0x6f, 
-	0x36, 0x23, 0x8a, 0xf0, 0xd2, 0x32, 0x4e, 0x44, 0xf7, 0xe9, 0xb1, 0x2a, 0x2f, 0x88, 0x44, 0xc0, 0x5f, 0x38, 0x8f, 0x95, 0x9e, 0x68, 0xec, 0x06, 0x81, 0x3b, 0x03, 0xea, 0x08, 0xf5, 0xd1, 0xc1, 
-	0x5e, 0x33, 0x9e, 0xbb, 0xd5, 0xec, 0x0a, 0xb1, 0x2d, 0x4c, 0x0b, 0x20, 0xb5, 0x23, 0x8f, 0x1b, 0x5d, 0xc9, 0xd9, 0x7e, 0x73, 0xbe, 0xac, 0x9c, 0x1e, 0x5b, 0xce, 0x3c, 0x0c, 0x58, 0xb0, 0x9a, 
-	0xf3, 0x13, 0x3f, 0x1c, 0xcf, 0xac, 0x80, 0x3d, 0x69, 0x76, 0x08, 0x02, 0x98, 0xf8, 0x15, 0xe6, 0x3a, 0xba, 0x6d, 0xe9, 0x8f, 0x27, 0x95, 0xa1, 0x3b, 0x9d, 0xda, 0xfc, 0x72, 0x50, 0xad, 0x75, 
-	0x61, 0x0c, 0x92, 0x03, 0x24, 0xfb, 0x81, 0x16, 0x84, 0x48, 0x32, 0x92, 0x99, 0x10, 0xeb, 0xeb, 0x9e, 0x35, 0x0f, 0x4e, 0xcb, 0x36, 0x0f, 0x98, 0xc7, 0x81, 0x0e, 0x0f, 0x24, 0xc6, 0x4e, 0xd8, 
-	0x44, 0xb3, 0x7d, 0xde, 0xa5, 0xe6, 0x49, 0x68, 0xdb, 0x00, 0xc6, 0xb9, 0xb3, 0xa9, 0x1d, 0x95, 0xe9, 0x59, 0x06, 0x87, 0x7e, 0x07, 0x1a, 0xbb, 0xe5, 0x49, 0xe8, 0xe8, 0xc8, 0x37, 0x4b, 0x48, 
-	0x01, 0xfb, 0x28, 0x1c, 0xf0, 0x66, 0xbd, 0x15, 0xcd, 0xa5, 0xac, 0xaa, 0xe7, 0xae, 0x33, 0xb1, 0xa6, 0xa1, 0xc7, 0xd9, 0x27, 0x3e, 0x7e, 0x7f, 0xcd, 0x06, 0x41, 0x38, 0x99, 0xb0, 0xaa, 0x66, 
-	0x83, 0xd9, 0xb0, 0xc0, 0x65, 0x63, 0x0e, 0x1a, 0xf6, 0x02, 0xe6, 0x4e, 0xd8, 0xd4, 0x76, 0xc7, 0x9a, 0xcd, 0x74, 0xd7, 0x09, 0xf8, 0x32, 0xa8, 0x11, 0x79, 0x52, 0x85, 0x27, 0x2c, 0x32, 0x3b, 
-	0x65, 0xca, 0x83, 0xbe, 0xcd, 0xf1, 0xf2, 0x6c, 0x75, 0x65, 0x54, 0xdf, 0x0a, 0x88, 0xb7, 0x35, 0xc1, 0xce, 0x62, 0x6a, 0x03, 0xb0, 0x68, 0x43, 0xd0, 0x73, 0x81, 0xac, 0xfa, 0x76, 0xc1, 0xc7, 
-	0x53, 0x1b, 0xa1, 0xac, 0x49, 0x95, 0xbd, 0x41, 0xb0, 0x5a, 0xf9, 0xcf, 0x72, 0x49, 0x55, 0xff, 0xa5, 0x39, 0x8f, 0x2b, 0xd6, 0x00, 0xc1, 0xb3, 0x4b, 0xcb, 0xe3, 0x13, 0x77, 0xc9, 0x0e, 0x3b, 
-	0x75, 0x30, 0x9a, 0xc0, 0x64, 0xb7, 0xbf, 0x5d, 0x5d, 0x5c, 0xf5, 0xd8, 0xfb, 0xbb, 0x87, 0x3a, 0x5b, 0xb9, 0x21, 0x73, 0x38, 0x37, 0x90, 0x68, 0xcd, 0x7f, 0x64, 0xc1, 0xc2, 0xd2, 0xb9, 0x52, 
-	0x2e, 0x6d, 0x9f, 0xf1, 0x39, 0xa2, 0x6c, 0x60, 0x6a, 0xa0, 0x9a, 0x48, 0xbe, 0x4c, 0x55, 0x07, 0x81, 0xe6, 0x18, 0x9a, 0x67, 0xb0, 0x89, 0xad, 0x01, 0xaf, 0x68, 0x37, 0xcc, 0x27, 0xa0, 0x68, 
-	0x48, 0xef, 0xec, 0xb7, 0x18, 0x1e, 0x3e, 0xaa, 0xda, 0xf3, 0x3c, 0x6d, 0xc5, 0xc6, 0x20, 0x44, 0xc0, 0x34, 0x01, 0x78, 0x10, 0x77, 0x00, 0x94, 0xf8, 0xc9, 0x88, 0xf3, 0x2d, 0x23, 0x68, 0x1e, 
-	0x5f, 0x89, 0x06, 0x3c, 0x7c, 0xbe, 0xbc, 0xbf, 0x49, 0x86, 0xa8, 0xea, 0x83, 0x63, 0x01, 0xd8, 0x8c, 0xd9, 0xae, 0xae, 0x91, 0xfe, 0x71, 0x50, 0xe0, 0x69, 0x8e, 0x4f, 0xcd, 0xd0, 0x00, 0xcb, 
-	0xc0, 0x32, 0x24, 0x1e, 0x54, 0xf2, 0x43, 0x60, 0xd9, 0x56, 0x80, 0x0b, 0x19, 0x95, 0x8b, 0xe0, 0x42, 0xd9, 0xbe, 0x66, 0x22, 0xc3, 0x60, 0x17, 0x84, 0x48, 0x49, 0x4c, 0x0a, 0xe6, 0x1d, 0xcd, 
-	0xb4, 0x47, 0x2e, 0x44, 0x52, 0x25, 0x2e, 0x86, 0x20, 0xb6, 0x3a, 0x9b, 0x78, 0xda, 0x14, 0xaf, 0x84, 0x7e, 0x90, 0x46, 0xec, 0x03, 0xfa, 0x60, 0x88, 0x42, 0x98, 0xa2, 0x41, 0xd8, 0xf0, 0x5b, 
-	0xff, 0x7e, 0xd8, 0xff, 0x3c, 0x1a, 0x7c, 0xe8, 0x5d, 0xf4, 0xef, 0x41, 0xd6, 0xa8, 0x0e, 0x45, 0x88, 0x70, 0xe0, 0x86, 0x9e, 0xce, 0xab, 0x38, 0xba, 0x1e, 0xe3, 0x67, 0x11, 0x8c, 0xee, 0xce, 
-	0xe6, 0x96, 0x1d, 0xa1, 0xc2, 0x6e, 0xec, 0xb1, 0xc0, 0x34, 0xd1, 0x38, 0x50, 0x91, 0xa2, 0xeb, 0x4e, 0xf3, 0x34, 0x70, 0xaa, 0x12, 0xa6, 0x4e, 0x54, 0x9c, 0x7f, 0xbc, 0xb9, 0xbb, 0xba, 0xee, 
-	0x8f, 0x06, 0xc3, 0xde, 0xf0, 0x61, 0x50, 0x83, 0x55, 0x81, 0xee, 0x46, 0xb3, 0x01, 0xa0, 0x9a, 0x19, 0x7c, 0xe5, 0x4c, 0xdc, 0x6b, 0x77, 0x2a, 0xd0, 0x23, 0x7e, 0x58, 0x12, 0xc4, 0x12, 0x32, 
-	0xb9, 0x89, 0xa5, 0xcb, 0xfb, 0xde, 0xfb, 0x9b, 0xfe, 0xed, 0xf0, 0x25, 0xa6, 0x70, 0x7c, 0x5a, 0x54, 0x85, 0x4c, 0x61, 0xf7, 0x36, 0xa6, 0x04, 0xa2, 0xbf, 0xc4, 0x14, 0xa1, 0x17, 0x4c, 0x95, 
-	0x84, 0xe3, 0xc9, 0x6a, 0xe9, 0xce, 0x73, 0xa7, 0x30, 0x4d, 0x35, 0x22, 0x4e, 0x0b, 0x02, 0x4d, 0x37, 0x25, 0x6d, 0x00, 0x2c, 0xe8, 0xdf, 0xdc, 0x1b, 0xe9, 0x04, 0x7b, 0x6d, 0xcb, 0x79, 0x8c, 
-	0xf0, 0x41, 0x67, 0xd4, 0x3c, 0x06, 0x9f, 0xdb, 0x0b, 0x02, 0xcf, 0x1a, 0x5f, 0x4b, 0x5b, 0xad, 0x32, 0x1a, 0xdb, 0xac, 0xb3, 0x8a, 0xd6, 0xac, 0xb0, 0xad, 0x80, 0x2d, 0x04, 0x6c, 0x09, 0x40, 
-	0x68, 0x08, 0x3d, 0x07, 0xdb, 0x71, 0xcd, 0x96, 0x85, 0x7b, 0xf8, 0xc4, 0x61, 0x1d, 0x68, 0xb0, 0xea, 0x17, 0xae, 0x5c, 0x9a, 0x7e, 0x1d, 0x96, 0x00, 0x67, 0x96, 0xcf, 0x34, 0xb1, 0x10, 0x1a, 
-	0xe9, 0x85, 0x5b, 0x27, 0xf3, 0x9f, 0xb9, 0x3e, 0x08, 0x44, 0x5b, 0x18, 0xf0, 0xc7, 0xdc, 0xf1, 0xef, 0x5c, 0x0f, 0x7c, 0xe1, 0x2b, 0x62, 0x1f, 0x90, 0x5f, 0x01, 0x20, 0xed, 0x4a, 0x28, 0x57, 
-	0xde, 0x13, 0xd7, 0xf7, 0xd8, 0x72, 0xe2, 0xcd, 0xba, 0x4c, 0x23, 0xaa, 0x21, 0xe8, 0x60, 0x63, 0x87, 0x69, 0xcd, 0x5c, 0xd3, 0x1e, 0xd3, 0x5a, 0x5d, 0x08, 0x20, 0xde, 0x0a, 0x5d, 0x3e, 0x35, 
-	0x3c, 0xe9, 0xd0, 0xe0, 0xc2, 0x02, 0x9d, 0x69, 0x96, 0x43, 0x3e, 0x1b, 0xa6, 0xba, 0x93, 0x41, 0x0c, 0x66, 0x46, 0xa0, 0x2a, 0x60, 0x52, 0x96, 0xab, 0x1d, 0x9c, 0x04, 0x7e, 0x77, 0xe9, 0xf7, 
-	0xfb, 0xa2, 0x8e, 0xcd, 0xdf, 0x41, 0x7e, 0xca, 0x3e, 0x88, 0x04, 0x30, 0x01, 0x38, 0xe2, 0x7f, 0xae, 0xd4, 0x91, 0xbe, 0xb9, 0xc7, 0x75, 0xcb, 0x47, 0x2c, 0x33, 0x6e, 0x58, 0xe1, 0x6c, 0x0e, 
-	0x8e, 0xcb, 0xd5, 0x82, 0xd7, 0xcc, 0x7f, 0x09, 0xba, 0x3e, 0x27, 0x39, 0x49, 0x02, 0x9e, 0x74, 0x98, 0xf7, 0xfb, 0xa2, 0x86, 0xc8, 0x51, 0xfc, 0x24, 0x9d, 0xc8, 0x17, 0x49, 0x83, 0x93, 0x9e, 
-	0x28, 0xd6, 0x59, 0x2c, 0x3f, 0xd0, 0x1a, 0x52, 0x2c, 0x07, 0x62, 0x94, 0x21, 0xc3, 0x67, 0x81, 0xc9, 0x23, 0x2d, 0x09, 0x71, 0x2b, 0xa1, 0x1f, 0x1b, 0x62, 0x3c, 0x5a, 0x0e, 0x7a, 0x0f, 0x06, 
-	0xeb, 0xbb, 0x33, 0x4e, 0x96, 0xc6, 0x97, 0xaa, 0x50, 0xa3, 0x70, 0x94, 0xa0, 0x64, 0xf0, 0xf3, 0x18, 0xa7, 0xa7, 0x1c, 0x40, 0x02, 0x6f, 0xc5, 0x2c, 0x47, 0xa0, 0x14, 0x2e, 0x39, 0xb1, 0xf3, 
-	0x33, 0x1a, 0x10, 0x99, 0xb9, 0x70, 0xbf, 0x45, 0xbd, 0xc2, 0x9a, 0xde, 0x42, 0x24, 0x0c, 0x7d, 0x94, 0x15, 0x5a, 0x54, 0x3c, 0x99, 0xef, 0xb2, 0xdf, 0x43, 0xb0, 0x19, 0xee, 0x68, 0x63, 0xc1, 
-	0xc7, 0xac, 0xce, 0x1c, 0x77, 0x21, 0xb9, 0x10, 0xcd, 0xbf, 0x11, 0x9d, 0xc2, 0x8e, 0xc9, 0xab, 0x57, 0x9b, 0x91, 0x81, 0x6f, 0x02, 0x68, 0xc9, 0x89, 0xfb, 0x02, 0xaf, 0x66, 0xcf, 0x4d, 0x8d, 
-	0xc1, 0x95, 0x83, 0x39, 0x55, 0x7a, 0x28, 0xad, 0xf1, 0xb3, 0xeb, 0xfe, 0xed, 0x45, 0xbc, 0x66, 0x10, 0xea, 0x12, 0x1c, 0x36, 0x75, 0x0d, 0xee, 0xcf, 0x47, 0xbd, 0xeb, 0xbb, 0x0f, 0x3d, 0xe1, 
-	0x2d, 0x3e, 0xde, 0xf6, 0x47, 0x37, 0x57, 0xb7, 0x0f, 0x83, 0x51, 0xdc, 0x81, 0xe3, 0x20, 0x76, 0xc3, 0x92, 0xe0, 0x8a, 0x0d, 0xfe, 0x81, 0x62, 0x31, 0x86, 0x3f, 0x55, 0xbd, 0x70, 0x19, 0x45, 
-	0x43, 0xb6, 0x70, 0x3d, 0x88, 0x9c, 0x26, 0x04, 0xbb, 0x19, 0x72, 0x6b, 0x6a, 0xf3, 0x39, 0x24, 0x24, 0x1c, 0x14, 0xb0, 0x42, 0x6f, 0x30, 0x83, 0x80, 0x8a, 0xf1, 0x44, 0x08, 0x0d, 0x62, 0x6d, 
-	0x2c, 0x7c, 0x7f, 0xe5, 0x07, 0x7c, 0xa6, 0x40, 0xdf, 0xd0, 0x84, 0x95, 0x67, 0x42, 0xdc, 0xb4, 0xb9, 0x2f, 0xe5, 0x87, 0xd2, 0x04, 0xae, 0x80, 0x54, 0x13, 0xf3, 0x08, 0x70, 0x16, 0xdc, 0x57, 
-	0x7d, 0x3e, 0xc5, 0x24, 0x01, 0x64, 0x0b, 0xb0, 0x91, 0xc8, 0x41, 0xac, 0x20, 0x03, 0x1b, 0x96, 0x10, 0x26, 0x5a, 0x30, 0x9b, 0xc8, 0x39, 0x9e, 0xe2, 0x9c, 0x27, 0x89, 0x50, 0xe7, 0xb7, 0x97, 
-	0xef, 0xfb, 0x90, 0x9c, 0x9d, 0x41, 0x3e, 0x0c, 0x82, 0x18, 0x7a, 0x96, 0xe6, 0x40, 0x16, 0xe4, 0xff, 0x6b, 0x20, 0xa2, 0x95, 0x7f, 0x59, 0x97, 0x11, 0xf0, 0x4a, 0xf8, 0x2a, 0x1d, 0x72, 0x66, 
-	0x19, 0xb5, 0x30, 0xc7, 0x48, 0x9a, 0x8e, 0x4f, 0x58, 0x93, 0xd5, 0x98, 0x70, 0x2f, 0x5d, 0x26, 0xa4, 0x14, 0x30, 0x6d, 0x2c, 0x0d, 0xa5, 0x77, 0x7f, 0xdf, 0xfb, 0x32, 0x3a, 0x7b, 0xb8, 0xbc, 
-	0xec, 0xdf, 0xa7, 0xfc, 0x95, 0xb4, 0x1c, 0x6d, 0x5c, 0x97, 0x89, 0x40, 0xac, 0x18, 0xea, 0xb8, 0xd0, 0x02, 0x8d, 0x3a, 0x23, 0x62, 0xb0, 0xeb, 0xe2, 0xcb, 0x6d, 0xef, 0xe6, 0xea, 0x7c, 0x74, 
-	0x71, 0xdf, 0xfb, 0x14, 0x81, 0x3f, 0xa5, 0x8c, 0xe2, 0xce, 0xb5, 0x1c, 0x74, 0xfb, 0xe0, 0x1f, 0x3b, 0x62, 0xc4, 0xe5, 0xf5, 0xc7, 0xde, 0xb0, 0x2e, 0x32, 0x42, 0xf2, 0x9b, 0xcd, 0xda, 0x0b, 
-	0x34, 0x9c, 0x6f, 0xa0, 0xc1, 0xe1, 0x0b, 0xf6, 0x00, 0xa8, 0x0f, 0x85, 0xd5, 0x45, 0x82, 0x91, 0x60, 0xac, 0xf6, 0x73, 0xd4, 0x81, 0x53, 0xde, 0x13, 0x23, 0x1e, 0x6e, 0x07, 0x57, 0xef, 0x6f, 
-	0xfb, 0x17, 0xa3, 0xb3, 0x2f, 0xc3, 0x3e, 0x2c, 0x49, 0x2f, 0xcc, 0x11, 0x89, 0x0e, 0x96, 0xe6, 0xf4, 0xc9, 0x4a, 0x87, 0xf7, 0x57, 0xbd, 0xdb, 0xf7, 0xd7, 0xfd, 0x01, 0x41, 0xa5, 0xb4, 0x02, 
-	0xe0, 0x89, 0xaa, 0x85, 0xc4, 0xc8, 0xc9, 0x83, 0xad, 0x41, 0xe6, 0x12, 0xa0, 0x71, 0x44, 0x9a, 0xd7, 0x30, 0x95, 0x01, 0x3b, 0x94, 0xe9, 0x11, 0xf6, 0xa7, 0x12, 0xaa, 0xd4, 0x00, 0xe1, 0x68, 
-	0x44, 0x76, 0x04, 0x51, 0x18, 0x72, 0xdc, 0x68, 0x0c, 0x04, 0xe5, 0x6c, 0x0e, 0x36, 0x14, 0xfd, 0xd2, 0x6e, 0x69, 0xc8, 0x58, 0xa2, 0xc9, 0xe6, 0x61, 0x99, 0xd9, 0x5e, 0x93, 0x8a, 0x11, 0x1a, 
-	0xc8, 0x17, 0xcb, 0x14, 0xaa, 0x34, 0x98, 0xc3, 0x71, 0x21, 0x95, 0x0c, 0x3d, 0xa8, 0x03, 0x02, 0x1b, 0x16, 0x4e, 0x38, 0x9f, 0xbb, 0x5e, 0x20, 0xad, 0x1f, 0xfc, 0xcc, 0x24, 0x58, 0x20, 0x94, 
-	0x28, 0x13, 0xb8, 0xa7, 0x94, 0x37, 0xc4, 0x38, 0x84, 0x76, 0xe1, 0xcb, 0x13, 0x91, 0x4e, 0x72, 0x98, 0x89, 0x72, 0x11, 0x0b, 0x00, 0x0b, 0xdf, 0xe0, 0x71, 0x13, 0x71, 0xad, 0x47, 0xb7, 0xbf, 
-	0x25, 0xb8, 0xb5, 0x59, 0xf0, 0xb7, 0x05, 0xb7, 0x40, 0x04, 0x37, 0x00, 0x90, 0xf1, 0xed, 0x55, 0xe1, 0x4d, 0x50, 0x10, 0xf1, 0xe2, 0x6b, 0xb3, 0x39, 0x64, 0x48, 0xed, 0x0b, 0x94, 0xcf, 0x96, 
-	0xa8, 0x27, 0x25, 0xd8, 0xbe, 0xa8, 0xc2, 0x55, 0x3d, 0xd0, 0x6b, 0xca, 0xe2, 0xfb, 0x6a, 0xd9, 0x95, 0xd1, 0x2f, 0x67, 0x00, 0x9b, 0x03, 0x20, 0x02, 0x64, 0xc2, 0x5f, 0xc6, 0x63, 0x61, 0xef, 
-	0xd5, 0x4c, 0x9b, 0xf2, 0x2b, 0x5c, 0x49, 0x60, 0xcb, 0xd5, 0x10, 0x97, 0xe5, 0x8c, 0xcf, 0x0c, 0x58, 0xab, 0x75, 0xb6, 0x84, 0x42, 0x06, 0x96, 0x56, 0x9d, 0x99, 0x89, 0xa7, 0x5a, 0x08, 0x0f, 
-	0xf5, 0xe3, 0x07, 0x34, 0x66, 0x7d, 0x55, 0xb9, 0x28, 0x86, 0xe2, 0x14, 0x32, 0xaa, 0xdc, 0x60, 0x9a, 0x03, 0x1e, 0x17, 0x6d, 0x25, 0xb0, 0x20, 0x92, 0x2e, 0x38, 0x14, 0x6a, 0xce, 0xdb, 0x00, 
-	0xfc, 0x2d, 0x8f, 0x18, 0x16, 0xd1, 0x4d, 0x34, 0x5b, 0x0e, 0xe8, 0x09, 0xa2, 0x22, 0x3a, 0x60, 0xa8, 0x65, 0xbd, 0x40, 0x91, 0x24, 0xc8, 0x35, 0x23, 0x2c, 0x9f, 0xd5, 0x4a, 0xf1, 0x22, 0x4a, 
-	0x22, 0xa9, 0x5c, 0x43, 0x10, 0x4a, 0x99, 0xa4, 0x4b, 0x03, 0xbe, 0x9f, 0xe2, 0x76, 0x5a, 0xff, 0xfd, 0xcf, 0xc3, 0x87, 0xfb, 0x7e, 0x33, 0x8a, 0x45, 0x50, 0x66, 0xb7, 0x0d, 0x89, 0x45, 0xf6, 
-	0x8d, 0xda, 0x17, 0x29, 0x07, 0x17, 0x0d, 0x06, 0xb0, 0xba, 0xa4, 0x42, 0xf2, 0x76, 0xeb, 0x06, 0x5c, 0x84, 0xaa, 0xd0, 0xb1, 0xad, 0x47, 0x91, 0x5b, 0x38, 0xa0, 0x0c, 0x2a, 0x51, 0x51, 0xa5, 
-	0xee, 0x9c, 0x7b, 0xa4, 0x96, 0x7a, 0xc2, 0xb7, 0xa9, 0x3d, 0x01, 0x73, 0x10, 0xd2, 0x96, 0xb0, 0x4a, 0x41, 0x34, 0x13, 0x9f, 0x07, 0x51, 0x26, 0x22, 0x74, 0xb9, 0x27, 0xd8, 0x8d, 0x95, 0x8d, 
-	0x89, 0x55, 0x4b, 0x51, 0xc9, 0x17, 0x5a, 0x7c, 0x81, 0x8b, 0xf5, 0x13, 0xee, 0x2a, 0xd4, 0x59, 0x23, 0xd7, 0xfc, 0x81, 0x76, 0x11, 0x10, 0xbe, 0xa1, 0xec, 0xef, 0x2e, 0x8b, 0x86, 0x28, 0xfb, 
-	0x8d, 0x55, 0xc1, 0x98, 0x28, 0x4d, 0x1a, 0x9a, 0xdc, 0xa7, 0x7a, 0x5b, 0x64, 0xff, 0x3e, 0x13, 0x9e, 0xe0, 0x8f, 0x10, 0x0a, 0x5f, 0x43, 0x61, 0x0c, 0x78, 0x06, 0x87, 0x01, 0x6d, 0x0b, 0x73, 
-	0x45, 0xfc, 0x1a, 0x7c, 0xa2, 0x85, 0x76, 0xe0, 0x4b, 0xee, 0x30, 0x7c, 0x4b, 0x6e, 0x40, 0xb9, 0x71, 0x15, 0x61, 0xc5, 0xe2, 0x8b, 0x85, 0xfc, 0xe9, 0xbe, 0x77, 0x37, 0x1a, 0xca, 0xca, 0xe2, 
-	0xba, 0x77, 0x03, 0x37, 0x1f, 0x47, 0xfd, 0x8b, 0xf7, 0xfd, 0xc8, 0x71, 0xbf, 0x66, 0xfc, 0xe0, 0xaf, 0x8f, 0x87, 0xdc, 0x64, 0x74, 0x79, 0x75, 0x3d, 0xec, 0xdf, 0x8b, 0xf6, 0xdb, 0x7e, 0xef, 
-	0xbe, 0x3f, 0x18, 0x46, 0x79, 0x26, 0x0e, 0xa7, 0x65, 0x82, 0xab, 0x11, 0xc7, 0x36, 0x05, 0xd8, 0xfd, 0xfb, 0xb3, 0x9e, 0x58, 0x1e, 0xd9, 0x26, 0x90, 0x79, 0x41, 0x38, 0x4a, 0x2f, 0x2d, 0x21, 
-	0xe2, 0x97, 0x92, 0x06, 0xc0, 0x81, 0x61, 0xf2, 0x12, 0x5d, 0x4a, 0xa7, 0x2d, 0x03, 0xe5, 0xd7, 0x66, 0x1d, 0xff, 0xc1, 0x94, 0xf4, 0x83, 0x9f, 0x45, 0xdd, 0x8c, 0x2e, 0x19, 0x6b, 0x46, 0xed, 
-	0xb9, 0x56, 0xb8, 0x61, 0xdf, 0x20, 0xae, 0x4a, 0xa4, 0xe9, 0xd8, 0x2b, 0x51, 0x02, 0x70, 0x7b, 0x7f, 0x3f, 0x7d, 0x19, 0xdd, 0xb2, 0xe6, 0x86, 0x56, 0x79, 0x29, 0xf1, 0x1e, 0xc4, 0x59, 0xf9, 
-	0xa6, 0x24, 0xfa, 0xb9, 0x8b, 0x61, 0x67, 0x80, 0xe1, 0xcb, 0x84, 0x34, 0xce, 0x5f, 0x68, 0xf3, 0x28, 0xa3, 0xc5, 0xa0, 0xa1, 0x43, 0xa6, 0x05, 0x39, 0xdc, 0x78, 0xc5, 0x4c, 0xf4, 0x13, 0x90, 
-	0xeb, 0x89, 0x58, 0x47, 0x89, 0xde, 0x48, 0x44, 0x31, 0xee, 0x8d, 0x0c, 0xac, 0xa6, 0xe2, 0x3d, 0x29, 0x40, 0x08, 0x16, 0x29, 0xdc, 0x4a, 0x26, 0x22, 0xe7, 0x1c, 0xdd, 0xb9, 0xcd, 0x35, 0xef, 
-	0x12, 0x31, 0xc5, 0x9e, 0x4e, 0x2e, 0x4b, 0xf2, 0x6b, 0xe2, 0xf2, 0x07, 0x78, 0xb3, 0xa8, 0x34, 0x46, 0x78, 0x72, 0xc5, 0x55, 0x56, 0xad, 0x52, 0xf7, 0xe9, 0x69, 0x7b, 0xaf, 0xf6, 0x4b, 0x73, 
-	0x39, 0x99, 0xd4, 0x54, 0x60, 0x5d, 0xa9, 0x27, 0x1d, 0xad, 0x83, 0x0d, 0x1d, 0x87, 0x1b, 0xda, 0x9b, 0xe9, 0x76, 0x8c, 0x2e, 0xa9, 0x59, 0xab, 0xb2, 0xbe, 0xbe, 0xfe, 0x78, 0x2f, 0xb3, 0xbc, 
-	0xd1, 0xd9, 0xd5, 0x90, 0xfd, 0x48, 0x35, 0x5f, 0xf4, 0xef, 0x86, 0x1f, 0xa8, 0x95, 0xf6, 0x8b, 0xb2, 0xac, 0x42, 0x9d, 0x72, 0x01, 0xce, 0xd5, 0xc1, 0xc8, 0xe4, 0x57, 0xe7, 0x60, 0x9d, 0x73, 
-	0x93, 0x98, 0xfc, 0xd0, 0xef, 0xdd, 0xb5, 0x0e, 0xbe, 0xce, 0x17, 0x40, 0xf0, 0xb7, 0x64, 0x13, 0x8a, 0x36, 0x25, 0xbb, 0x49, 0xb7, 0x99, 0xed, 0x16, 0x9b, 0x91, 0xd9, 0x69, 0x3e, 0xe2, 0x24, 
-	0x3d, 0xb9, 0xbd, 0x39, 0x84, 0xc9, 0x28, 0x80, 0xc9, 0x82, 0x18, 0x0d, 0x0c, 0x32, 0x3d, 0x68, 0xc3, 0x90, 0x24, 0x7a, 0xd5, 0x56, 0xb3, 0xd9, 0x54, 0x68, 0x8f, 0x4f, 0xe4, 0x55, 0x90, 0xdf, 
-	0xfb, 0x2e, 0x18, 0x7d, 0x9c, 0xbd, 0xe4, 0xdb, 0x47, 0x14, 0x20, 0x4e, 0xc0, 0xab, 0xe1, 0x76, 0xf2, 0x7a, 0x37, 0xb8, 0x6b, 0x07, 0xca, 0x64, 0x6e, 0x64, 0x6c, 0xe1, 0x0e, 0x5c, 0xbf, 0x4d, 
-	0xd9, 0x0f, 0xb8, 0x55, 0x66, 0x6b, 0xde, 0x14, 0x7e, 0x75, 0x3d, 0x9c, 0x85, 0xb6, 0x86, 0xb0, 0xc2, 0xdc, 0x94, 0x72, 0xaa, 0x6d, 0x24, 0x93, 0xce, 0x93, 0x38, 0x2b, 0x8d, 0x57, 0xdb, 0x5e, 
-	0x93, 0x3e, 0x28, 0xe4, 0xf5, 0x01, 0xa3, 0xb9, 0xad, 0xe9, 0x48, 0x21, 0x10, 0x57, 0x46, 0xa7, 0x08, 0x56, 0x38, 0x32, 0xe1, 0xbe, 0x73, 0xb8, 0xd7, 0x8d, 0x1b, 0x16, 0xd0, 0xb0, 0xdf, 0x6a, 
-	0x13, 0x71, 0x1f, 0x29, 0x3d, 0x92, 0xdb, 0x96, 0xb8, 0x35, 0xcb, 0xcb, 0xba, 0x33, 0x99, 0x8e, 0x74, 0x19, 0xf1, 0xd1, 0x22, 0xc4, 0x27, 0x1d, 0xa6, 0x07, 0xe0, 0x18, 0x06, 0xb0, 0x54, 0xaa, 
-	0x71, 0x00, 0x7e, 0xb3, 0x59, 0x16, 0xe9, 0x50, 0x4c, 0x79, 0xa2, 0x0c, 0x66, 0x19, 0xbf, 0xdf, 0x15, 0x7d, 0x66, 0xae, 0xef, 0x83, 0x54, 0xb4, 0x0c, 0xf2, 0x27, 0x10, 0x5d, 0x43, 0x48, 0xfa, 
-	0x26, 0x50, 0x1e, 0x01, 0xe2, 0x72, 0x09, 0x37, 0x78, 0x22, 0x7c, 0x98, 0x47, 0x43, 0x86, 0x23, 0xf2, 0xfd, 0x08, 0x69, 0xc9, 0x2c, 0xea, 0x8d, 0xd1, 0x3e, 0x97, 0x4b, 0x2f, 0x2e, 0x65, 0xf4, 
-	0x54, 0x39, 0xce, 0x14, 0x1f, 0x98, 0xaf, 0xae, 0x95, 0x0b, 0x5f, 0x69, 0xcb, 0xf5, 0xf0, 0x5d, 0x9d, 0x1d, 0xec, 0xc3, 0x2f, 0xf9, 0x43, 0x06, 0x56, 0x7d, 0x48, 0x8e, 0x18, 0xec, 0xf7, 0x10, 
-	0x9d, 0x1d, 0x2e, 0x2b, 0x55, 0xad, 0x0c, 0x3e, 0xf5, 0xee, 0x2a, 0x19, 0xeb, 0xfd, 0x40, 0x59, 0xf5, 0x8d, 0x2b, 0xf6, 0x75, 0x44, 0x8a, 0x03, 0x29, 0x64, 0x92, 0xe1, 0xbc, 0x20, 0xdf, 0x72, 
-	0xe9, 0x67, 0xc8, 0x7c, 0x07, 0x24, 0xbe, 0xfb, 0x15, 0x48, 0x84, 0xfa, 0xe4, 0xdd, 0x21, 0xa5, 0x53, 0x4b, 0x22, 0x13, 0x66, 0x5c, 0xd1, 0x45, 0x33, 0xfa, 0x8f, 0x04, 0x08, 0xa2, 0x21, 0xf0, 
-	0x56, 0x6e, 0x3e, 0x0e, 0x6f, 0x8b, 0x88, 0x3e, 0x0b, 0x83, 0x20, 0x45, 0x74, 0x00, 0xb9, 0x84, 0xe1, 0x2e, 0x9c, 0x7f, 0x80, 0xf4, 0x83, 0x03, 0x20, 0x7b, 0x7f, 0x3b, 0xe9, 0x38, 0x3d, 0x51, 
-	0x92, 0xa2, 0xfe, 0xec, 0xa1, 0x98, 0xfa, 0x7f, 0x73, 0x40, 0xfd, 0xc8, 0x57, 0xff, 0x18, 0xd1, 0xef, 0x80, 0xe0, 0x03, 0x94, 0x37, 0xfc, 0x21, 0x03, 0x82, 0xc4, 0x64, 0xc6, 0x84, 0xc4, 0x7f, 
-	0xf7, 0xbf, 0x9c, 0x11, 0x89, 0xb8, 0x30, 0xff, 0xb1, 0x0f, 0x46, 0xa7, 0x7b, 0xb9, 0xad, 0x17, 0xc9, 0xc2, 0xc7, 0xdc, 0x7d, 0x64, 0x6b, 0xe8, 0x1c, 0x70, 0xe1, 0x8c, 0xf0, 0x09, 0xc8, 0xa8, 
-	0x0d, 0xeb, 0x40, 0xd9, 0xef, 0x96, 0xd1, 0x81, 0x8f, 0xce, 0x7a, 0xc3, 0xf3, 0x0f, 0xd0, 0xd0, 0x3e, 0x68, 0xb7, 0xf6, 0xc0, 0x99, 0x94, 0xa9, 0x19, 0x77, 0x6b, 0xb0, 0x82, 0xfe, 0x4d, 0xba, 
-	0xaa, 0x4c, 0x66, 0x90, 0x8c, 0xdb, 0xe9, 0xd4, 0xba, 0x19, 0xf8, 0xf3, 0x02, 0xd7, 0x96, 0x80, 0xa7, 0x80, 0xef, 0x52, 0x0e, 0x2d, 0x13, 0x51, 0x2e, 0xed, 0xd0, 0x37, 0xef, 0xa9, 0x02, 0x14, 
-	0x5e, 0xe8, 0xa5, 0xbc, 0x25, 0x43, 0x6a, 0x3d, 0x73, 0x7b, 0x9e, 0xdc, 0x8a, 0xb9, 0x30, 0x3b, 0x2b, 0x98, 0x3d, 0x6d, 0x39, 0x38, 0xcd, 0xff, 0x85, 0x1a, 0xa8, 0x5b, 0x5f, 0x82, 0x2e, 0xf5, 
-	0x15, 0x7e, 0x2d, 0x5b, 0x78, 0x85, 0x5f, 0xcb, 0x36, 0x5e, 0xe1, 0xd7, 0xb2, 0x83, 0x57, 0x1d, 0xd0, 0xb0, 0xd8, 0x89, 0x3d, 0xe3, 0xba, 0x86, 0x65, 0xc5, 0x1f, 0x30, 0x38, 0xca, 0x5c, 0x21, 
-	0x36, 0xac, 0xb0, 0xd6, 0x98, 0x84, 0xb6, 0x58, 0x71, 0x56, 0xf0, 0xd6, 0x67, 0x63, 0xcc, 0x1f, 0x02, 0x17, 0xec, 0x84, 0xcf, 0x93, 0x3d, 0x9f, 0x20, 0x62, 0x8a, 0x59, 0x13, 0x36, 0x77, 0x7d, 
-	0xdf, 0x1a, 0xdb, 0xf8, 0x00, 0x47, 0x6e, 0x29, 0x81, 0x07, 0xf5, 0x01, 0x15, 0x23, 0xdd, 0x6a, 0xde, 0xd8, 0x02, 0xaf, 0xe6, 0xad, 0xc4, 0x6c, 0xb2, 0x4a, 0xc9, 0x72, 0x76, 0x7a, 0xc2, 0x12, 
-	0xa9, 0x37, 0x20, 0x5b, 0x5a, 0x17, 0x6d, 0x94, 0x12, 0xc6, 0xe2, 0xfb, 0x9a, 0x41, 0xb1, 0xd3, 0xd9, 0x6d, 0x52, 0x60, 0x5e, 0x42, 0xe1, 0xcb, 0x5e, 0x06, 0x14, 0x11, 0x7c, 0xd5, 0xec, 0x6e, 
-	0xc3, 0xd8, 0x11, 0x18, 0x5b, 0x5b, 0x31, 0xee, 0x09, 0x8c, 0xad, 0xad, 0x18, 0x0f, 0x04, 0xc6, 0xf6, 0x56, 0x8c, 0xef, 0x04, 0xc6, 0xf6, 0x56, 0x8c, 0xbf, 0xbe, 0x16, 0x63, 0xab, 0xf9, 0x5a, 
-	0x94, 0xad, 0x76, 0xcc, 0xf7, 0x16, 0xc0, 0xce, 0x6b, 0xf9, 0x6e, 0xed, 0x0b, 0x94, 0x9d, 0xad, 0x28, 0x85, 0x84, 0x56, 0x9d, 0x1c, 0xca, 0xf3, 0x2c, 0xa4, 0x54, 0x76, 0x9c, 0x21, 0x6c, 0x81, 
-	0x6e, 0xfd, 0x14, 0x74, 0xfb, 0xa7, 0xa0, 0x3b, 0x3f, 0x05, 0xbd, 0xf7, 0x53, 0xd0, 0xfb, 0x1b, 0xa1, 0xc5, 0xba, 0xd9, 0x3d, 0x61, 0x07, 0xeb, 0x49, 0xee, 0x10, 0x3c, 0xcf, 0x9d, 0xb5, 0xe4, 
-	0x90, 0xc6, 0xa3, 0x33, 0x58, 0xb5, 0x44, 0x34, 0x59, 0xb6, 0x76, 0x77, 0xbb, 0x70, 0x07, 0xdf, 0x22, 0xc9, 0xb1, 0xdb, 0x72, 0x77, 0x69, 0xcd, 0xe1, 0xc6, 0x00, 0xe1, 0x26, 0x88, 0xdd, 0x26, 
-	0x7a, 0xe4, 0x52, 0xe2, 0x81, 0x96, 0xad, 0x06, 0x80, 0xe3, 0x6c, 0xe2, 0x17, 0x66, 0xb3, 0xdb, 0xe9, 0xdb, 0xa8, 0x9b, 0x9a, 0xe3, 0x5e, 0xf8, 0x91, 0x79, 0xfa, 0x3a, 0x0f, 0x03, 0xb1, 0xed, 
-	0x1c, 0x71, 0x01, 0xa3, 0x70, 0x48, 0x9b, 0xb8, 0x51, 0xd5, 0xec, 0x06, 0xf9, 0xb2, 0xc5, 0x76, 0x59, 0x05, 0xfe, 0xed, 0x22, 0xbf, 0xd1, 0xe5, 0xb2, 0x9d, 0xb4, 0xb6, 0x45, 0x29, 0x81, 0x7c, 
-	0x59, 0x00, 0x7d, 0x02, 0x43, 0x24, 0x9b, 0xd6, 0x0a, 0x6f, 0x57, 0xf1, 0xed, 0x12, 0xe5, 0xb2, 0x6c, 0xc7, 0xbd, 0x78, 0x8b, 0xcb, 0x46, 0xdc, 0x1b, 0xb8, 0x95, 0x02, 0x30, 0x0d, 0x2b, 0x46, 
-	0x60, 0xac, 0xb0, 0x69, 0x05, 0x4d, 0x09, 0x92, 0x19, 0x3d, 0x95, 0x6c, 0x29, 0xea, 0x8d, 0x16, 0x98, 0x8a, 0xff, 0x87, 0x17, 0x54, 0x8d, 0xe5, 0x8e, 0xb1, 0xdc, 0x35, 0x56, 0x3b, 0xc6, 0x0a, 
-	0x9d, 0x3b, 0x20, 0xda, 0x39, 0x21, 0x40, 0xbc, 0x59, 0xa5, 0x6e, 0x10, 0x01, 0x24, 0x9d, 0xa6, 0x8b, 0x53, 0x01, 0xfc, 0x4b, 0x3a, 0x22, 0x38, 0x98, 0xbf, 0x01, 0xd8, 0x37, 0xc0, 0x81, 0xc7, 
-	0x45, 0x41, 0x00, 0xaa, 0xa5, 0x8a, 0x02, 0x11, 0xaa, 0x43, 0xbe, 0xb0, 0x6d, 0x95, 0x6e, 0x03, 0xc1, 0x34, 0x24, 0x5c, 0x23, 0x86, 0x13, 0x6d, 0xab, 0xa4, 0x2d, 0x71, 0xf4, 0xee, 0xd4, 0xd2, 
-	0xb1, 0x3e, 0xb5, 0x1c, 0xdd, 0xf5, 0x3c, 0xc8, 0x4b, 0x14, 0xf6, 0xf9, 0xf3, 0x67, 0x76, 0x79, 0xf5, 0xf9, 0xa6, 0xaf, 0xa4, 0xcd, 0xa3, 0x4a, 0xa8, 0x25, 0x57, 0x35, 0xa8, 0xf6, 0x08, 0xad, 
-	0xa4, 0x9e, 0xee, 0x49, 0x83, 0xd9, 0xfe, 0xdd, 0x4c, 0x7f, 0x3b, 0x37, 0xbe, 0x9d, 0x19, 0x4f, 0x6a, 0x4b, 0x23, 0x20, 0xc5, 0xc5, 0x18, 0x8a, 0x8a, 0x41, 0xb4, 0xb1, 0x7b, 0xa0, 0x99, 0x42, 
-	0x59, 0xa1, 0x95, 0xfd, 0x37, 0xd6, 0x92, 0x62, 0x1e, 0x30, 0xd4, 0x61, 0x58, 0x1d, 0x60, 0xe5, 0x2f, 0xde, 0xb7, 0xe5, 0x7d, 0x7b, 0x13, 0x6d, 0x77, 0xae, 0x0d, 0x99, 0xdb, 0x1c, 0x77, 0xf2, 
-	0x7d, 0xf9, 0x6c, 0x42, 0x50, 0x25, 0x2e, 0x65, 0x45, 0x4e, 0xb3, 0x62, 0x6e, 0xf0, 0x23, 0xba, 0x83, 0xe8, 0xec, 0x47, 0x5b, 0xf3, 0x8d, 0x76, 0x77, 0x7b, 0xc0, 0xc5, 0x01, 0x3b, 0x9d, 0x4d, 
-	0x51, 0x77, 0x82, 0x75, 0x3e, 0xcd, 0xd0, 0x85, 0x9f, 0x63, 0x42, 0x0f, 0x57, 0xbb, 0xbb, 0x51, 0xe1, 0xf3, 0x8a, 0xb0, 0x2c, 0x98, 0xf8, 0xda, 0xfc, 0xd6, 0xdd, 0x0a, 0xdf, 0x4a, 0xc1, 0xb7, 
-	0x5e, 0x01, 0xdf, 0x49, 0xc1, 0x5b, 0x3b, 0x6d, 0xf0, 0xde, 0xdb, 0xc7, 0xec, 0xe5, 0xc6, 0x74, 0x5e, 0x31, 0xe6, 0x20, 0x37, 0x66, 0xef, 0x15, 0x63, 0xde, 0xe5, 0xc6, 0xec, 0x7f, 0x43, 0x81, 
-	0xfe, 0x64, 0x60, 0xfb, 0xc9, 0xc8, 0xf6, 0x73, 0xa1, 0x2d, 0x05, 0x1f, 0x87, 0x94, 0x0e, 0x15, 0xa4, 0x79, 0x8b, 0x1c, 0xf0, 0xe0, 0x1a, 0xca, 0x5d, 0x2a, 0x68, 0xab, 0xe2, 0x20, 0x98, 0xb0, 
-	0xc6, 0x4d, 0x29, 0x3b, 0xdd, 0xaa, 0x6d, 0xa5, 0xd9, 0x85, 0x4c, 0x5f, 0x7a, 0x18, 0x2a, 0x2a, 0x52, 0xa7, 0xa1, 0x2c, 0xfd, 0xf1, 0x53, 0x54, 0xb9, 0x24, 0x45, 0x7c, 0xd1, 0x16, 0x4a, 0x83, 
-	0x15, 0x6e, 0x82, 0x9c, 0xb2, 0x4e, 0x64, 0x86, 0x9b, 0x8e, 0x35, 0xb1, 0x8a, 0x38, 0xea, 0x55, 0x61, 0x35, 0xc5, 0x82, 0xe2, 0xc9, 0xfb, 0x30, 0xbc, 0xb9, 0x06, 0xfa, 0x2a, 0xe7, 0xa2, 0x94, 
-	0x82, 0x6a, 0xbc, 0x82, 0x72, 0x03, 0x2a, 0x6f, 0xe5, 0xa1, 0x24, 0x59, 0x64, 0x81, 0x07, 0x2b, 0x6d, 0xd8, 0x7a, 0x29, 0x20, 0xb1, 0x5b, 0x00, 0x5d, 0xb0, 0x13, 0xb3, 0x06, 0x24, 0x4b, 0x10, 
-	0x90, 0xc3, 0x40, 0xc8, 0x81, 0xb1, 0xca, 0xc2, 0x3f, 0x82, 0x42, 0x0c, 0xa4, 0x16, 0x3d, 0xad, 0x52, 0x68, 0xdf, 0x0f, 0x82, 0x99, 0x6a, 0xa8, 0x0b, 0x5f, 0xd5, 0x67, 0xc6, 0x38, 0x9c, 0x88, 
-	0xb3, 0x16, 0x79, 0x7c, 0xb8, 0x19, 0x0f, 0xe9, 0xf6, 0x70, 0x35, 0x47, 0x42, 0xdf, 0x6a, 0x58, 0xd4, 0x88, 0x6d, 0x99, 0xb7, 0x45, 0xd0, 0xae, 0xe3, 0xce, 0xc5, 0x49, 0x36, 0xa9, 0x15, 0xd0, 
-	0x43, 0x89, 0x04, 0xfa, 0x97, 0x25, 0xca, 0x0d, 0x12, 0xe8, 0x8b, 0xd2, 0xc0, 0xe7, 0x8f, 0x04, 0x94, 0xec, 0xe1, 0xe0, 0xed, 0x73, 0x21, 0x85, 0x33, 0xee, 0xfb, 0xda, 0x94, 0xa7, 0x88, 0x64, 
-	0x55, 0xfe, 0x04, 0xe4, 0xc8, 0xa3, 0x35, 0xe8, 0xf5, 0xe8, 0x19, 0x30, 0x35, 0x2a, 0xb8, 0x89, 0x5c, 0x48, 0xc0, 0xcb, 0xca, 0x23, 0xdb, 0xd3, 0xc6, 0xca, 0x78, 0x15, 0xf0, 0x6b, 0xee, 0x4c, 
-	0xc1, 0xc0, 0x4f, 0xe8, 0x19, 0x0e, 0xf6, 0xd1, 0x3c, 0x25, 0xdc, 0x45, 0x73, 0x75, 0xa0, 0x26, 0xde, 0x2d, 0x2b, 0xc9, 0xe9, 0x13, 0x17, 0x2c, 0x1b, 0x70, 0x49, 0xd0, 0x6e, 0xb6, 0x70, 0xd3, 
-	0xf0, 0x59, 0x98, 0x16, 0xc6, 0x19, 0xf4, 0xa1, 0x1b, 0xb7, 0xcc, 0x68, 0x2e, 0x39, 0x19, 0xa5, 0x16, 0x02, 0xc3, 0x3a, 0xfc, 0x57, 0x70, 0xc0, 0xdf, 0x04, 0x5e, 0x24, 0xbb, 0x2a, 0x20, 0x4f, 
-	0x4f, 0x4f, 0x59, 0x7b, 0x0f, 0x3c, 0xf9, 0x2f, 0xb8, 0x63, 0xc6, 0x7e, 0xf9, 0x85, 0x65, 0xbb, 0x0e, 0x6b, 0xec, 0x0d, 0xd4, 0xce, 0x58, 0xea, 0xa7, 0x26, 0xca, 0xa6, 0x52, 0x95, 0x4b, 0x7c, 
-	0x4e, 0x81, 0x8f, 0x95, 0xd0, 0x00, 0x2d, 0xca, 0xa0, 0xee, 0xb9, 0x86, 0xa7, 0x1c, 0xa8, 0x85, 0xb0, 0x61, 0x23, 0x72, 0x48, 0x2d, 0x31, 0xab, 0xd8, 0x0a, 0xcb, 0x08, 0xdb, 0x8a, 0x28, 0x6e, 
-	0x80, 0xb7, 0x8a, 0xf2, 0xb1, 0xc2, 0xfe, 0xf6, 0xcb, 0xfd, 0xe0, 0x04, 0x3a, 0x5b, 0x30, 0x80, 0x67, 0x17, 0xba, 0x2c, 0x95, 0xc6, 0x50, 0xd3, 0x3e, 0x8a, 0xeb, 0x67, 0x21, 0xcf, 0x44, 0x23, 
-	0xb1, 0x85, 0x94, 0xfc, 0x85, 0x15, 0xe8, 0x66, 0x46, 0x46, 0x39, 0xd9, 0x68, 0x50, 0x28, 0x1f, 0x1c, 0xa5, 0x6e, 0x9a, 0x47, 0x0c, 0x9d, 0x05, 0x9e, 0x4e, 0xb4, 0x9c, 0x50, 0x3c, 0x4c, 0x6e, 
-	0xe0, 0x73, 0x2b, 0xdf, 0x74, 0x43, 0xdb, 0x80, 0xd5, 0xfc, 0x84, 0x7b, 0x99, 0xb8, 0x8d, 0xc8, 0x3d, 0x2e, 0x4c, 0x24, 0x43, 0x8e, 0x40, 0xd3, 0x3a, 0x62, 0xe2, 0x89, 0x36, 0xa3, 0xbd, 0x74, 
-	0xd1, 0x23, 0x27, 0x25, 0xdd, 0x83, 0x8b, 0xde, 0xa6, 0x7a, 0x40, 0x95, 0xde, 0x25, 0x45, 0x65, 0xe3, 0xa8, 0xac, 0x19, 0x4c, 0xe0, 0xe2, 0x07, 0xf5, 0x25, 0xbd, 0xad, 0x83, 0x74, 0xef, 0xf1, 
-	0x31, 0x3b, 0x2c, 0x00, 0x3a, 0xcc, 0xc1, 0xd0, 0xa0, 0x3c, 0x50, 0x33, 0x07, 0x84, 0xf3, 0x76, 0x0b, 0x78, 0x7e, 0x4e, 0xb1, 0xde, 0x96, 0xe2, 0x2c, 0xe5, 0xca, 0x15, 0x52, 0x02, 0x22, 0xeb, 
-	0x4c, 0x26, 0x93, 0x7a, 0xda, 0x72, 0x5b, 0x11, 0x37, 0xd8, 0x53, 0x3c, 0x01, 0x61, 0xee, 0x1c, 0xad, 0xcb, 0xd1, 0xe1, 0xcb, 0x60, 0xc2, 0x17, 0xd2, 0xcf, 0x5e, 0x39, 0x41, 0xeb, 0x40, 0xee, 
-	0x8a, 0xad, 0xcb, 0x56, 0x1e, 0xb3, 0x50, 0x7c, 0xdb, 0xd2, 0x71, 0xad, 0xee, 0xec, 0xd5, 0xf1, 0x6b, 0xf7, 0x50, 0xec, 0x99, 0x5a, 0xbb, 0x27, 0xed, 0x6e, 0x8e, 0xf6, 0xb8, 0x4c, 0x91, 0xf3, 
-	0x40, 0x96, 0x53, 0x8f, 0xaf, 0x5b, 0xa9, 0xeb, 0x76, 0xea, 0xba, 0xf3, 0x6d, 0xbb, 0x94, 0xf6, 0xfe, 0xff, 0x79, 0x49, 0xa5, 0xc3, 0x7f, 0x37, 0x37, 0xfb, 0x45, 0xdc, 0x84, 0xb3, 0x79, 0xe0, 
-	0xcb, 0xf5, 0x28, 0xad, 0x88, 0xb6, 0xf8, 0x13, 0x10, 0x72, 0xeb, 0x7f, 0x9d, 0x57, 0x31, 0xc3, 0xce, 0x1e, 0xb1, 0x2c, 0xd1, 0x5a, 0x98, 0xe4, 0x88, 0x8e, 0x3c, 0xff, 0x22, 0xe5, 0xa6, 0x63, 
-	0x38, 0x82, 0xb4, 0xad, 0x6c, 0xbd, 0xcb, 0xb1, 0xa5, 0xaa, 0x69, 0x48, 0xbc, 0xb5, 0xad, 0xe0, 0x4d, 0x6a, 0x9a, 0x5c, 0x7e, 0x9d, 0x70, 0xba, 0x5c, 0x6d, 0x5f, 0xed, 0x04, 0x87, 0xf5, 0xc6, 
-	0x2a, 0x96, 0x56, 0xba, 0x0b, 0x31, 0x54, 0xa1, 0x2f, 0xb7, 0xc2, 0xb3, 0x40, 0x8b, 0xb4, 0xbc, 0x3b, 0xb9, 0x4e, 0x7c, 0x4c, 0x51, 0xc5, 0x5e, 0x40, 0xd1, 0xda, 0xab, 0x15, 0xc2, 0xc4, 0x2a, 
-	0x49, 0x6f, 0x30, 0xbf, 0x5e, 0x25, 0x6c, 0xb1, 0x63, 0x16, 0x28, 0x04, 0x5a, 0xd3, 0xda, 0x58, 0x3f, 0x7d, 0x41, 0x6a, 0xc9, 0x1c, 0xba, 0x78, 0x59, 0x33, 0x87, 0x39, 0xcd, 0xbc, 0x28, 0x7c, 
-	0x50, 0xf7, 0x18, 0x72, 0xad, 0xc7, 0x9c, 0x31, 0xa6, 0x41, 0x26, 0xbe, 0xc7, 0xff, 0x20, 0x27, 0x1b, 0x7b, 0xa5, 0xc8, 0x41, 0xb6, 0xd2, 0x70, 0xf4, 0x42, 0x88, 0x4d, 0x29, 0x55, 0x35, 0xf1, 
-	0x5f, 0x89, 0x36, 0x32, 0x9e, 0x7b, 0x3c, 0x8d, 0x7c, 0xf7, 0x2b, 0x34, 0x0f, 0xf3, 0xfb, 0xdb, 0x21, 0xd3, 0x8f, 0xd7, 0x68, 0x44, 0xde, 0x08, 0xd2, 0x0f, 0xe4, 0xaa, 0x02, 0x64, 0x93, 0xbd, 
-	0x6c, 0x7c, 0x3c, 0x9c, 0xa6, 0x3d, 0x23, 0xc8, 0xdf, 0xd3, 0x79, 0x50, 0x4a, 0x20, 0xff, 0x95, 0xc9, 0xc4, 0x22, 0x2d, 0x58, 0xc5, 0x52, 0x6d, 0x0d, 0x2a, 0x5b, 0xe8, 0x13, 0xa7, 0xad, 0xe9, 
-	0x89, 0xf1, 0x74, 0xca, 0x05, 0xd7, 0x5d, 0xd2, 0xbc, 0x62, 0xd0, 0x55, 0x55, 0x92, 0x16, 0xe3, 0xcc, 0xbe, 0xd9, 0x81, 0xfa, 0xde, 0xb6, 0xfc, 0x7f, 0x3d, 0x8a, 0x17, 0xfa, 0x20, 0xfd, 0xcc, 
-	0xbe, 0x8a, 0x47, 0xc7, 0x70, 0x53, 0x9d, 0xf6, 0xd4, 0x0d, 0x91, 0x1f, 0x18, 0x3c, 0x00, 0xff, 0xca, 0xc0, 0xfc, 0xe8, 0x91, 0x3c, 0x8a, 0x54, 0xbc, 0x1c, 0xa1, 0xb1, 0x66, 0xc3, 0x16, 0x19, 
-	0xa7, 0x4c, 0x75, 0x95, 0xda, 0x36, 0xab, 0x5d, 0xcf, 0x27, 0x20, 0x2f, 0x51, 0x55, 0x1f, 0x53, 0x4f, 0xa8, 0xd3, 0x44, 0xf9, 0x95, 0x42, 0x92, 0xad, 0xdf, 0xd2, 0x0e, 0xb7, 0xd0, 0xc9, 0x3d, 
-	0xcb, 0x6f, 0xfa, 0x29, 0x7e, 0x36, 0x19, 0xa7, 0xf0, 0xa5, 0x2d, 0x4f, 0x80, 0x23, 0x74, 0x1c, 0x0a, 0xa0, 0x24, 0x97, 0x2e, 0x50, 0xbf, 0xcf, 0x83, 0xea, 0xfa, 0xa3, 0x66, 0xf0, 0x37, 0xb5, 
-	0xfa, 0x0b, 0x29, 0xf3, 0x16, 0x1a, 0xc0, 0x4c, 0x32, 0x49, 0xbd, 0xba, 0xd7, 0x8d, 0x28, 0x2a, 0xae, 0x36, 0x74, 0xdb, 0xf5, 0xd3, 0xb5, 0x86, 0x2c, 0x35, 0xa2, 0xaa, 0x28, 0x97, 0x2c, 0xbb, 
-	0x9e, 0x0e, 0xfa, 0xa5, 0x31, 0x8a, 0x2c, 0xc8, 0x5e, 0x57, 0x06, 0x3e, 0xcb, 0x2a, 0x3b, 0xf3, 0x89, 0xeb, 0x1b, 0x5a, 0x70, 0x03, 0x3c, 0xd7, 0x55, 0x95, 0x6f, 0xd7, 0x64, 0xe6, 0xdd, 0x3c, 
-	0x43, 0x94, 0x1e, 0x17, 0xe9, 0xac, 0xd6, 0xdd, 0xfe, 0x94, 0xbc, 0x5c, 0x2a, 0x25, 0xcf, 0xc9, 0x11, 0xb8, 0xe8, 0x2d, 0xa5, 0xf8, 0x74, 0x99, 0x28, 0xbd, 0x21, 0x87, 0xbd, 0xa0, 0x53, 0x4d, 
-	0x1a, 0xc8, 0x5d, 0x4f, 0xbf, 0x09, 0x45, 0x8f, 0xb6, 0x85, 0xde, 0x11, 0x30, 0xbb, 0xc0, 0xd6, 0x5f, 0x74, 0x12, 0xaf, 0x75, 0xa8, 0xea, 0xa5, 0xb5, 0x0c, 0xe7, 0xd1, 0x1b, 0x4b, 0xbe, 0xf5, 
-	0x9d, 0xfb, 0x79, 0x5a, 0xe2, 0xa7, 0xee, 0xf9, 0x27, 0xf8, 0xb9, 0xc3, 0x1b, 0xb4, 0x11, 0xe1, 0x18, 0xee, 0x42, 0x54, 0xaa, 0xf1, 0xf3, 0xf8, 0x82, 0x93, 0x5d, 0xb9, 0x63, 0x1d, 0xb9, 0x91, 
-	0xf1, 0xb3, 0xfa, 0x92, 0x84, 0xa2, 0x57, 0xed, 0xb0, 0xea, 0x5d, 0x7f, 0xa9, 0x8d, 0x05, 0xee, 0x1c, 0x5f, 0xb8, 0xb3, 0xf9, 0x24, 0x80, 0xdf, 0x4a, 0x4e, 0x0a, 0xaf, 0xa0, 0x39, 0x76, 0xe2, 
-	0xaf, 0xa6, 0x35, 0xf6, 0xea, 0xdd, 0x52, 0x89, 0xe6, 0x93, 0x12, 0x2b, 0x32, 0x83, 0x48, 0x6b, 0x37, 0xda, 0x23, 0x17, 0xa7, 0xd4, 0x22, 0xf4, 0x74, 0xc2, 0x5b, 0xbe, 0x55, 0x17, 0x9d, 0x60, 
-	0xa5, 0x03, 0x48, 0x72, 0x7b, 0x97, 0x86, 0x7d, 0xc2, 0x23, 0x7a, 0x78, 0x52, 0xd5, 0xc7, 0xe3, 0x88, 0xe0, 0xd8, 0x80, 0x16, 0x36, 0xd7, 0xa0, 0x2a, 0x86, 0xa0, 0xcd, 0x3d, 0x3a, 0xd5, 0xe7, 
-	0x7a, 0x50, 0x30, 0xc2, 0x62, 0xc4, 0xbd, 0xe1, 0xc0, 0x4d, 0xbd, 0x4d, 0xa0, 0xe4, 0x18, 0xaa, 0xca, 0x27, 0xd1, 0x05, 0x47, 0xf0, 0x36, 0x9d, 0xbe, 0x03, 0x12, 0x1e, 0xe6, 0x06, 0x9e, 0x63, 
-	0x89, 0x0f, 0xb5, 0x27, 0x07, 0x79, 0xab, 0x03, 0x5d, 0xb3, 0xb9, 0xea, 0x9b, 0xd6, 0x84, 0xd6, 0xec, 0x86, 0xf3, 0x82, 0x75, 0x3c, 0x44, 0xf6, 0xd3, 0xa7, 0x05, 0x4b, 0x8d, 0xa6, 0xb2, 0x4f, 
-	0xc7, 0x5e, 0x05, 0x21, 0xe9, 0xcd, 0x8b, 0xfc, 0xa6, 0x59, 0xcf, 0xb1, 0x66, 0x54, 0x1c, 0xd2, 0x52, 0x16, 0xab, 0x38, 0xb7, 0xe1, 0x05, 0xca, 0x4d, 0xaf, 0x73, 0x7a, 0x71, 0x86, 0xb4, 0x98, 
-	0x1b, 0x9b, 0xc3, 0x25, 0x37, 0x8c, 0x5f, 0x0d, 0x2b, 0x4d, 0x45, 0x33, 0x8c, 0x3e, 0x7a, 0xb2, 0x6b, 0xcb, 0x0f, 0x38, 0x58, 0x74, 0xf5, 0xed, 0xcc, 0x85, 0xe0, 0x34, 0x83, 0xd5, 0xf7, 0xb6, 
-	0xce, 0xc0, 0x94, 0x4f, 0xd9, 0x9f, 0xb9, 0x03, 0x20, 0x5c, 0x11, 0xe7, 0x2e, 0x3f, 0xd7, 0xe3, 0xcb, 0x2f, 0x78, 0x39, 0xa6, 0xb3, 0x16, 0x98, 0x1e, 0xb3, 0xe7, 0x17, 0x67, 0x08, 0xdc, 0x50, 
-	0x37, 0x5f, 0x9e, 0x81, 0x40, 0x38, 0x6e, 0x0e, 0x2b, 0xba, 0x6d, 0xc1, 0x68, 0x9a, 0x6c, 0xad, 0x15, 0xe6, 0x6d, 0x6d, 0x9f, 0x8f, 0x38, 0x0a, 0xe7, 0xc9, 0x6c, 0x2c, 0x77, 0x3a, 0xe4, 0x65, 
-	0x8e, 0xea, 0x58, 0xce, 0x76, 0xa3, 0xd3, 0x5a, 0xc2, 0x55, 0xbf, 0x66, 0x46, 0x3c, 0x41, 0x91, 0xe7, 0xf0, 0xb5, 0x33, 0xb6, 0x36, 0xcc, 0x18, 0xa7, 0x31, 0xeb, 0x73, 0x3e, 0xf2, 0x55, 0xd1, 
-	0x8c, 0x74, 0x86, 0x84, 0x2b, 0xd0, 0x7b, 0x0e, 0xd9, 0x4d, 0x5a, 0x5e, 0x2f, 0xe3, 0x2a, 0x92, 0x57, 0x1e, 0x57, 0x33, 0xc6, 0x85, 0xc7, 0x42, 0x76, 0x52, 0x67, 0xb0, 0xe8, 0x75, 0x12, 0x61, 
-	0xc1, 0x22, 0x9f, 0x4a, 0x1f, 0x8a, 0x5e, 0xcb, 0xc5, 0x02, 0xf7, 0x61, 0x78, 0x79, 0x98, 0xce, 0xbc, 0x5e, 0xe3, 0xc1, 0x73, 0x60, 0x1b, 0x9d, 0xa0, 0x89, 0x0b, 0x63, 0x47, 0x15, 0x6f, 0x48, 
-	0xcb, 0x37, 0x79, 0xe1, 0x12, 0x5f, 0x8d, 0x3e, 0x2d, 0x1f, 0xab, 0xe2, 0x1d, 0xef, 0xff, 0x00, 0x62, 0xbb, 0xd2, 0xb4, 0xfc, 0x3d, 0x00, 0x00, };
+	0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x3c, 0xfd, 0x57, 0xe2, 0xc8, 0xb2, 0x3f, 0xe3, 0x5f, 0xd1, 0xc3, 0x3b, 0x6f, 0x07, 0x15, 0x42, 0x00, 0x75, 0x5c, 0x51, 0xf7, 
+	0xa0, 0xe2, 0x8c, 0xf7, 0xaa, 0xe3, 0x15, 0xdc, 0x99, 0x39, 0x73, 0xf6, 0x70, 0x42, 0xd2, 0x90, 0xac, 0x21, 0x61, 0xf3, 0x21, 0x30, 0x3b, 0xf3, 0xbf, 0xdf, 0xaa, 0xea, 0xee, 0x7c, 0x01, 0xa2, 
+	0xfb, 0x76, 0x9f, 0xbb, 0x23, 0x49, 0x77, 0x75, 0x75, 0x55, 0x75, 0x75, 0x7d, 0x75, 0x23, 0x3b, 0x7e, 0x73, 0xf1, 0xf1, 0xbc, 0xff, 0xe5, 0xae, 0xcb, 0xec, 0x68, 0xe2, 0x9e, 0x6e, 0x1d, 0x8b, 
+	0x8f, 0xd2, 0xb1, 0xcd, 0x0d, 0x0b, 0x3e, 0x4b, 0xc7, 0x13, 0x1e, 0x19, 0xcc, 0xb4, 0x8d, 0x20, 0xe4, 0xd1, 0x49, 0xf9, 0xa1, 0x7f, 0x59, 0x3b, 0x2c, 0x53, 0x47, 0xe4, 0x44, 0x2e, 0x3f, 0x35, 
+	0x3d, 0x3b, 0x8a, 0xa6, 0xc7, 0x75, 0xf1, 0x86, 0xed, 0x61, 0xb4, 0x10, 0x4f, 0xa5, 0xa1, 0x6f, 0x2d, 0xd8, 0x9f, 0x6c, 0x68, 0x98, 0x8f, 0xe3, 0xc0, 0x8f, 0x3d, 0xab, 0x66, 0xfa, 0xae, 0x1f, 
+	0x1c, 0xb1, 0xff, 0xd1, 0xe1, 0xe7, 0x50, 0x6f, 0xb3, 0x1f, 0x08, 0x66, 0xf9, 0x66, 0x3c, 0xe1, 0x5e, 0xc4, 0x8e, 0xd8, 0x9f, 0xfe, 0x13, 0x0f, 0x46, 0xae, 0x3f, 0x3b, 0x62, 0xb6, 0x63, 0x59, 
+	0xdc, 0x6b, 0xb3, 0x99, 0x63, 0x45, 0xf6, 0x49, 0x43, 0xd7, 0xff, 0xb7, 0xcd, 0x6c, 0xee, 0x8c, 0xed, 0x48, 0xbc, 0xe0, 0xd0, 0xe3, 0xba, 0x9a, 0xec, 0xb8, 0x2e, 0x09, 0x3e, 0xa6, 0x49, 0xa9, 
+	0xf9, 0xa4, 0x2c, 0xe0, 0x8f, 0x08, 0x7e, 0x62, 0x04, 0x63, 0xc7, 0x3b, 0x82, 0x49, 0xa7, 0x86, 0x65, 0x39, 0xde, 0xf8, 0x48, 0x17, 0x7c, 0x58, 0xce, 0x13, 0xeb, 0xf5, 0xbf, 0x5c, 0x77, 0x4f, 
+	0xca, 0x53, 0x3f, 0x74, 0x22, 0xdf, 0x3b, 0x32, 0x86, 0xa1, 0xef, 0xc6, 0x11, 0x6f, 0x7f, 0xab, 0x39, 0x9e, 0xc5, 0xe7, 0x47, 0x2d, 0x02, 0x2d, 0x1d, 0x9b, 0x86, 0xf7, 0x64, 0x84, 0x92, 0xa6, 
+	0x7d, 0x5d, 0x57, 0x14, 0xe1, 0xa3, 0x63, 0x9d, 0x88, 0xee, 0xd3, 0xe3, 0xba, 0x7c, 0x20, 0x12, 0x01, 0xff, 0xca, 0x79, 0x9c, 0xec, 0x44, 0x43, 0x3f, 0x8a, 0xfc, 0x09, 0x50, 0x47, 0xa8, 0x8f, 
+	0x0e, 0xf6, 0xf4, 0x64, 0xee, 0x86, 0xde, 0x16, 0x62, 0x9b, 0xd9, 0x0e, 0x40, 0x1a, 0x47, 0x01, 0xb7, 0xda, 0x92, 0xb3, 0x7d, 0x7d, 0x3a, 0x2f, 0x9f, 0x1e, 0x3b, 0xde, 0x34, 0x8e, 0x58, 0xb4, 
+	0x98, 0xf2, 0x93, 0x30, 0x1e, 0x4e, 0x9c, 0x88, 0x3d, 0x19, 0x6e, 0x0c, 0x02, 0x18, 0x85, 0x65, 0xe6, 0x7b, 0xa6, 0xeb, 0x98, 0x8f, 0x27, 0xe5, 0xbe, 0x3f, 0x1e, 0xbb, 0xfc, 0xb2, 0x57, 0xd9, 
+	0x6e, 0xc3, 0x18, 0x24, 0x07, 0x48, 0x0e, 0x23, 0x23, 0x8a, 0x91, 0x64, 0x24, 0x33, 0x25, 0x36, 0x34, 0x03, 0x67, 0x1a, 0x9d, 0x6e, 0xb9, 0x3c, 0x62, 0x01, 0x07, 0x3a, 0x02, 0x90, 0x18, 0x3b, 
+	0x61, 0x23, 0xc3, 0x0d, 0x79, 0x9b, 0x9a, 0x47, 0xb1, 0xeb, 0x02, 0x18, 0xe7, 0xde, 0xba, 0x76, 0x5c, 0xcc, 0xc0, 0xb1, 0x38, 0xf4, 0x7b, 0xd0, 0xd8, 0xde, 0x1a, 0xc5, 0x9e, 0x89, 0x7c, 0xb3, 
+	0x94, 0x14, 0xd0, 0x8f, 0x95, 0x03, 0xde, 0x2c, 0xb7, 0xa2, 0xba, 0x6c, 0xd5, 0xeb, 0xe7, 0xbe, 0x37, 0x72, 0xc6, 0x71, 0xc0, 0xd9, 0x27, 0x3e, 0x7c, 0x7f, 0xcd, 0x7a, 0x51, 0x3c, 0x1a, 0xb1, 
+	0x8a, 0xe1, 0x82, 0xda, 0xb0, 0xc8, 0x67, 0x43, 0x0e, 0x2b, 0x1c, 0x44, 0xcc, 0x1f, 0xb1, 0xb1, 0xeb, 0x0f, 0x0d, 0x97, 0x99, 0xbe, 0x17, 0xf1, 0x79, 0xb4, 0x4d, 0xe4, 0xc9, 0x25, 0x3c, 0x61, 
+	0x4a, 0xed, 0xb4, 0x31, 0x8f, 0xba, 0x2e, 0xc7, 0xc7, 0xb3, 0xc5, 0x95, 0x55, 0x79, 0x2b, 0x20, 0xde, 0x6e, 0x0b, 0x76, 0x66, 0x63, 0x17, 0x80, 0x45, 0x1b, 0x82, 0x9e, 0x0b, 0x64, 0x95, 0xb7, 
+	0x33, 0x3e, 0x1c, 0xbb, 0x08, 0xe5, 0x8c, 0x2a, 0xec, 0x0d, 0x82, 0x6d, 0x6f, 0xfd, 0xb9, 0x55, 0xaa, 0xd7, 0xff, 0x65, 0x78, 0x8f, 0x0b, 0x56, 0x03, 0xc1, 0xb3, 0x4b, 0x27, 0xe0, 0x23, 0x7f, 
+	0xce, 0x0e, 0x5b, 0x55, 0x50, 0x9a, 0xc8, 0x66, 0xb7, 0xbf, 0x5e, 0x5d, 0x5c, 0x75, 0xd8, 0xfb, 0xbb, 0x87, 0x2a, 0x5b, 0xf8, 0x31, 0xf3, 0x38, 0xb7, 0x90, 0x68, 0x23, 0x7c, 0x64, 0xd1, 0xcc, 
+	0x31, 0xb9, 0xb6, 0x55, 0xda, 0x3c, 0xe3, 0x0f, 0x45, 0x59, 0xcf, 0x36, 0x60, 0x69, 0x94, 0x7c, 0x59, 0xbd, 0xde, 0x8b, 0x0c, 0xcf, 0x32, 0x02, 0x8b, 0x8d, 0x5c, 0x03, 0x78, 0x45, 0xbd, 0x61, 
+	0x21, 0x01, 0xa9, 0x21, 0x9d, 0xb3, 0x5f, 0x13, 0x78, 0xf8, 0xa9, 0xd7, 0x3b, 0x41, 0x60, 0x2c, 0xd8, 0x10, 0x84, 0x08, 0x98, 0x46, 0x00, 0x0f, 0xe2, 0x8e, 0x80, 0x92, 0x30, 0x1d, 0x71, 0xbe, 
+	0x61, 0x04, 0xcd, 0x13, 0x6a, 0x6a, 0xc0, 0xc3, 0xe7, 0xcb, 0xfb, 0x9b, 0x74, 0x48, 0xbd, 0xfe, 0xe0, 0x39, 0x00, 0x36, 0x61, 0xae, 0x6f, 0x1a, 0xb4, 0xfe, 0x38, 0x28, 0x0a, 0x0c, 0x2f, 0xa4, 
+	0x66, 0x68, 0x80, 0x6d, 0xe0, 0x58, 0x12, 0x0f, 0x2e, 0xf2, 0x43, 0xe4, 0xb8, 0x4e, 0x84, 0x1b, 0x19, 0x17, 0x17, 0xc1, 0xc5, 0x62, 0x87, 0x86, 0x8d, 0x0c, 0x83, 0x5e, 0x10, 0x22, 0x2d, 0x55, 
+	0x29, 0x98, 0x77, 0x30, 0x31, 0x1e, 0xb9, 0x10, 0x49, 0x85, 0xb8, 0xe8, 0x83, 0xd8, 0xaa, 0x6c, 0x14, 0x18, 0x63, 0x7c, 0x12, 0xeb, 0x83, 0x34, 0x62, 0x1f, 0xd0, 0x07, 0x43, 0x34, 0xc2, 0xa4, 
+	0x06, 0x61, 0xc3, 0xaf, 0xdd, 0xfb, 0x7e, 0xf7, 0xf3, 0xa0, 0xf7, 0xa1, 0x73, 0xd1, 0xbd, 0x07, 0x59, 0xe3, 0x72, 0x68, 0x42, 0x84, 0x3d, 0x3f, 0x0e, 0x4c, 0x5e, 0xc1, 0xd1, 0xd5, 0x04, 0x3f, 
+	0x53, 0x30, 0xa6, 0x3f, 0x99, 0x3a, 0xae, 0x42, 0x85, 0xdd, 0xd8, 0xe3, 0x80, 0x6a, 0xa2, 0x72, 0xe0, 0x42, 0x8a, 0xae, 0x3b, 0x23, 0x30, 0xc0, 0xa8, 0x4a, 0x98, 0x2a, 0x51, 0x71, 0xfe, 0xf1, 
+	0xe6, 0xee, 0xea, 0xba, 0x3b, 0xe8, 0xf5, 0x3b, 0xfd, 0x87, 0xde, 0x36, 0xec, 0x0a, 0x34, 0x37, 0x86, 0x0b, 0x00, 0x95, 0xdc, 0xe0, 0x2b, 0x6f, 0xe4, 0x5f, 0xfb, 0x63, 0x81, 0x1e, 0xf1, 0xc3, 
+	0x96, 0x20, 0x96, 0x90, 0xc9, 0x75, 0x2c, 0x5d, 0xde, 0x77, 0xde, 0xdf, 0x74, 0x6f, 0xfb, 0xcf, 0x31, 0x85, 0xe3, 0xb3, 0xa2, 0x5a, 0xc9, 0x14, 0x76, 0x6f, 0x62, 0x4a, 0x20, 0xfa, 0x4b, 0x4c, 
+	0x11, 0x7a, 0xc1, 0x54, 0x49, 0x18, 0x9e, 0xfc, 0x2a, 0xdd, 0x05, 0xfe, 0x18, 0xa6, 0xa9, 0x28, 0xe2, 0x8c, 0x28, 0x32, 0x4c, 0x5b, 0xd2, 0x06, 0xc0, 0x82, 0xfe, 0xf5, 0xbd, 0x6a, 0x4d, 0xb0, 
+	0xd7, 0x75, 0xbc, 0x47, 0x85, 0x0f, 0x3a, 0x55, 0xf3, 0x10, 0x6c, 0x6e, 0x27, 0x8a, 0x02, 0x67, 0x78, 0x2d, 0x75, 0xb5, 0xc2, 0x68, 0xac, 0x5e, 0x65, 0x65, 0x43, 0x2f, 0xb3, 0x8d, 0x80, 0x0d, 
+	0x04, 0x6c, 0x08, 0x40, 0x68, 0x88, 0x03, 0x0f, 0xdb, 0x71, 0xcf, 0x6e, 0x09, 0xf3, 0xf0, 0x89, 0xc3, 0x3e, 0x30, 0x60, 0xd7, 0xcf, 0x7c, 0xb9, 0x35, 0xc3, 0x2a, 0x6c, 0x01, 0xce, 0x9c, 0x90, 
+	0x19, 0x62, 0x23, 0xd4, 0xb2, 0x1b, 0xb7, 0x4a, 0xea, 0x3f, 0xf1, 0x43, 0x10, 0x88, 0x31, 0xb3, 0xe0, 0x1f, 0xf3, 0x87, 0xbf, 0x73, 0x33, 0x0a, 0x85, 0xad, 0x48, 0x6c, 0x40, 0x71, 0x07, 0x80, 
+	0xb4, 0xcb, 0xb1, 0xdc, 0x79, 0x4f, 0xdc, 0xdc, 0x63, 0xf3, 0x51, 0x30, 0x69, 0x33, 0x83, 0xa8, 0x06, 0xa7, 0x83, 0x8d, 0x2d, 0x66, 0xe8, 0x85, 0xa6, 0x3d, 0x66, 0x34, 0xda, 0xe0, 0x40, 0x82, 
+	0x05, 0x9a, 0x7c, 0x6a, 0x78, 0x32, 0xa1, 0xc1, 0x87, 0x0d, 0x3a, 0x31, 0x1c, 0x8f, 0x6c, 0x36, 0x4c, 0x75, 0x27, 0x9d, 0x18, 0xcc, 0x8c, 0x40, 0x15, 0xc0, 0xa4, 0xcd, 0x17, 0x3b, 0x38, 0x09, 
+	0x7c, 0xee, 0xd2, 0xe7, 0xb7, 0x59, 0x15, 0x9b, 0xbf, 0x81, 0xfc, 0xb4, 0x7d, 0x10, 0x09, 0x60, 0x02, 0x70, 0xc4, 0xff, 0xa3, 0x5c, 0x45, 0xfa, 0xa6, 0x01, 0x37, 0x9d, 0x10, 0xb1, 0x4c, 0xb8, 
+	0xe5, 0xc4, 0x93, 0x29, 0x18, 0x2e, 0xdf, 0x88, 0x5e, 0x32, 0xff, 0x25, 0xac, 0xf5, 0x39, 0xc9, 0x49, 0x12, 0xf0, 0x64, 0xc2, 0xbc, 0xdf, 0x66, 0xdb, 0x88, 0x1c, 0xc5, 0x4f, 0xd2, 0x51, 0xb6, 
+	0x48, 0x2a, 0x9c, 0xb4, 0x44, 0xc9, 0x9a, 0x25, 0xf2, 0x83, 0x55, 0x43, 0x8a, 0xe5, 0x40, 0xf4, 0x32, 0xa4, 0xf8, 0x2c, 0xb2, 0xb9, 0x5a, 0x25, 0x21, 0x6e, 0x2d, 0x0e, 0x13, 0x45, 0x4c, 0x46, 
+	0xcb, 0x41, 0xef, 0x41, 0x61, 0x43, 0x7f, 0xc2, 0x49, 0xd3, 0xf8, 0xbc, 0x2e, 0x96, 0x51, 0x18, 0x4a, 0x58, 0x64, 0xb0, 0xf3, 0xe8, 0xa7, 0xc7, 0x1c, 0x40, 0xa2, 0x60, 0xc1, 0x1c, 0x4f, 0xa0, 
+	0x14, 0x26, 0x39, 0xd5, 0xf3, 0x33, 0x1a, 0xa0, 0xd4, 0x5c, 0x98, 0xdf, 0x55, 0xbd, 0x42, 0x9b, 0xde, 0x82, 0x27, 0x8c, 0x43, 0x94, 0x15, 0x6a, 0x54, 0x32, 0x59, 0xe8, 0xb3, 0xdf, 0x63, 0xd0, 
+	0x19, 0xee, 0x19, 0x43, 0xc1, 0xc7, 0xa4, 0xca, 0x3c, 0x7f, 0x26, 0xb9, 0x10, 0xcd, 0xbf, 0x12, 0x9d, 0x42, 0x8f, 0xc9, 0xaa, 0x57, 0x74, 0xa5, 0xe0, 0xeb, 0x00, 0x1a, 0x72, 0xe2, 0xae, 0xc0, 
+	0x6b, 0xb8, 0x53, 0xdb, 0x60, 0xf0, 0xe4, 0x61, 0x4c, 0x95, 0x1d, 0x4a, 0x7b, 0xfc, 0xec, 0xba, 0x7b, 0x7b, 0x91, 0xec, 0x19, 0x84, 0xba, 0x04, 0x83, 0x4d, 0x5d, 0xbd, 0xfb, 0xf3, 0x41, 0xe7, 
+	0xfa, 0xee, 0x43, 0x47, 0x58, 0x8b, 0x8f, 0xb7, 0xdd, 0xc1, 0xcd, 0xd5, 0xed, 0x43, 0x6f, 0x90, 0x74, 0xe0, 0x38, 0xf0, 0xdd, 0xb0, 0x25, 0xb8, 0xe6, 0x82, 0x7d, 0x20, 0x5f, 0x8c, 0xee, 0xaf, 
+	0x5e, 0xbf, 0xf0, 0x19, 0x79, 0x43, 0x36, 0xf3, 0x03, 0xf0, 0x9c, 0x36, 0x38, 0xbb, 0x09, 0x72, 0x6b, 0x1b, 0xd3, 0x29, 0x04, 0x24, 0x1c, 0x16, 0x60, 0x81, 0xd6, 0x60, 0x02, 0x0e, 0x15, 0xfd, 
+	0x89, 0x10, 0x1a, 0xf8, 0xda, 0x44, 0xf8, 0xe1, 0x22, 0x8c, 0xf8, 0x44, 0x83, 0xbe, 0xbe, 0x0d, 0x3b, 0xcf, 0x06, 0xbf, 0xe9, 0xf2, 0x50, 0xca, 0x0f, 0xa5, 0x09, 0x5c, 0x01, 0xa9, 0x36, 0xc6, 
+	0x11, 0x60, 0x2c, 0x78, 0x58, 0x0f, 0xf9, 0x18, 0x83, 0x04, 0x90, 0x2d, 0xc0, 0x2a, 0x91, 0x83, 0x58, 0x41, 0x06, 0x2e, 0x6c, 0x21, 0x0c, 0xb4, 0x60, 0x36, 0x11, 0x73, 0x3c, 0x25, 0x31, 0x4f, 
+	0xea, 0xa1, 0xce, 0x6f, 0x2f, 0xdf, 0x77, 0x21, 0x38, 0x3b, 0x83, 0x78, 0x18, 0x04, 0xd1, 0x0f, 0x1c, 0xc3, 0x83, 0x28, 0x28, 0xfc, 0x57, 0x4f, 0x78, 0xab, 0xf0, 0xb2, 0x2a, 0x3d, 0xe0, 0x95, 
+	0xb0, 0x55, 0x26, 0xc4, 0xcc, 0xd2, 0x6b, 0x61, 0x8c, 0x91, 0x36, 0x1d, 0x9f, 0x30, 0x9d, 0x6d, 0x33, 0x61, 0x5e, 0xda, 0x4c, 0x48, 0x29, 0x62, 0xc6, 0x50, 0x2a, 0x4a, 0xe7, 0xfe, 0xbe, 0xf3, 
+	0x65, 0x70, 0xf6, 0x70, 0x79, 0xd9, 0xbd, 0xcf, 0xd8, 0x2b, 0xa9, 0x39, 0xc6, 0xb0, 0x2a, 0x03, 0x81, 0x64, 0x61, 0xa8, 0xe3, 0xc2, 0x88, 0x0c, 0xea, 0x54, 0xc4, 0x60, 0xd7, 0xc5, 0x97, 0xdb, 
+	0xce, 0xcd, 0xd5, 0xf9, 0xe0, 0xe2, 0xbe, 0xf3, 0x49, 0x81, 0x3f, 0x65, 0x94, 0xe2, 0xce, 0x77, 0x3c, 0x34, 0xfb, 0x60, 0x1f, 0x5b, 0x62, 0xc4, 0xe5, 0xf5, 0xc7, 0x4e, 0xbf, 0x2a, 0x22, 0x42, 
+	0xb2, 0x9b, 0xfa, 0xf6, 0x33, 0x34, 0x9c, 0xaf, 0xa1, 0xc1, 0xe3, 0x33, 0xf6, 0x00, 0xa8, 0x0f, 0x85, 0xd6, 0x29, 0xc1, 0x48, 0x30, 0xb6, 0xfd, 0x3a, 0xea, 0xc0, 0x28, 0xef, 0x89, 0x11, 0x0f, 
+	0xb7, 0xbd, 0xab, 0xf7, 0xb7, 0xdd, 0x8b, 0xc1, 0xd9, 0x97, 0x7e, 0x17, 0xb6, 0x64, 0x10, 0x17, 0x88, 0x44, 0x03, 0x4b, 0x73, 0x86, 0xa4, 0xa5, 0xfd, 0xfb, 0xab, 0xce, 0xed, 0xfb, 0xeb, 0x6e, 
+	0x8f, 0xa0, 0x32, 0xab, 0x02, 0xe0, 0xe9, 0x52, 0x0b, 0x89, 0x91, 0x91, 0x07, 0x5d, 0x83, 0xc8, 0x25, 0x42, 0xe5, 0x50, 0x2b, 0x6f, 0x60, 0x28, 0x03, 0x7a, 0x28, 0xc3, 0x23, 0xec, 0xcf, 0x04, 
+	0x54, 0x99, 0x01, 0xc2, 0xd0, 0x88, 0xe8, 0x08, 0xbc, 0x30, 0xc4, 0xb8, 0x6a, 0x0c, 0x38, 0xe5, 0x7c, 0x0c, 0xd6, 0x17, 0xfd, 0x52, 0x6f, 0x69, 0xc8, 0x50, 0xa2, 0xc9, 0xc7, 0x61, 0xb9, 0xd9, 
+	0x5e, 0x12, 0x8a, 0x11, 0x1a, 0x88, 0x17, 0xb7, 0xc8, 0x55, 0x19, 0x30, 0x87, 0xe7, 0x43, 0x28, 0x19, 0x07, 0x90, 0x07, 0x44, 0x2e, 0x6c, 0x9c, 0x78, 0x3a, 0xf5, 0x83, 0x48, 0x6a, 0x3f, 0xd8, 
+	0x99, 0x51, 0x34, 0x43, 0x28, 0x91, 0x26, 0xf0, 0x40, 0xdb, 0x5a, 0xe3, 0xe3, 0x10, 0xda, 0x87, 0x5f, 0x81, 0xf0, 0x74, 0x92, 0xc3, 0x9c, 0x97, 0x53, 0x2c, 0x00, 0x2c, 0xfc, 0x06, 0x8b, 0x9b, 
+	0x8a, 0x6b, 0xd9, 0xbb, 0xfd, 0x2d, 0xce, 0xad, 0xc9, 0xa2, 0xbf, 0xcd, 0xb9, 0x45, 0xc2, 0xb9, 0x01, 0x80, 0xf4, 0x6f, 0x2f, 0x72, 0x6f, 0x82, 0x02, 0xc5, 0x4b, 0x68, 0x4c, 0xa6, 0x10, 0x21, 
+	0x35, 0x2f, 0x50, 0x3e, 0x1b, 0xbc, 0x9e, 0x94, 0x60, 0xf3, 0xa2, 0x02, 0x4f, 0xd5, 0xc8, 0xdc, 0xd6, 0x66, 0xdf, 0x16, 0xf3, 0xb6, 0xf4, 0x7e, 0x05, 0x05, 0x58, 0xef, 0x00, 0x11, 0x20, 0xe7, 
+	0xfe, 0x72, 0x16, 0x0b, 0x7b, 0xaf, 0x26, 0xc6, 0x98, 0x5f, 0xe1, 0x4e, 0x02, 0x5d, 0xae, 0xc4, 0xb8, 0x2d, 0x27, 0x7c, 0x62, 0xc1, 0x5e, 0xad, 0xb2, 0x39, 0x24, 0x32, 0xb0, 0xb5, 0xaa, 0xcc, 
+	0x4e, 0x2d, 0xd5, 0x4c, 0x58, 0xa8, 0xef, 0xdf, 0xa1, 0x31, 0x6f, 0xab, 0xb6, 0x56, 0xf9, 0x50, 0x9c, 0x42, 0x7a, 0x95, 0x1b, 0x0c, 0x73, 0xc0, 0xe2, 0xa2, 0xae, 0x44, 0x0e, 0x78, 0xd2, 0x19, 
+	0x87, 0x44, 0xcd, 0x7b, 0x1b, 0x81, 0xbd, 0xe5, 0x8a, 0x61, 0xe1, 0xdd, 0x44, 0xb3, 0xe3, 0xc1, 0x3a, 0x81, 0x57, 0x44, 0x03, 0x0c, 0xb9, 0x6c, 0x10, 0x69, 0x92, 0x04, 0xb9, 0x67, 0x84, 0xe6, 
+	0xb3, 0xed, 0x52, 0xb2, 0x89, 0x52, 0x4f, 0x2a, 0xf7, 0x10, 0xb8, 0x52, 0x26, 0xe9, 0x32, 0x80, 0xef, 0xa7, 0xa4, 0x9d, 0xf6, 0x7f, 0xf7, 0x73, 0xff, 0xe1, 0xbe, 0xab, 0x2b, 0x5f, 0x04, 0x69, 
+	0x76, 0xd3, 0x92, 0x58, 0x64, 0xdf, 0xa0, 0x79, 0x91, 0x31, 0x70, 0x6a, 0x30, 0x80, 0x55, 0x25, 0x15, 0x92, 0xb7, 0x5b, 0x3f, 0xe2, 0xc2, 0x55, 0xc5, 0x9e, 0xeb, 0x3c, 0x8a, 0xd8, 0xc2, 0x83, 
+	0xc5, 0xa0, 0x14, 0x15, 0x97, 0xd4, 0x9f, 0xf2, 0x80, 0x96, 0xa5, 0x9a, 0xf2, 0x6d, 0x1b, 0x4f, 0xc0, 0x1c, 0xb8, 0xb4, 0x39, 0xec, 0x52, 0x10, 0xcd, 0x28, 0xe4, 0x91, 0x8a, 0x44, 0xc4, 0x5a, 
+	0xee, 0x09, 0x76, 0x93, 0xc5, 0xc6, 0xc0, 0xaa, 0xa1, 0xd5, 0xc9, 0x16, 0x3a, 0x7c, 0x86, 0x9b, 0xf5, 0x13, 0x56, 0x15, 0xaa, 0xac, 0x56, 0x68, 0xfe, 0x40, 0x55, 0x04, 0x84, 0xaf, 0x69, 0xfb, 
+	0xbb, 0xf3, 0x55, 0x43, 0xb4, 0xfd, 0xda, 0x62, 0xc5, 0x18, 0x15, 0x26, 0xf5, 0x6d, 0x1e, 0x52, 0xbe, 0x2d, 0xa2, 0xff, 0x90, 0x09, 0x4b, 0xf0, 0x47, 0x0c, 0x89, 0xaf, 0xa5, 0x31, 0x06, 0x3c, 
+	0x83, 0xc1, 0x80, 0xb6, 0x99, 0xbd, 0x20, 0x7e, 0x2d, 0x3e, 0x32, 0x62, 0x37, 0x0a, 0x25, 0x77, 0xe8, 0xbe, 0x25, 0x37, 0xb0, 0xb8, 0x49, 0x16, 0xe1, 0x24, 0xe2, 0x4b, 0x84, 0xfc, 0xe9, 0xbe, 
+	0x73, 0x37, 0xe8, 0xcb, 0xcc, 0xe2, 0xba, 0x73, 0x03, 0x2f, 0x1f, 0x07, 0xdd, 0x8b, 0xf7, 0x5d, 0x65, 0xb8, 0x5f, 0x32, 0xbe, 0xf7, 0xd7, 0xc7, 0x43, 0x6c, 0x32, 0xb8, 0xbc, 0xba, 0xee, 0x77, 
+	0xef, 0x45, 0xfb, 0x6d, 0xb7, 0x73, 0xdf, 0xed, 0xf5, 0x55, 0x9c, 0x89, 0xc3, 0x69, 0x9b, 0xe0, 0x6e, 0xc4, 0xb1, 0xba, 0x00, 0xbb, 0x7f, 0x7f, 0xd6, 0x11, 0xdb, 0x23, 0xdf, 0x04, 0x32, 0x5f, 
+	0xe1, 0x8e, 0xb2, 0x5b, 0x4b, 0x88, 0xf8, 0xb9, 0xa0, 0x01, 0x70, 0xa0, 0x9b, 0xbc, 0x44, 0x93, 0xd2, 0x6a, 0x4a, 0x47, 0xf9, 0x55, 0xaf, 0xe2, 0x7f, 0x30, 0x25, 0x7d, 0xe0, 0xcf, 0xac, 0x6a, 
+	0xab, 0x47, 0xc6, 0x74, 0xd5, 0x5e, 0x68, 0x85, 0x17, 0xf6, 0x1b, 0xf8, 0x55, 0x89, 0x34, 0xeb, 0x7b, 0x25, 0x4a, 0x00, 0x6e, 0xee, 0xef, 0x67, 0x1f, 0xd5, 0x2b, 0xd3, 0xd7, 0xb4, 0xca, 0x47, 
+	0x89, 0xf7, 0x20, 0x89, 0xca, 0xd7, 0x05, 0xd1, 0x3f, 0xda, 0xe8, 0x76, 0x7a, 0xe8, 0xbe, 0x6c, 0x08, 0xe3, 0xc2, 0x99, 0x31, 0x55, 0x11, 0x2d, 0x3a, 0x0d, 0x13, 0x22, 0x2d, 0x88, 0xe1, 0x86, 
+	0x0b, 0x66, 0xa3, 0x9d, 0x80, 0x58, 0x4f, 0xf8, 0x3a, 0x0a, 0xf4, 0x06, 0xc2, 0x8b, 0xf1, 0x60, 0x60, 0x61, 0x36, 0x95, 0xd4, 0xa4, 0x00, 0x21, 0x68, 0xa4, 0x30, 0x2b, 0x39, 0x8f, 0x5c, 0x30, 
+	0x74, 0xe7, 0x2e, 0x37, 0x82, 0x4b, 0xc4, 0x94, 0x58, 0x3a, 0xb9, 0x2d, 0xc9, 0xae, 0x89, 0xc7, 0xef, 0x60, 0xcd, 0x54, 0x6a, 0x8c, 0xf0, 0x64, 0x8a, 0x2b, 0xac, 0x52, 0xa1, 0xee, 0xd3, 0xd3, 
+	0xe6, 0xde, 0xf6, 0x4f, 0xfa, 0x7c, 0x34, 0xda, 0xae, 0x03, 0xeb, 0x5a, 0x35, 0xed, 0x68, 0x1c, 0xac, 0xe9, 0x38, 0x5c, 0xd3, 0xae, 0x67, 0xdb, 0xd1, 0xbb, 0x64, 0x66, 0xad, 0xc8, 0xfc, 0xfa, 
+	0xfa, 0xe3, 0xbd, 0x8c, 0xf2, 0x06, 0x67, 0x57, 0x7d, 0xf6, 0x3d, 0xd3, 0x7c, 0xd1, 0xbd, 0xeb, 0x7f, 0xa0, 0x56, 0xaa, 0x17, 0xe5, 0x59, 0x85, 0x3c, 0xe5, 0x02, 0x8c, 0xab, 0x87, 0x9e, 0x29, 
+	0xac, 0x4c, 0x41, 0x3b, 0xa7, 0x36, 0x31, 0xf9, 0xa1, 0xdb, 0xb9, 0x6b, 0x1c, 0x7c, 0x9d, 0xce, 0x80, 0xe0, 0xdf, 0xd2, 0x22, 0x14, 0x15, 0x25, 0xdb, 0x69, 0xb7, 0x9d, 0xef, 0x16, 0xc5, 0xc8, 
+	0xfc, 0x34, 0x1f, 0x71, 0x92, 0x8e, 0x2c, 0x6f, 0xf6, 0x61, 0x32, 0x72, 0x60, 0x32, 0x21, 0x46, 0x05, 0x83, 0x48, 0x0f, 0xda, 0xd0, 0x25, 0x89, 0xde, 0x7a, 0x43, 0xd7, 0x75, 0x8d, 0x6a, 0x7c, 
+	0x22, 0xae, 0x82, 0xf8, 0x3e, 0xf4, 0x41, 0xe9, 0x93, 0xe8, 0xa5, 0xd8, 0x3e, 0x20, 0x07, 0x71, 0x02, 0x56, 0x0d, 0xcb, 0xc9, 0xcb, 0xdd, 0x60, 0xae, 0x3d, 0x48, 0x93, 0xb9, 0x95, 0xd3, 0x85, 
+	0x3b, 0x30, 0xfd, 0x2e, 0x45, 0x3f, 0x60, 0x56, 0x99, 0x6b, 0x04, 0x63, 0xf8, 0x34, 0xcd, 0x78, 0x12, 0xbb, 0x06, 0xc2, 0x0a, 0x75, 0xd3, 0xb6, 0x32, 0x6d, 0x03, 0x19, 0x74, 0x9e, 0x24, 0x51, 
+	0x69, 0xb2, 0xdb, 0xf6, 0x74, 0xfa, 0x41, 0x21, 0x2f, 0x0f, 0x18, 0x4c, 0x5d, 0xc3, 0x44, 0x0a, 0x75, 0x9a, 0xb9, 0x6b, 0x40, 0x36, 0x41, 0xaa, 0x8a, 0xba, 0x1c, 0x62, 0xc5, 0xdb, 0x00, 0x9d, 
+	0xf6, 0xa7, 0x0e, 0xe4, 0x1d, 0x7e, 0x9c, 0xf8, 0x3d, 0x08, 0x1a, 0x9e, 0x1c, 0x3f, 0x0e, 0x21, 0xd6, 0xb2, 0xb8, 0xe9, 0x5b, 0x40, 0x14, 0x8d, 0xaa, 0x4a, 0x58, 0x40, 0x25, 0xa1, 0x9d, 0x28, 
+	0xe4, 0xee, 0x88, 0xd2, 0x11, 0x50, 0x68, 0xf0, 0x1d, 0x2e, 0x0b, 0x62, 0x2f, 0x04, 0xbb, 0xdb, 0xe3, 0x9c, 0x56, 0xfa, 0x43, 0xbf, 0x7f, 0xd7, 0xf5, 0x10, 0xc9, 0xa5, 0x98, 0xd8, 0x53, 0x45, 
+	0x04, 0x6d, 0x4b, 0xec, 0x9a, 0xf5, 0xbc, 0x11, 0x57, 0x48, 0xcc, 0xe0, 0xb5, 0x90, 0x2e, 0xd5, 0x84, 0xf5, 0xfc, 0x66, 0x36, 0x24, 0xef, 0x10, 0x3f, 0xbb, 0x16, 0xc5, 0x94, 0x43, 0xae, 0x18, 
+	0x04, 0x8a, 0xfb, 0x18, 0x4b, 0xf2, 0x00, 0x22, 0x69, 0xf6, 0xc8, 0xf9, 0x34, 0x84, 0xc4, 0x15, 0xba, 0x28, 0x11, 0x1b, 0x43, 0xfc, 0x13, 0x46, 0x80, 0x0b, 0xa5, 0x23, 0x05, 0x18, 0x51, 0x88, 
+	0xf8, 0x18, 0xa2, 0xa3, 0x44, 0x17, 0x49, 0x21, 0x01, 0x39, 0x54, 0x2c, 0x5f, 0xf5, 0x3e, 0x75, 0xee, 0xb0, 0xa6, 0x1a, 0x12, 0xa0, 0x2f, 0x22, 0x03, 0x86, 0x85, 0x64, 0x6d, 0x0b, 0x4b, 0xae, 
+	0x83, 0x47, 0xbe, 0x10, 0x88, 0x52, 0xd5, 0x48, 0x54, 0xf7, 0x7d, 0xe0, 0xcf, 0x1e, 0x5a, 0xcd, 0x0a, 0xaa, 0x42, 0x55, 0x54, 0x68, 0x93, 0xc8, 0x86, 0xde, 0x20, 0xa4, 0x81, 0x2e, 0x0d, 0xb8, 
+	0x1c, 0x47, 0x76, 0x12, 0xdb, 0x60, 0x5b, 0x5b, 0x14, 0xae, 0x04, 0xff, 0x19, 0x98, 0x5f, 0xb2, 0x2f, 0x47, 0xac, 0xa1, 0x37, 0xf7, 0xd0, 0x8a, 0xd8, 0x0e, 0xa4, 0xc9, 0x04, 0x7d, 0x2c, 0xe7, 
+	0xa1, 0x97, 0x9d, 0x13, 0xd6, 0x6c, 0x67, 0x4b, 0x60, 0x4b, 0x02, 0x47, 0x28, 0x59, 0x60, 0xd2, 0x20, 0x1e, 0x20, 0x52, 0x57, 0x55, 0x9c, 0xea, 0xf5, 0x7b, 0x6a, 0x08, 0x85, 0x68, 0xe2, 0xc9, 
+	0x10, 0xc4, 0x0b, 0x8a, 0xa3, 0xf4, 0x0a, 0xdc, 0xaf, 0x15, 0xa2, 0x52, 0x64, 0x57, 0xb8, 0xca, 0xc0, 0xd0, 0xd5, 0x1a, 0xcc, 0x91, 0xea, 0x68, 0xd0, 0x26, 0x04, 0x95, 0x1d, 0x1a, 0x56, 0xa6, 
+	0xe0, 0x7a, 0xc1, 0x13, 0xb5, 0xaa, 0xb0, 0x30, 0x30, 0xab, 0xf8, 0x8b, 0x08, 0x53, 0xc2, 0x92, 0xef, 0xc7, 0xac, 0x89, 0xa1, 0x20, 0xbd, 0x7f, 0x05, 0x5f, 0x70, 0x7a, 0x7a, 0xca, 0x0e, 0x81, 
+	0xd5, 0x37, 0xa0, 0x22, 0xf3, 0xfd, 0xe6, 0xde, 0xde, 0xbe, 0x91, 0x0a, 0xb1, 0xd6, 0x90, 0x9c, 0x4f, 0x7c, 0x3a, 0x07, 0x90, 0x63, 0x7e, 0x62, 0x68, 0x0c, 0x65, 0x17, 0x68, 0xbf, 0x90, 0x30, 
+	0x76, 0x36, 0x7e, 0x93, 0xad, 0x0e, 0x34, 0x34, 0xbf, 0xeb, 0x0a, 0x06, 0x15, 0x90, 0xde, 0x0a, 0xca, 0x9b, 0xac, 0x6e, 0x81, 0x65, 0x81, 0x73, 0x3b, 0x9d, 0x02, 0x55, 0x23, 0x03, 0xd2, 0x16, 
+	0x3c, 0x09, 0xb2, 0x28, 0xa6, 0xdd, 0x2a, 0x61, 0x41, 0xb3, 0xc0, 0xe8, 0x6e, 0x82, 0x29, 0xc7, 0x51, 0x09, 0x5a, 0xc5, 0x4a, 0x01, 0xac, 0x16, 0xc6, 0x43, 0x43, 0x2c, 0x64, 0xb3, 0x9a, 0x1f, 
+	0x83, 0xf3, 0xab, 0x45, 0x14, 0x8d, 0xa2, 0x1c, 0x2a, 0x55, 0xc5, 0x81, 0x39, 0x12, 0x29, 0xd3, 0xf4, 0x44, 0xec, 0x54, 0xca, 0xc2, 0xd9, 0xdd, 0x45, 0x69, 0x50, 0x23, 0xca, 0x07, 0x3a, 0x50, 
+	0x70, 0xad, 0x91, 0xf8, 0x69, 0x4b, 0x72, 0x7d, 0x98, 0xd1, 0x63, 0xa7, 0x6b, 0x28, 0x0d, 0x67, 0x4e, 0x64, 0xda, 0x15, 0x1c, 0x8c, 0x2b, 0xd5, 0x22, 0x4e, 0x69, 0x2e, 0xd3, 0x80, 0x58, 0x4f, 
+	0x3f, 0x82, 0x2c, 0x92, 0x5d, 0xa7, 0xe6, 0x06, 0x8b, 0xba, 0x6b, 0xb8, 0x73, 0xaa, 0x40, 0x31, 0xce, 0x05, 0xe9, 0xba, 0x2f, 0x78, 0x2b, 0x41, 0x03, 0x28, 0x74, 0x1b, 0x89, 0xc0, 0x4f, 0x3a, 
+	0x27, 0x04, 0x93, 0xfc, 0xd8, 0x56, 0x13, 0x34, 0x68, 0x82, 0x73, 0x7f, 0x8a, 0x05, 0x1c, 0x7f, 0x92, 0x33, 0x89, 0x62, 0x45, 0x24, 0x39, 0xc4, 0x66, 0x58, 0x60, 0x5d, 0xac, 0x87, 0x64, 0xb0, 
+	0x60, 0x92, 0x0a, 0x8c, 0xa6, 0x54, 0x2f, 0x19, 0xb9, 0x0c, 0x0f, 0x98, 0x6c, 0x14, 0x79, 0x58, 0x45, 0xfb, 0x0f, 0x45, 0x7f, 0xb3, 0x40, 0x3f, 0xf8, 0x6b, 0xd7, 0xc1, 0xa4, 0xd7, 0x43, 0x93, 
+	0x15, 0x2a, 0x5b, 0x3e, 0x31, 0x16, 0x64, 0x90, 0x5c, 0x03, 0x82, 0x98, 0xcd, 0x0c, 0x9d, 0x9e, 0xe0, 0xec, 0x05, 0x06, 0x46, 0x18, 0x7b, 0xe0, 0xa0, 0x47, 0x32, 0xb7, 0xf0, 0x71, 0x8c, 0xa2, 
+	0x7d, 0xdc, 0xdd, 0x05, 0x50, 0xe0, 0xee, 0xab, 0x0f, 0x48, 0x50, 0x0f, 0xe0, 0x31, 0x54, 0xf8, 0x72, 0x14, 0xcb, 0x70, 0xfc, 0x08, 0x3b, 0x72, 0xb8, 0x7f, 0x90, 0xda, 0xc9, 0x26, 0x54, 0x99, 
+	0x93, 0x93, 0x54, 0x5f, 0x7e, 0x51, 0x8f, 0x47, 0x04, 0x0d, 0x86, 0x06, 0x43, 0x7e, 0x88, 0xb1, 0x06, 0x36, 0xcc, 0xd6, 0x3a, 0x04, 0xe3, 0xa6, 0x1a, 0x66, 0xd0, 0xb0, 0xdf, 0x68, 0x92, 0x2b, 
+	0xf8, 0x48, 0xc9, 0xbf, 0x3c, 0x94, 0xc3, 0x83, 0x47, 0xbe, 0x65, 0x7a, 0xa3, 0xf1, 0xc0, 0x94, 0xf9, 0x2c, 0x6e, 0x71, 0xa5, 0xa9, 0xa9, 0x9d, 0xe9, 0x41, 0xd8, 0xdb, 0x83, 0x40, 0xb0, 0x92, 
+	0xd8, 0x95, 0x37, 0xeb, 0x3d, 0x7d, 0x36, 0xd1, 0xa4, 0x2a, 0x88, 0x4c, 0xd5, 0x72, 0x59, 0x8d, 0xdc, 0xe3, 0x76, 0xa1, 0xef, 0x83, 0x0c, 0x63, 0x64, 0x0a, 0x7b, 0x02, 0x1c, 0xc7, 0x1e, 0x08, 
+	0xc8, 0xf1, 0xc8, 0x03, 0xd0, 0x12, 0x29, 0x7c, 0xe8, 0x41, 0xc1, 0x37, 0x89, 0x6a, 0x96, 0x42, 0x5a, 0xb2, 0x57, 0xf5, 0x26, 0x68, 0x7f, 0x28, 0x5b, 0xb4, 0x26, 0x50, 0xc5, 0x38, 0xbc, 0xc0, 
+	0x19, 0xa8, 0xa7, 0x67, 0x55, 0x96, 0x8a, 0x61, 0x5f, 0xe9, 0x40, 0xf1, 0xf0, 0x5d, 0x95, 0x1d, 0xec, 0xc3, 0x27, 0x45, 0xfb, 0x0c, 0x62, 0xb6, 0x43, 0x4a, 0x33, 0x6c, 0x7a, 0xc8, 0xbb, 0xb9, 
+	0x5f, 0x58, 0x03, 0x16, 0x8b, 0x22, 0x7c, 0x8c, 0x25, 0xeb, 0xf5, 0x32, 0xba, 0xc8, 0xf2, 0x56, 0x69, 0x8d, 0x37, 0xcc, 0x86, 0x72, 0x1f, 0xa8, 0xc4, 0x74, 0xe3, 0x8b, 0x43, 0x0e, 0x91, 0xef, 
+	0x0f, 0xe3, 0x4c, 0x61, 0xf2, 0x99, 0xe5, 0xd8, 0x2a, 0xbd, 0x86, 0xab, 0x77, 0xc0, 0xd1, 0xbb, 0x9f, 0x81, 0xa3, 0x3d, 0xf8, 0x3c, 0xa4, 0xda, 0xc2, 0x9c, 0x98, 0x81, 0x19, 0x17, 0xf4, 0xa0, 
+	0xab, 0xff, 0x91, 0x00, 0xc1, 0x0c, 0x64, 0xa1, 0xe5, 0x9b, 0x8f, 0xfd, 0xdb, 0xf2, 0x0a, 0xa2, 0xcf, 0xe2, 0x28, 0xca, 0x10, 0x1d, 0x41, 0x62, 0x6d, 0xf9, 0x33, 0xef, 0x1f, 0x20, 0xfd, 0xe0, 
+	0x00, 0xc8, 0xde, 0xdf, 0x4c, 0x3a, 0x4e, 0x4f, 0x94, 0x64, 0xa8, 0x3f, 0x7b, 0x58, 0x4d, 0xfd, 0xbf, 0x39, 0xa0, 0x86, 0xb5, 0xf9, 0xc7, 0x88, 0x7e, 0x07, 0x04, 0x1f, 0xa0, 0xbc, 0xe1, 0x1f, 
+	0x32, 0x20, 0x48, 0x4c, 0x67, 0x4c, 0x49, 0xfc, 0x77, 0xf7, 0xcb, 0x19, 0x91, 0x88, 0xfb, 0xf8, 0x1f, 0xfb, 0xc1, 0x54, 0xed, 0x5e, 0x9e, 0x71, 0x29, 0x59, 0x84, 0x58, 0xc8, 0x1a, 0xb8, 0x06, 
+	0xda, 0x12, 0xdc, 0x67, 0x03, 0x34, 0x9a, 0x83, 0x26, 0xa8, 0xaa, 0xb6, 0xdf, 0xde, 0xc2, 0x18, 0x77, 0x70, 0xd6, 0xe9, 0x9f, 0x7f, 0x40, 0xef, 0x7f, 0xd0, 0x6c, 0xec, 0x81, 0xed, 0xd9, 0xa2, 
+	0x66, 0x3c, 0xba, 0xc0, 0x72, 0xf2, 0xaf, 0x32, 0x80, 0xca, 0xa5, 0xc9, 0xe9, 0xb8, 0x9d, 0xd6, 0x76, 0x3b, 0x07, 0x7f, 0xbe, 0x22, 0xe0, 0x4a, 0xc1, 0x33, 0xc0, 0x77, 0x99, 0xe8, 0x3e, 0x97, 
+	0x5e, 0x5d, 0xba, 0x71, 0x68, 0xdf, 0x53, 0x39, 0x54, 0x18, 0xad, 0xe7, 0x92, 0xf8, 0x1c, 0xa9, 0xd5, 0xdc, 0xeb, 0x79, 0xfa, 0x2a, 0xe6, 0x42, 0xef, 0xb3, 0x62, 0xf6, 0xac, 0xe6, 0xe0, 0x34, 
+	0xff, 0x89, 0x0d, 0x58, 0x6e, 0x73, 0x0e, 0x6b, 0x69, 0x2e, 0xf0, 0xd7, 0xbc, 0x81, 0x4f, 0xf8, 0x6b, 0xde, 0xc4, 0x27, 0xfc, 0x35, 0x6f, 0xe1, 0x53, 0x0b, 0x56, 0x58, 0x1c, 0x4b, 0x9e, 0x71, 
+	0xd3, 0xc0, 0x1a, 0xdb, 0x1f, 0x30, 0x58, 0x95, 0x71, 0x20, 0x51, 0x5a, 0x60, 0xe1, 0x6d, 0x14, 0xbb, 0x62, 0xc7, 0x39, 0xd1, 0x5b, 0x08, 0x03, 0x31, 0x99, 0x86, 0xa0, 0x1a, 0xc3, 0xf4, 0xf4, 
+	0x00, 0x24, 0x52, 0x4c, 0x61, 0xdc, 0x38, 0xf5, 0xc3, 0xd0, 0x19, 0xba, 0x78, 0x9b, 0x41, 0x9e, 0xaf, 0x80, 0xc1, 0x0d, 0x01, 0x15, 0xa3, 0xb5, 0x35, 0x82, 0xa1, 0x03, 0x46, 0x30, 0x58, 0x88, 
+	0xd9, 0x64, 0xc9, 0x2e, 0xcf, 0x19, 0x38, 0xbc, 0x54, 0xea, 0xb5, 0x03, 0xa0, 0x73, 0x49, 0xb4, 0xaa, 0x3e, 0x92, 0x88, 0xef, 0x6b, 0x0e, 0xc5, 0x4e, 0x6b, 0x57, 0xa7, 0x2c, 0x75, 0x0e, 0xae, 
+	0x91, 0x3d, 0x0f, 0x28, 0xd2, 0xd9, 0x85, 0xde, 0xde, 0x84, 0xb1, 0x25, 0x30, 0x36, 0x36, 0x62, 0xdc, 0x13, 0x18, 0x1b, 0x1b, 0x31, 0x1e, 0x08, 0x8c, 0xcd, 0x8d, 0x18, 0xdf, 0x09, 0x8c, 0xcd, 
+	0x8d, 0x18, 0x7f, 0x7e, 0x29, 0xc6, 0x86, 0xfe, 0x52, 0x94, 0x8d, 0x66, 0xc2, 0xf7, 0x06, 0xc0, 0xd6, 0x4b, 0xf9, 0x6e, 0xec, 0x0b, 0x94, 0xad, 0x8d, 0x28, 0x85, 0x84, 0x16, 0xad, 0x02, 0xca, 
+	0xf3, 0x3c, 0xa4, 0x5c, 0xec, 0x24, 0xa0, 0xd8, 0x00, 0xdd, 0x78, 0x15, 0x74, 0xf3, 0x55, 0xd0, 0xad, 0x57, 0x41, 0xef, 0xbd, 0x0a, 0x7a, 0x7f, 0x2d, 0xb4, 0xd8, 0x37, 0x10, 0x99, 0x1e, 0x2c, 
+	0x57, 0x7c, 0xfa, 0x60, 0x79, 0xee, 0x9c, 0x39, 0x77, 0xc1, 0x17, 0x82, 0x1d, 0x58, 0x34, 0x84, 0x37, 0x99, 0x37, 0x76, 0x77, 0xdb, 0xf0, 0x06, 0xbf, 0x65, 0xe6, 0xda, 0x94, 0x47, 0x2d, 0x4b, 
+	0x06, 0x37, 0x01, 0x88, 0xd7, 0x41, 0xec, 0xea, 0x68, 0x91, 0x4b, 0xa9, 0x05, 0x9a, 0x37, 0x6a, 0x00, 0x8e, 0xb3, 0x89, 0x4f, 0x98, 0xcd, 0x6d, 0x66, 0x5f, 0x55, 0x37, 0x35, 0x27, 0xbd, 0xf0, 
+	0x21, 0x8b, 0x56, 0xcb, 0x3c, 0xf4, 0xc4, 0x19, 0xac, 0xe2, 0x02, 0x46, 0xe1, 0x90, 0x26, 0x71, 0x53, 0xaf, 0xe7, 0x4f, 0x8b, 0xe7, 0x0d, 0x88, 0xdb, 0xcb, 0xf0, 0xdf, 0x2e, 0xf2, 0xab, 0x1e, 
+	0xe7, 0xcd, 0xb4, 0xb5, 0x29, 0xea, 0x6a, 0x94, 0x3d, 0x02, 0xf4, 0x09, 0x0c, 0x51, 0xc9, 0xe4, 0x02, 0x5f, 0x17, 0xc9, 0xeb, 0x1c, 0xe5, 0x32, 0x6f, 0x26, 0xbd, 0xf8, 0x8a, 0xdb, 0x46, 0xbc, 
+	0x5b, 0x78, 0xae, 0x00, 0x30, 0x35, 0x27, 0x41, 0x60, 0x2d, 0xb0, 0x69, 0x01, 0x4d, 0x29, 0x92, 0x09, 0x5d, 0xd1, 0x69, 0x68, 0xf5, 0x1b, 0x23, 0xb2, 0xb5, 0xf0, 0x8f, 0x20, 0xaa, 0x58, 0xf3, 
+	0x1d, 0x6b, 0xbe, 0x6b, 0x2d, 0x76, 0xac, 0x05, 0x1a, 0x77, 0x40, 0x04, 0xc9, 0x3f, 0x02, 0xe2, 0xcb, 0x22, 0xf3, 0x42, 0x79, 0x5e, 0x10, 0xd9, 0x3e, 0x4e, 0x05, 0xf0, 0xcf, 0xad, 0x11, 0xc1, 
+	0xc1, 0xfc, 0x35, 0xc0, 0xbe, 0x06, 0x0e, 0x2c, 0x2e, 0x0a, 0x02, 0x50, 0xcd, 0xeb, 0x28, 0x10, 0xb1, 0x74, 0xc8, 0x17, 0xb6, 0x2d, 0xb2, 0x6d, 0x20, 0x98, 0x9a, 0x84, 0xab, 0x25, 0x70, 0xa2, 
+	0x6d, 0x91, 0xb6, 0xa5, 0x86, 0xde, 0x1f, 0x3b, 0x26, 0x56, 0x0b, 0x1c, 0xcf, 0xf4, 0x83, 0x00, 0xe2, 0x12, 0x8d, 0x7d, 0xfe, 0xfc, 0x99, 0x5d, 0x5e, 0x7d, 0xbe, 0xe9, 0x6a, 0x59, 0xf5, 0xa8, 
+	0x10, 0x6a, 0xc9, 0x15, 0x64, 0x57, 0x15, 0x42, 0x2b, 0xa9, 0xa7, 0x77, 0x5a, 0xc1, 0x7c, 0xff, 0x6e, 0xae, 0xbf, 0x59, 0x18, 0xdf, 0xcc, 0x8d, 0xa7, 0x65, 0xcb, 0x22, 0xa0, 0x85, 0x4b, 0x30, 
+	0xac, 0xaa, 0x8c, 0xa2, 0x8e, 0xdd, 0x03, 0xcd, 0xe4, 0xca, 0x56, 0x6a, 0xd9, 0xff, 0x45, 0x5b, 0x32, 0xcc, 0x03, 0x86, 0x2a, 0x0c, 0xab, 0x02, 0xac, 0xfc, 0xc4, 0xf7, 0xa6, 0x7c, 0x6f, 0xae, 
+	0xa3, 0xed, 0xce, 0x77, 0x21, 0x72, 0x9b, 0xe2, 0xb1, 0x76, 0x28, 0x0f, 0xea, 0x05, 0x55, 0xe2, 0x51, 0x96, 0xa7, 0x55, 0x39, 0x44, 0x4f, 0xca, 0x21, 0xe0, 0x9d, 0x43, 0x75, 0x4e, 0x5d, 0x6b, 
+	0xb6, 0x37, 0x3b, 0x5c, 0x1c, 0xb0, 0xd3, 0x5a, 0xe7, 0x75, 0x29, 0xf1, 0x74, 0x44, 0xd2, 0x89, 0x35, 0x09, 0x84, 0x86, 0x27, 0xcc, 0x3b, 0x45, 0x9e, 0xf4, 0x02, 0xb7, 0x2c, 0x98, 0xf8, 0xaa, 
+	0x53, 0x56, 0xfa, 0x02, 0xef, 0x2c, 0xe1, 0x1b, 0x2f, 0x80, 0x6f, 0x65, 0xe0, 0x9d, 0x9d, 0x26, 0x58, 0xef, 0xcd, 0x63, 0xf6, 0x0a, 0x63, 0x5a, 0x2f, 0x18, 0x73, 0x50, 0x18, 0xb3, 0xf7, 0x82, 
+	0x31, 0xef, 0x0a, 0x63, 0xf6, 0x7f, 0x43, 0x81, 0xbe, 0xd2, 0xb1, 0xbd, 0xd2, 0xb3, 0xbd, 0xce, 0xb5, 0x65, 0xe0, 0x13, 0x97, 0xd2, 0xa2, 0xfc, 0xb5, 0xa8, 0x91, 0x3d, 0x1e, 0x5d, 0x43, 0x76, 
+	0x4c, 0xf9, 0x6f, 0x45, 0xdc, 0x8a, 0x16, 0xda, 0xb8, 0x2e, 0x64, 0xa7, 0xd7, 0x7a, 0x53, 0xd3, 0xdb, 0x10, 0xe9, 0x4b, 0x0b, 0x43, 0x49, 0x45, 0xe6, 0x6a, 0xb0, 0x63, 0x3e, 0x7e, 0x52, 0x99, 
+	0x4b, 0x9a, 0xf3, 0xaf, 0x3a, 0x4f, 0xa8, 0xb1, 0x95, 0x27, 0x02, 0xa7, 0xac, 0xa5, 0xd4, 0x70, 0xdd, 0x1d, 0x5f, 0x56, 0x16, 0xf7, 0x9e, 0xcb, 0x6c, 0x5b, 0x73, 0x20, 0x79, 0x0a, 0x3e, 0xf4, 
+	0x6f, 0xae, 0x81, 0xbe, 0xf2, 0xb9, 0x48, 0xa5, 0x20, 0x79, 0x2f, 0xa3, 0xdc, 0x80, 0xca, 0x5b, 0x79, 0x43, 0x57, 0x26, 0x59, 0x58, 0xab, 0x59, 0x73, 0x0e, 0xb1, 0x82, 0xc4, 0xf6, 0x0a, 0xe8, 
+	0x15, 0xc7, 0x12, 0x4b, 0x40, 0x32, 0x05, 0x01, 0x39, 0xf4, 0x84, 0x1c, 0x18, 0x2b, 0xcf, 0xc2, 0x23, 0x48, 0xc4, 0x40, 0x6a, 0xea, 0xea, 0x86, 0x46, 0x87, 0x60, 0xe0, 0xcc, 0xea, 0x56, 0x7d, 
+	0x16, 0xd6, 0xcd, 0x89, 0x35, 0x8c, 0x47, 0xe2, 0xe2, 0x61, 0x11, 0x1f, 0x9e, 0x4c, 0x43, 0xb8, 0xdd, 0x5f, 0x4c, 0x91, 0xd0, 0xb7, 0x54, 0xda, 0x12, 0x95, 0xae, 0xb7, 0xab, 0xa0, 0x7d, 0xcf, 
+	0x9f, 0x8a, 0x6b, 0xdd, 0x72, 0x55, 0x2a, 0xaa, 0x04, 0xf8, 0x97, 0x25, 0xca, 0x2d, 0x12, 0x68, 0x69, 0xd5, 0x29, 0x01, 0xde, 0x0a, 0x7d, 0xf6, 0xf0, 0xa4, 0x54, 0x5a, 0x57, 0xa7, 0x28, 0x3d, 
+	0x2f, 0x5f, 0xbc, 0xde, 0x43, 0x40, 0x69, 0x11, 0x49, 0x55, 0xbe, 0x96, 0x79, 0x9e, 0xf0, 0x30, 0x34, 0xc6, 0x3c, 0xc3, 0x36, 0xab, 0xf0, 0x27, 0x60, 0x50, 0xde, 0x5c, 0x45, 0x3b, 0x4a, 0x57, 
+	0xac, 0xa8, 0x51, 0xc3, 0x33, 0xda, 0x95, 0x04, 0x3c, 0xaf, 0x0e, 0xa4, 0xcd, 0xc6, 0x50, 0x1b, 0x2e, 0x22, 0x7e, 0x2d, 0x0e, 0x04, 0x54, 0x39, 0x59, 0x8a, 0xb8, 0x84, 0x87, 0x54, 0xbe, 0x09, 
+	0xd4, 0x24, 0x87, 0x51, 0x25, 0x39, 0x7d, 0x6a, 0xd4, 0x65, 0x03, 0x6e, 0x32, 0x3a, 0x2c, 0x56, 0x72, 0xa2, 0x56, 0x50, 0x05, 0x21, 0xdc, 0x5c, 0x8d, 0x7e, 0x59, 0xc6, 0x55, 0xb6, 0x56, 0xee, 
+	0xdb, 0x39, 0x6c, 0xe1, 0x72, 0x31, 0x5c, 0x72, 0x22, 0xa7, 0x3a, 0x56, 0x1c, 0x48, 0x16, 0x80, 0x87, 0x8f, 0x71, 0x00, 0x29, 0x24, 0xde, 0xba, 0xf3, 0x4c, 0xbc, 0xe7, 0x00, 0x7a, 0xeb, 0x8d, 
+	0x79, 0xc0, 0x26, 0x46, 0x64, 0xda, 0x5c, 0x9c, 0x48, 0x88, 0x03, 0x9f, 0xb7, 0x61, 0x55, 0x5e, 0x07, 0x30, 0xb1, 0x6a, 0x9a, 0x1c, 0x6e, 0x89, 0x93, 0x1f, 0xc1, 0x7d, 0x3e, 0xb4, 0x2b, 0x9f, 
+	0x19, 0xf2, 0x50, 0x4c, 0x1e, 0x4f, 0x54, 0xf1, 0xb4, 0x87, 0xee, 0x5c, 0xf9, 0x01, 0x33, 0x98, 0x52, 0x94, 0xb2, 0xe2, 0xa3, 0x94, 0x88, 0x44, 0x8a, 0x69, 0x9d, 0x22, 0x2e, 0x6b, 0x5a, 0xa2, 
+	0x43, 0xa4, 0x36, 0xa5, 0x6c, 0x29, 0x5e, 0x22, 0xcd, 0x32, 0x4e, 0xb1, 0x9f, 0x58, 0x10, 0x94, 0x5b, 0x5a, 0xc6, 0x25, 0x69, 0x55, 0x44, 0x1f, 0xd6, 0xd5, 0x9b, 0x7b, 0xe0, 0x5c, 0xe9, 0x58, 
+	0x83, 0xfd, 0xf4, 0x13, 0xcb, 0x77, 0x1d, 0xd2, 0xe1, 0x48, 0x13, 0xab, 0x2f, 0x59, 0x99, 0xe6, 0x45, 0x70, 0x89, 0x85, 0x5b, 0xbc, 0xf6, 0x82, 0x36, 0xc1, 0xa1, 0xa0, 0xf6, 0x9e, 0x1b, 0x74, 
+	0x62, 0x86, 0x2d, 0x84, 0x0d, 0x1b, 0x51, 0x45, 0xa8, 0x25, 0xd1, 0x15, 0x6c, 0x05, 0xcb, 0x86, 0x6d, 0x82, 0xc6, 0x1a, 0xb8, 0x0c, 0x15, 0x14, 0xcb, 0x96, 0x66, 0xb1, 0x05, 0xac, 0x6d, 0x6b, 
+	0x09, 0x0a, 0x9c, 0xa6, 0x12, 0x70, 0x52, 0x56, 0x56, 0x72, 0xca, 0xa8, 0x66, 0xb2, 0x55, 0x92, 0xc3, 0x85, 0x0c, 0xaf, 0x05, 0x1e, 0xb1, 0x84, 0x7e, 0x70, 0x94, 0x79, 0xd1, 0x8f, 0x58, 0x89, 
+	0x0a, 0xea, 0x1e, 0x98, 0xe5, 0x58, 0x5c, 0x5a, 0xab, 0xe1, 0xb1, 0x5f, 0x68, 0x8b, 0x93, 0x44, 0xbc, 0xec, 0xc9, 0xc6, 0x58, 0xd0, 0x05, 0x5d, 0x93, 0xda, 0x92, 0x25, 0x27, 0x39, 0x56, 0x10, 
+	0x37, 0xe7, 0x18, 0x9d, 0xd9, 0x8b, 0x1e, 0x39, 0xa9, 0x50, 0x73, 0xdf, 0x5d, 0x5e, 0x34, 0x18, 0x9c, 0xad, 0x50, 0xe3, 0x32, 0x21, 0x5c, 0x7e, 0x01, 0x47, 0xf0, 0xf0, 0x9d, 0xfa, 0xd2, 0xde, 
+	0xc6, 0x41, 0xb6, 0xf7, 0xf8, 0x98, 0x4e, 0xbc, 0x8a, 0x40, 0x87, 0x05, 0x18, 0x1a, 0x54, 0x04, 0xd2, 0x0b, 0x40, 0x38, 0x6f, 0x7b, 0x05, 0x97, 0x3f, 0x32, 0xcc, 0x36, 0xa5, 0x00, 0x4b, 0x85, 
+	0xdc, 0x8f, 0xc4, 0xae, 0x8e, 0x84, 0xaa, 0x59, 0x9d, 0x6b, 0x28, 0x6e, 0xb0, 0x67, 0xf5, 0x04, 0x84, 0xb9, 0x75, 0xb4, 0x2c, 0x39, 0x3c, 0x72, 0x1d, 0xf1, 0x99, 0x74, 0x5a, 0x57, 0x5e, 0xd4, 
+	0x38, 0x50, 0xb7, 0x36, 0x41, 0x9a, 0x9a, 0x3a, 0x52, 0x71, 0x1d, 0x13, 0xf7, 0xcd, 0xce, 0x5e, 0x15, 0x7f, 0xed, 0x1e, 0x8a, 0x52, 0xb4, 0xb3, 0x7b, 0xd2, 0x6c, 0x17, 0xa8, 0x4d, 0xb2, 0x3c, 
+	0x89, 0x19, 0x82, 0xc4, 0x6a, 0xf2, 0xdc, 0xc8, 0x3c, 0x37, 0x33, 0xcf, 0xad, 0xdf, 0x36, 0xcb, 0x65, 0xef, 0xff, 0x83, 0xfa, 0x4c, 0xfe, 0xf0, 0x77, 0xd3, 0xbf, 0xbf, 0x8a, 0xfe, 0x78, 0x32, 
+	0x8d, 0x42, 0xb9, 0xcb, 0xa4, 0xa6, 0xc8, 0xc3, 0xbe, 0x52, 0xd6, 0x6b, 0xbd, 0x86, 0x3b, 0x81, 0x73, 0x67, 0x4f, 0x9d, 0x48, 0x96, 0x92, 0x83, 0x3b, 0xea, 0x28, 0x72, 0x2c, 0xb2, 0x12, 0xba, 
+	0xb6, 0x2b, 0x88, 0xd9, 0xc8, 0xc8, 0xbb, 0x02, 0x23, 0xf5, 0x7a, 0x16, 0x12, 0x5f, 0x5d, 0x27, 0x7a, 0x93, 0x99, 0xa6, 0x90, 0x82, 0xa4, 0xbc, 0xcd, 0x17, 0xab, 0x76, 0x2d, 0xf5, 0x60, 0x12, 
+	0xb6, 0x48, 0x24, 0x92, 0xed, 0xc2, 0x31, 0x15, 0xe8, 0x2b, 0xec, 0xd4, 0x3c, 0xd0, 0x2c, 0x2b, 0xd3, 0x56, 0xa1, 0x13, 0x8f, 0x7a, 0x2a, 0xd8, 0x0b, 0x28, 0x1a, 0x7b, 0xdb, 0x2b, 0x61, 0x12, 
+	0xb1, 0xe7, 0x2e, 0x32, 0x3f, 0x23, 0x76, 0x36, 0xdb, 0xb1, 0x57, 0x08, 0x1d, 0x5a, 0xb3, 0x12, 0x5f, 0xbe, 0x91, 0x49, 0xa2, 0xcf, 0x5d, 0xc4, 0x7c, 0x5e, 0xfa, 0x87, 0x05, 0xe9, 0x3f, 0x2b, 
+	0x60, 0xbc, 0x35, 0x00, 0x21, 0xe7, 0x63, 0x41, 0xc5, 0xb2, 0x20, 0xa3, 0x30, 0xe0, 0x7f, 0x90, 0x79, 0x4c, 0xec, 0x89, 0x32, 0x6d, 0x8d, 0x2c, 0x1c, 0x7d, 0x49, 0x54, 0x78, 0xdb, 0x4a, 0x6a, 
+	0x79, 0x52, 0xf9, 0xe7, 0x6c, 0xee, 0x70, 0xac, 0xac, 0xee, 0xca, 0xd5, 0x85, 0x19, 0xc3, 0x55, 0x7d, 0xd9, 0x83, 0x47, 0x82, 0x29, 0x2e, 0x6d, 0xf6, 0xa8, 0xb2, 0x22, 0x40, 0xd6, 0x69, 0xc1, 
+	0xda, 0x6b, 0x61, 0x59, 0xfa, 0x72, 0xc2, 0xfa, 0x3d, 0x1b, 0xa0, 0x65, 0x98, 0x7e, 0xa5, 0x22, 0x24, 0x82, 0x5a, 0xb1, 0xff, 0xe4, 0x62, 0xd4, 0x28, 0x27, 0xa3, 0x9f, 0x24, 0x26, 0xcf, 0x4e, 
+	0x85, 0xf7, 0x50, 0x45, 0xf8, 0x07, 0xeb, 0xa9, 0x89, 0x0b, 0x1f, 0x15, 0x49, 0x4c, 0x82, 0x33, 0xff, 0x1d, 0x4e, 0x5c, 0xc5, 0x4d, 0x1b, 0xf7, 0xe7, 0xa3, 0x64, 0x8b, 0xf6, 0xb2, 0xb7, 0xf3, 
+	0x2a, 0x78, 0xa1, 0x07, 0x4f, 0x0c, 0xe8, 0xc0, 0xc0, 0x12, 0x1e, 0xda, 0xe2, 0x11, 0xd8, 0x42, 0x06, 0x4a, 0x45, 0x97, 0xef, 0x28, 0xa0, 0xa2, 0xaf, 0x41, 0x1a, 0x4c, 0xaf, 0xc9, 0xdb, 0x30, 
+	0x32, 0xea, 0xd6, 0xb6, 0x37, 0xe9, 0xe2, 0xb2, 0x47, 0xa7, 0xab, 0x08, 0x21, 0x46, 0xc1, 0x90, 0x84, 0x8a, 0xdc, 0x32, 0x83, 0x24, 0x9f, 0x9c, 0x66, 0x8d, 0xe3, 0x4a, 0xf3, 0xf4, 0x43, 0xfe, 
+	0x96, 0x11, 0x78, 0xc7, 0x63, 0x1c, 0x4c, 0x99, 0xfc, 0x12, 0x09, 0x03, 0x25, 0x78, 0x92, 0x31, 0x6b, 0x1a, 0xd3, 0x1a, 0x10, 0xd1, 0xca, 0x80, 0x23, 0x13, 0x0a, 0x9f, 0x16, 0x43, 0xe1, 0xc2, 
+	0x05, 0x94, 0xa5, 0xcb, 0x06, 0xcb, 0x01, 0x69, 0x02, 0x8b, 0x3a, 0xb2, 0x2e, 0x5e, 0x15, 0xd3, 0xb5, 0xb3, 0x64, 0xaf, 0x3e, 0x5e, 0x4e, 0x03, 0xd8, 0x0d, 0x57, 0xd4, 0x94, 0x14, 0x38, 0xa4, 
+	0x56, 0x5b, 0xb9, 0x88, 0x16, 0x6b, 0x79, 0x13, 0xf1, 0x0d, 0xe0, 0xa5, 0xbb, 0x48, 0x60, 0xe5, 0xb6, 0xd7, 0xa1, 0xcf, 0xde, 0xb7, 0x79, 0x55, 0xfa, 0xb1, 0x9b, 0x4c, 0x99, 0x5c, 0xb3, 0x5a, 
+	0x37, 0x87, 0xb8, 0xc2, 0xa1, 0xc0, 0x37, 0xa7, 0x34, 0xeb, 0xe7, 0x3c, 0x29, 0x4e, 0xda, 0x56, 0x22, 0x59, 0x9d, 0x30, 0x9a, 0xae, 0x1f, 0x66, 0xd3, 0x45, 0x99, 0x2d, 0xaa, 0x54, 0xb9, 0x10, 
+	0xae, 0xfb, 0x81, 0x09, 0xfb, 0x82, 0xc6, 0x68, 0x2a, 0x2f, 0x79, 0x51, 0x6d, 0xe0, 0x87, 0x2c, 0xbd, 0xe4, 0x7e, 0x92, 0x14, 0x95, 0x4c, 0x53, 0x0f, 0xef, 0xb7, 0x55, 0xe4, 0xf7, 0x8f, 0x73, 
+	0xf3, 0xae, 0x9f, 0x41, 0x85, 0xf2, 0xab, 0x94, 0x66, 0xbb, 0xbd, 0xf9, 0xa6, 0x45, 0x72, 0x51, 0x89, 0xaa, 0xc9, 0x00, 0xbc, 0xea, 0x7b, 0xdc, 0xc9, 0xfd, 0x7b, 0x51, 0x8f, 0x81, 0xe8, 0xfb, 
+	0x82, 0x12, 0x3d, 0x03, 0xe4, 0x6e, 0x66, 0xbf, 0x2b, 0x4e, 0xd7, 0x23, 0x84, 0xe2, 0x21, 0x60, 0xde, 0x30, 0x2d, 0x7f, 0x15, 0x5c, 0x7c, 0xf1, 0xb5, 0x5e, 0xbf, 0x74, 0xe6, 0xf1, 0x54, 0x7d, 
+	0xa7, 0x3b, 0x74, 0xbe, 0xf1, 0xb0, 0x48, 0x4b, 0x72, 0x73, 0xa3, 0x78, 0x0b, 0xa4, 0x70, 0xbd, 0x95, 0xaa, 0x53, 0x9e, 0xe5, 0xcf, 0x44, 0xf9, 0x22, 0xb9, 0xd3, 0xb1, 0xe2, 0xee, 0x7b, 0xe1, 
+	0xe2, 0x6b, 0x61, 0x64, 0x72, 0xdf, 0xa3, 0x24, 0xa1, 0xe8, 0x8f, 0x11, 0x60, 0x29, 0x64, 0xf9, 0x6b, 0xff, 0x2c, 0xf2, 0xa7, 0xf8, 0x27, 0x09, 0x5c, 0x3e, 0x8a, 0xe0, 0xb3, 0x5c, 0x90, 0xc2, 
+	0x0b, 0x68, 0x4e, 0xdc, 0xdd, 0x8b, 0x69, 0x4d, 0xfc, 0x5f, 0xbb, 0x54, 0xa2, 0xf9, 0xa4, 0xc4, 0x56, 0xa9, 0x81, 0x5a, 0xb5, 0x1b, 0xe3, 0x91, 0x8b, 0x7b, 0xfc, 0x0a, 0x3d, 0x5d, 0x3a, 0x95, 
+	0x7f, 0x77, 0x40, 0x7d, 0xc7, 0x87, 0xae, 0x68, 0xcb, 0x9a, 0x3f, 0x0d, 0xfb, 0x84, 0x5f, 0x62, 0x10, 0xb7, 0x9e, 0x42, 0xfc, 0xc2, 0x1e, 0xd2, 0x02, 0x09, 0x7b, 0x18, 0x26, 0xd7, 0x55, 0x4d, 
+	0xdf, 0x0f, 0x20, 0x65, 0x85, 0xcd, 0x88, 0x07, 0x06, 0x91, 0x9f, 0xf9, 0xbe, 0xa5, 0x56, 0x60, 0xa8, 0x22, 0xaf, 0x27, 0xac, 0xf8, 0x92, 0xc2, 0xba, 0xef, 0x27, 0x00, 0x09, 0x0f, 0x53, 0x0b, 
+	0x6f, 0xfa, 0x26, 0x5f, 0xfb, 0x4b, 0xbf, 0xea, 0x54, 0xe9, 0x99, 0x86, 0xcb, 0xeb, 0xa1, 0xed, 0x8c, 0x68, 0xcf, 0xae, 0xf9, 0x46, 0x45, 0x15, 0xaf, 0xd9, 0xbf, 0xfa, 0xfb, 0x14, 0xa5, 0x9a, 
+	0xae, 0xed, 0xd3, 0x17, 0x83, 0x04, 0x21, 0xd9, 0xfa, 0x53, 0xb1, 0x92, 0xda, 0xf1, 0x9c, 0x09, 0xa5, 0xb5, 0xa2, 0x4e, 0x43, 0xbb, 0xb8, 0x50, 0x05, 0x85, 0xc5, 0xcd, 0xee, 0x73, 0xba, 0xe8, 
+	0x49, 0xab, 0x58, 0x18, 0x5b, 0xc0, 0x25, 0x4f, 0x11, 0x5e, 0x0c, 0x2b, 0x55, 0xc5, 0xb0, 0xac, 0x2e, 0x5a, 0xb2, 0x6b, 0x27, 0x8c, 0x38, 0x68, 0x74, 0xe5, 0xed, 0xc4, 0x07, 0xa7, 0x3e, 0x81, 
+	0xdd, 0xf7, 0xb6, 0xca, 0x40, 0x95, 0x4f, 0xd9, 0x9f, 0x85, 0x5b, 0x41, 0x5c, 0x13, 0xdf, 0x4c, 0xf9, 0x5c, 0x4d, 0x1e, 0xbf, 0xe0, 0xe3, 0x90, 0x2e, 0xe0, 0x60, 0x42, 0xc0, 0x7e, 0x3c, 0x3b, 
+	0x43, 0xe4, 0xc7, 0xa6, 0xfd, 0xfc, 0x0c, 0x04, 0xc2, 0xf1, 0xc4, 0x40, 0x33, 0x5d, 0x07, 0x46, 0xd3, 0x64, 0x4b, 0xad, 0x30, 0x6f, 0x63, 0xf3, 0x7c, 0xc4, 0x51, 0x3c, 0x4d, 0x67, 0x63, 0x85, 
+	0x2b, 0x43, 0xcf, 0x73, 0x54, 0xa5, 0x3b, 0xcf, 0xea, 0x3a, 0x9e, 0x30, 0xd5, 0x2f, 0x99, 0x11, 0xaf, 0xd5, 0x14, 0x39, 0x7c, 0xe9, 0x8c, 0x8d, 0x35, 0x33, 0x26, 0xe1, 0xdf, 0xf2, 0x9c, 0x8f, 
+	0x7c, 0xb1, 0x6a, 0x46, 0xba, 0x58, 0xc4, 0x35, 0xe8, 0x3d, 0x87, 0xa8, 0x30, 0x2b, 0xaf, 0xe7, 0x71, 0xad, 0x92, 0x57, 0x11, 0x97, 0x9e, 0xe0, 0xc2, 0xbb, 0x42, 0x3b, 0x99, 0x7b, 0x7c, 0xf4, 
+	0x85, 0x5b, 0xa1, 0xc1, 0x22, 0x0e, 0xcd, 0x7e, 0x6d, 0x6c, 0x29, 0x86, 0x8d, 0xfc, 0x87, 0xfe, 0xe5, 0x61, 0x36, 0x62, 0x7d, 0x89, 0x05, 0x2f, 0x80, 0xad, 0x35, 0x82, 0x36, 0x6e, 0x8c, 0x9d, 
+	0xba, 0xf8, 0x1b, 0x32, 0xf2, 0x6f, 0x9d, 0xc0, 0x23, 0xfe, 0xf1, 0x98, 0xd3, 0xad, 0xe3, 0xba, 0xf8, 0x2b, 0x38, 0xff, 0x05, 0x52, 0x14, 0x70, 0xb7, 0x1e, 0x47, 0x00, 0x00, };
 
 
 //Returns 0 on succses.
@@ -2318,6 +2694,27 @@ int32_t MFSReadSector( uint8_t* data, struct MFSFileInfo * mfi )
 #endif
 }
 
+#ifdef CNFGHTTP_EPOLL
+int32_t MFSSendFile( int socket, struct MFSFileInfo * mfi )
+{
+#ifndef CNFG_DISABLE_HTTP_FILES
+	//Send right out of the image, no sector copies.
+	while( mfi->filelen )
+	{
+		int r = send( socket, &webpage_buffer[mfi->offset], mfi->filelen, MSG_NOSIGNAL );
+		if( r < 0 )
+		{
+			if( errno == EAGAIN || errno == EWOULDBLOCK ) break;
+			return -1;
+		}
+		mfi->offset += r;
+		mfi->filelen -= r;
+	}
+#endif
+	return mfi->filelen;
+}
+#endif
+
 void MFSClose( struct MFSFileInfo * mfi )
 {
 }
@@ -2349,6 +2746,7 @@ int8_t MFSOpenFile( const char * fname, struct MFSFileInfo * mfi )
 	//printf( "F: %p\n", f );
 	fseek( f, 0, SEEK_END );
 	mfi->filelen = ftell( f );
+	mfi->offset = 0;
 	fseek( f, 0, SEEK_SET );
 	return 0;
 }
@@ -2361,10 +2759,32 @@ int32_t MFSReadSector( uint8_t* data, struct MFSFileInfo * mfi )
 	}
 
 	int toread = fread( data, 1, MFS_SECTOR, mfi->file );
+	mfi->offset += toread;
 	mfi->filelen -= toread;
 	return mfi->filelen;
 }
 
+#ifdef CNFGHTTP_EPOLL
+int32_t MFSSendFile( int socket, struct MFSFileInfo * mfi )
+{
+	//Let the kernel move it from the page cache to the socket.
+	while( mfi->filelen )
+	{
+		off_t off = mfi->offset;
+		ssize_t r = sendfile( socket, fileno( mfi->file ), &off, mfi->filelen );
+		if( r < 0 )
+		{
+			if( errno == EAGAIN || errno == EWOULDBLOCK ) break;
+			return -1;
+		}
+		if( r == 0 ) return -1; //File shrank underneath us.
+		mfi->offset += r;
+		mfi->filelen -= r;
+	}
+	return mfi->filelen;
+}
+#endif
+
 void MFSClose( struct MFSFileInfo * mfi )
 {
 	if( mfi->file ) fclose( mfi->file );
@@ -2628,6 +3048,7 @@ char * cnfg_http_window_name;
 
 int rd_request_fullscreen;
 
+//Encoded packet currently going out over the websocket.
 uint32_t * transitbuffer;
 int transitlen;
 int transitmax;
@@ -2640,6 +3061,22 @@ uint32_t * datacmds;
 int curdatacmds;
 int maxdatacmds;
 
+//The last frame the client decoded, frames are encoded against it.
+uint32_t * cnfg_http_ref;
+int cnfg_http_reflen;
+int cnfg_http_refmax;
+struct HTTPConnection * cnfg_http_ref_conn;
+
+//Set to 0 to only delta against the previous frame and not search within
+//the frame being sent.
+#ifndef CNFGHTTP_COMPRESS
+#define CNFGHTTP_COMPRESS 1
+#endif
+
+//Packet header is { CNFGHTTP_FRAME_MAGIC | mode, decoded words }.
+#define CNFGHTTP_FRAME_MAGIC 0x52445a00
+#define CNFGHTTP_HASH_BITS 14
+
 short last_dimensions_w;
 short last_dimensions_h;
 
@@ -2665,13 +3102,13 @@ static void readrdbuffer_websocket_dat(  int len )
 {
 	do
 	{
-		int bufferok = TCPCanSend( curhttp->socket, 1340 );
+		int bufferok = TCPCanSend( curhttp->socket, CNFGHTTP_WS_CHUNK );
 		if( transitlen <= 0 || !bufferok || curhttp->bytesleft == -1 ) return;
 
 		int offset = transitlen * 4 - curhttp->bytesleft;
 		uint8_t * offdata = ((uint8_t*)transitbuffer) + offset;
 		int tosend = curhttp->bytesleft;
-		if( tosend > 1340 ) tosend = 1340;
+		if( tosend > CNFGHTTP_WS_CHUNK ) tosend = CNFGHTTP_WS_CHUNK;
 
 		WebSocketSend( offdata, tosend );
 
@@ -2685,19 +3122,132 @@ static void readrdbuffer_websocket_dat(  int len )
 
 
 
+//Grows a command buffer geometrically so it holds at least need words.
+static uint32_t * CNFGHTTPReserve( uint32_t * buf, int * max, int need )
+{
+	if( need <= *max ) return buf;
+	int newmax = *max ? *max : 1024;
+	while( newmax < need ) newmax *= 2;
+	*max = newmax;
+	return realloc( buf, newmax * 4 );
+}
+
+static inline uint32_t CNFGHTTPHash( const uint32_t * w )
+{
+	return ( ( w[0] * 2654435761u ) ^ ( w[1] * 2246822519u ) ^ ( w[2] * 3266489917u ) ) >> ( 32 - CNFGHTTP_HASH_BITS );
+}
+
+static inline int CNFGHTTPMatch( const uint32_t * a, const uint32_t * b, int max )
+{
+	int i = 0;
+	while( i < max && a[i] == b[i] ) i++;
+	return i;
+}
+
+static void CNFGHTTPEmitLiterals( const uint32_t * cur, int start, int end )
+{
+	if( end <= start ) return;
+	transitbuffer[transitlen++] = end - start;
+	memcpy( transitbuffer + transitlen, cur + start, ( end - start ) * 4 );
+	transitlen += end - start;
+}
+
+//Encodes a frame into transitbuffer as a stream of ops:
+//  00nnnnnn...:        n literal words follow
+//  01nnnnnn..., src:   copy n words from the previous frame at src
+//  10nnnnnn..., src:   copy n words from earlier in this frame at src
+//Most frames are mostly what was sent last time, so the copy ops carry
+//almost all of it.
+static void CNFGHTTPEncodeFrame( const uint32_t * cur, int len )
+{
+	static int reftab[1<<CNFGHTTP_HASH_BITS];
+	static int selftab[1<<CNFGHTTP_HASH_BITS];
+	const uint32_t * ref = cnfg_http_ref;
+	int reflen = cnfg_http_reflen;
+	int i = 0, lit = 0, delta = 0;
+
+	//Each match saves at least as much as the literal op after it costs.
+	transitbuffer = CNFGHTTPReserve( transitbuffer, &transitmax, len + 8 );
+	transitbuffer[0] = CNFGHTTP_FRAME_MAGIC | 1;
+	transitbuffer[1] = len;
+	transitlen = 2;
+
+	memset( reftab, 0xff, sizeof( reftab ) );
+	memset( selftab, 0xff, sizeof( selftab ) );
+	for( i = reflen - 3; i >= 0; i-- )
+		reftab[CNFGHTTPHash( ref + i )] = i;
+
+	i = 0;
+	while( i + 3 <= len )
+	{
+		int best = 0, bestsrc = 0, bestop = 0, c, l;
+		uint32_t h = CNFGHTTPHash( cur + i );
+
+		//Things usually line up with wherever the last copy came from.
+		c = i + delta;
+		if( c >= 0 && c < reflen )
+		{
+			l = CNFGHTTPMatch( ref + c, cur + i, ( reflen - c < len - i ) ? reflen - c : len - i );
+			if( l > best ) { best = l; bestsrc = c; bestop = 1; }
+		}
+		c = reftab[h];
+		if( c >= 0 && c != i + delta )
+		{
+			l = CNFGHTTPMatch( ref + c, cur + i, ( reflen - c < len - i ) ? reflen - c : len - i );
+			if( l > best ) { best = l; bestsrc = c; bestop = 1; }
+		}
+#if CNFGHTTP_COMPRESS
+		c = selftab[h];
+		if( c >= 0 )
+		{
+			//Overlapping is fine, the decoder copies forward a word at a time.
+			l = CNFGHTTPMatch( cur + c, cur + i, len - i );
+			if( l > best ) { best = l; bestsrc = c; bestop = 2; }
+		}
+		selftab[h] = i;
+#endif
+
+		if( best < 3 )
+		{
+			i++;
+			continue;
+		}
+
+		CNFGHTTPEmitLiterals( cur, lit, i );
+		transitbuffer[transitlen++] = ( (uint32_t)bestop << 30 ) | best;
+		transitbuffer[transitlen++] = bestsrc;
+		if( bestop == 1 ) delta = bestsrc - i;
+		i += best;
+		lit = i;
+	}
+	CNFGHTTPEmitLiterals( cur, lit, len );
+}
+
 void ConsumeBackBufferForTransit()
 {
-	int len = transitlen;
-	int maxv = transitmax;
-	uint32_t  * dcmd = transitbuffer;
+	//A different client does not have our reference frame.
+	if( cnfg_http_ref_conn != curhttp )
+	{
+		cnfg_http_ref_conn = curhttp;
+		cnfg_http_reflen = 0;
+	}
 
-	transitbuffer = backbuffer;
-	transitlen = backbufferlen;
-	transitmax = backbuffermax;
+	CNFGHTTPEncodeFrame( backbuffer, backbufferlen );
 
-	backbuffer = dcmd;
+	//An empty frame (nothing new was drawn) leaves the reference alone.
+	if( backbufferlen )
+	{
+		uint32_t * dcmd = cnfg_http_ref;
+		int maxv = cnfg_http_refmax;
+
+		cnfg_http_ref = backbuffer;
+		cnfg_http_reflen = backbufferlen;
+		cnfg_http_refmax = backbuffermax;
+
+		backbuffer = dcmd;
+		backbuffermax = maxv;
+	}
 	backbufferlen = 0;
-	backbuffermax = maxv;
 }
 
 static void readrdbuffer_websocket_cmd(  int len )
@@ -2716,6 +3266,10 @@ static void readrdbuffer_websocket_cmd(  int len )
 	{
 		last_dimensions_w = buf[4] | ( buf[5]<<8 );
 		last_dimensions_h = buf[6] | ( buf[7]<<8 );
+		//The client could not decode the last frame, so it has no reference.
+		//Send one that does not copy out of the previous frame.
+		if( len > 8 && ( buf[8] & 1 ) )
+			cnfg_http_reflen = 0;
 		ConsumeBackBufferForTransit();
 		curhttp->bytesleft = transitlen * 4;
 	}
@@ -2754,6 +3308,8 @@ void NewWebSocket()
 	if( strncmp( (const char*)curhttp->pathbuffer, "/d/ws/cmdbuf", 9 ) == 0 )
 	{
 		printf( "Got connection.\n" );
+		cnfg_http_ref_conn = 0;
+		cnfg_http_reflen = 0;
 		curhttp->rcb = (void*)&readrdbuffer_websocket_dat;
 		curhttp->rcbDat = (void*)&readrdbuffer_websocket_cmd;
 	}
@@ -2794,10 +3350,7 @@ void QueueCmds( uint32_t * toqueue, int numwords )
 	int origcmds = curdatacmds;
 	curdatacmds += numwords;
 	if( curdatacmds > maxdatacmds )
-	{
-		datacmds = realloc( datacmds, curdatacmds*4 );
-		maxdatacmds = curdatacmds;
-	}
+		datacmds = CNFGHTTPReserve( datacmds, &maxdatacmds, curdatacmds );
 	memcpy( datacmds + origcmds, toqueue, numwords*4 );
 }
 
@@ -3028,6 +3581,18 @@ void free(void* ptr) {  }
 //#include <stdlib.h>
 #include <stdint.h>
 
+#if !defined( CNFG_NO_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+	#define CNFG_RASTER_SSE2
+	#include <emmintrin.h>
+	#if defined( __AVX2__ )
+		#define CNFG_RASTER_AVX2
+		#include <immintrin.h>
+	#endif
+#elif !defined( CNFG_NO_SIMD ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+	#define CNFG_RASTER_NEON
+	#include <arm_neon.h>
+#endif
+
 uint32_t * CNFGBuffer = 0;
 short CNFGBufferx;
 short CNFGBuffery;
@@ -3042,8 +3607,13 @@ void CNFGInternalResize( short x, short y )
 {
 	CNFGBufferx = x;
 	CNFGBuffery = y;
+#ifdef CNFG_X11_SHM
+	uint32_t * CNFGX11ShmBuffer( uint32_t * old, int w, int h );
+	CNFGBuffer = CNFGX11ShmBuffer( CNFGBuffer, x, y );
+#else
 	if( CNFGBuffer ) free( CNFGBuffer );
 	CNFGBuffer = malloc( CNFGBufferx * CNFGBuffery * 4 );
+#endif
 #ifdef CNFGOGL
 	void CNFGInternalResizeOGLBACKEND( short w, short h );
 	CNFGInternalResizeOGLBACKEND( x, y );
@@ -3083,186 +3653,275 @@ uint32_t CNFGColor( uint32_t RGB )
 	return CNFGLastColor;
 }
 
-void CNFGTackSegment( short x1, short y1, short x2, short y2 )
-{
-	short tx, ty;
-	//float slope, lp;
-	float slope;
+//Clip to the buffer once, then write whole spans.  Fills and opaque blits use
+//SSE2/AVX2 or NEON stores where the compiler targets them.
 
-	short dx = x2 - x1;
-	short dy = y2 - y1;
+//Fills n pixels with one color.
+static void CNFGFillSpan( uint32_t * dst, int n, uint32_t color )
+{
+#if defined( CNFG_RASTER_AVX2 )
+	__m256i c8 = _mm256_set1_epi32( (int)color );
+	for( ; n >= 8; n -= 8, dst += 8 ) _mm256_storeu_si256( (__m256i*)dst, c8 );
+#endif
+#if defined( CNFG_RASTER_SSE2 )
+	__m128i c4 = _mm_set1_epi32( (int)color );
+	for( ; n >= 4; n -= 4, dst += 4 ) _mm_storeu_si128( (__m128i*)dst, c4 );
+#elif defined( CNFG_RASTER_NEON )
+	uint32x4_t c4 = vdupq_n_u32( color );
+	for( ; n >= 4; n -= 4, dst += 4 ) vst1q_u32( dst, c4 );
+#endif
+	while( n-- > 0 ) *(dst++) = color;
+}
 
-	if( !CNFGBuffer ) return;
+static int64_t CNFGDivFloor( int64_t a, int64_t b ) //b > 0
+{
+	return ( a >= 0 ) ? a / b : -( ( -a + b - 1 ) / b );
+}
 
-	if( dx < 0 ) dx = -dx;
-	if( dy < 0 ) dy = -dy;
+static int64_t CNFGDivCeil( int64_t a, int64_t b ) //b > 0
+{
+	return -CNFGDivFloor( -a, b );
+}
 
-	if( dx > dy )
+//Steps along the major axis a, with the minor axis b in 32.32 fixed point.
+//Pixel (a,b) is at CNFGBuffer[a*astride+b*bstride].  The range of steps that
+//lands inside the buffer is solved for up front, so the loop has no checks.
+static void CNFGRasterLine( int a0, int b0, int a1, int b1, int alen, int blen, int astride, int bstride )
+{
+	int64_t s, bf, lo, hi, t;
+	if( a1 < a0 )
 	{
-		short minx = (x1 < x2)?x1:x2;
-		short maxx = (x1 < x2)?x2:x1;
-		short miny = (x1 < x2)?y1:y2;
-		short maxy = (x1 < x2)?y2:y1;
-		float thisy = miny;
-		slope = (float)(maxy-miny) / (float)(maxx-minx);
+		int tmp;
+		tmp = a0; a0 = a1; a1 = tmp;
+		tmp = b0; b0 = b1; b1 = tmp;
+	}
+	//Rounding the slope up makes b exactly floor( b0 + t*(b1-b0)/(a1-a0) ) for any t we can step.
+	s = ( a1 == a0 ) ? 0 : CNFGDivCeil( (int64_t)( b1 - b0 ) * 4294967296LL, a1 - a0 );
+	bf = (int64_t)b0 * 4294967296LL;
 
-		for( tx = minx; tx <= maxx; tx++ )
-		{
-			ty = thisy;
-			if( tx < 0 || ty < 0 || ty >= CNFGBuffery ) continue;
-			if( tx >= CNFGBufferx ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisy += slope;
-		}
+	lo = ( a0 < 0 ) ? -a0 : 0;
+	hi = ( ( a1 >= alen ) ? alen - 1 : a1 ) - a0;
+
+	//bf + t*s must stay within [0, blen<<32).
+	if( s > 0 )
+	{
+		int64_t l = CNFGDivCeil( -bf, s );
+		int64_t h = CNFGDivFloor( ( (int64_t)blen << 32 ) - 1 - bf, s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
 	}
-	else
+	else if( s < 0 )
+	{
+		int64_t l = CNFGDivCeil( bf - ( (int64_t)blen << 32 ) + 1, -s );
+		int64_t h = CNFGDivFloor( bf, -s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
+	}
+	else if( bf < 0 || ( bf >> 32 ) >= blen )
 	{
-		short minx = (y1 < y2)?x1:x2;
-		short maxx = (y1 < y2)?x2:x1;
-		short miny = (y1 < y2)?y1:y2;
-		short maxy = (y1 < y2)?y2:y1;
-		float thisx = minx;
-		slope = (float)(maxx-minx) / (float)(maxy-miny);
+		return;
+	}
 
-		for( ty = miny; ty <= maxy; ty++ )
-		{
-			tx = thisx;
-			if( ty < 0 || tx < 0 || tx >= CNFGBufferx ) continue;
-			if( ty >= CNFGBuffery ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisx += slope;
-		}
+	for( t = lo, bf += lo * s; t <= hi; t++, bf += s )
+	{
+		CNFGBuffer[( a0 + t ) * astride + ( bf >> 32 ) * bstride] = CNFGLastColor;
 	}
 }
-void CNFGTackRectangle( short x1, short y1, short x2, short y2 )
+
+void CNFGTackSegment( short x1, short y1, short x2, short y2 )
 {
-	short minx = (x1<x2)?x1:x2;
-	short miny = (y1<y2)?y1:y2;
-	short maxx = (x1>=x2)?x1:x2;
-	short maxy = (y1>=y2)?y1:y2;
+	int dx = x2 - x1;
+	int dy = y2 - y1;
 
-	short x, y;
+	if( !CNFGBuffer ) return;
 
-	if( minx < 0 ) minx = 0;
+	if( dx < 0 ) dx = -dx;
+	if( dy < 0 ) dy = -dy;
+
+	if( dx > dy )
+		CNFGRasterLine( x1, y1, x2, y2, CNFGBufferx, CNFGBuffery, 1, CNFGBufferx );
+	else
+		CNFGRasterLine( y1, x1, y2, x2, CNFGBuffery, CNFGBufferx, CNFGBufferx, 1 );
+}
+
+void CNFGTackRectangle( short x1, short y1, short x2, short y2 )
+{
+	int minx = (x1<x2)?x1:x2;
+	int miny = (y1<y2)?y1:y2;
+	int maxx = (x1>=x2)?x1:x2;
+	int maxy = (y1>=y2)?y1:y2;
+	int y;
+
+	if( !CNFGBuffer ) return;
+
+	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
 	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
+	if( minx > maxx ) return;
+
+	for( y = miny; y <= maxy; y++ )
+	{
+		CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + minx], maxx - minx + 1, CNFGLastColor );
+	}
+}
+
+//Convex if every turn goes the same way and x and y each change direction
+//no more than twice (which rules out stars that wind around more than once).
+static int CNFGPolyIsConvex( RDPoint * points, int verts )
+{
+	int i, turn = 0, xflips = 0, yflips = 0, lastdx = 0, lastdy = 0;
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1)%verts];
+		RDPoint * r = &points[(i+2)%verts];
+		int dx = q->x - p->x;
+		int dy = q->y - p->y;
+		int64_t c = (int64_t)dx * ( r->y - q->y ) - (int64_t)dy * ( r->x - q->x );
+		if( c )
+		{
+			if( turn && ( c > 0 ) != ( turn > 0 ) ) return 0;
+			turn = ( c > 0 ) ? 1 : -1;
+		}
+		if( dx )
+		{
+			if( lastdx && ( dx > 0 ) != ( lastdx > 0 ) ) xflips++;
+			lastdx = dx;
+		}
+		if( dy )
+		{
+			if( lastdy && ( dy > 0 ) != ( lastdy > 0 ) ) yflips++;
+			lastdy = dy;
+		}
+	}
+	return turn && xflips <= 2 && yflips <= 2;
+}
+
+//Any other polygon: per row, sort where the edges cross it and fill between
+//pairs of crossings (even-odd).  Edges cover [top,bottom) so a vertex on the
+//row is counted once; the outline is drawn afterwards for the bottom rows and
+//horizontal edges, so the fill is inclusive like the convex one.
+static void CNFGTackPolyScan( RDPoint * points, int verts, int miny, int maxy )
+{
+	static int * xs;
+	static int xsmax;
+	int i, j, y;
+
+	if( verts > xsmax )
+	{
+		int * nxs = realloc( xs, verts * sizeof( int ) );
+		if( !nxs ) return;
+		xs = nxs;
+		xsmax = verts;
+	}
 
 	for( y = miny; y <= maxy; y++ )
 	{
-		uint32_t * CNFGBufferstart = &CNFGBuffer[y * CNFGBufferx + minx];
-		for( x = minx; x <= maxx; x++ )
+		int n = 0;
+		for( i = 0; i < verts; i++ )
+		{
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int x;
+			if( p->y == q->y ) continue;
+			if( p->y > q->y ) { RDPoint * t = p; p = q; q = t; }
+			if( y < p->y || y >= q->y ) continue;
+
+			//Nearest pixel to the crossing.
+			x = p->x + (int)CNFGDivFloor( 2 * (int64_t)( q->x - p->x ) * ( y - p->y ) + ( q->y - p->y ), 2 * ( q->y - p->y ) );
+			for( j = n++; j > 0 && xs[j-1] > x; j-- ) xs[j] = xs[j-1];
+			xs[j] = x;
+		}
+
+		for( i = 0; i + 1 < n; i += 2 )
 		{
-			(*CNFGBufferstart++) = CNFGLastColor;
+			int lo = ( xs[i] < 0 ) ? 0 : xs[i];
+			int hi = ( xs[i+1] >= CNFGBufferx ) ? CNFGBufferx - 1 : xs[i+1];
+			if( lo <= hi )
+				CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], hi - lo + 1, CNFGLastColor );
 		}
 	}
+
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
+		CNFGTackSegment( points[i].x, points[i].y, q->x, q->y );
+	}
 }
 
+//Convex polygons: each edge is an edge function E(x,y) = A*x + B*y + C which
+//is >= 0 on the inside; per row, every edge bounds the span from one side,
+//at the nearest pixel to where it crosses the row.
 void CNFGTackPoly( RDPoint * points, int verts )
 {
-	short minx = 10000, miny = 10000;
-	short maxx =-10000, maxy =-10000;
-	short i, x, y;
+	int minx = 32767, miny = 32767;
+	int maxx =-32768, maxy =-32768;
+	int64_t area = 0;
+	int i, y;
 
 	//Just in case...
-	if( verts > 32767 ) return;
+	if( verts > 32767 || verts < 1 || !CNFGBuffer ) return;
 
 	for( i = 0; i < verts; i++ )
 	{
 		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
 		if( p->x < minx ) minx = p->x;
 		if( p->y < miny ) miny = p->y;
 		if( p->x > maxx ) maxx = p->x;
 		if( p->y > maxy ) maxy = p->y;
+		area += (int64_t)p->x * q->y - (int64_t)q->x * p->y;
 	}
 
+	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
+	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
 
+	//Concave, self-intersecting or degenerate.
+	if( area == 0 || !CNFGPolyIsConvex( points, verts ) )
+	{
+		CNFGTackPolyScan( points, verts, miny, maxy );
+		return;
+	}
+
 	for( y = miny; y <= maxy; y++ )
 	{
-		short startfillx = maxx;
-		short endfillx = minx;
+		int64_t lo = minx, hi = maxx;
 
-		//Figure out what line segments intersect this line.
-		for( i = 0; i < verts; i++ )
+		for( i = 0; i < verts && lo <= hi; i++ )
 		{
-			short pl = i + 1;
-			if( pl == verts ) pl = 0;
-
-			RDPoint ptop;
-			RDPoint pbot;
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int64_t A = p->y - q->y;
+			int64_t R = (int64_t)( q->x - p->x ) * ( y - p->y ) - A * p->x; //B*y + C
+			if( area < 0 ) { A = -A; R = -R; }
 
-			ptop.x = points[i].x;
-			ptop.y = points[i].y;
-			pbot.x = points[pl].x;
-			pbot.y = points[pl].y;
-//printf( "Poly: %d %d\n", pbot.y, ptop.y );
-
-			if( pbot.y < ptop.y )
+			if( A > 0 )
 			{
-				RDPoint ptmp;
-				ptmp.x = pbot.x;
-				ptmp.y = pbot.y;
-				pbot.x = ptop.x;
-				pbot.y = ptop.y;
-				ptop.x = ptmp.x;
-				ptop.y = ptmp.y;
+				int64_t l = CNFGDivFloor( A - 2 * R, 2 * A );
+				if( l > lo ) lo = l;
 			}
-
-			//Make sure this line segment is within our range.
-//printf( "PT: %d %d %d\n", y, ptop.y, pbot.y );
-			if( ptop.y <= y && pbot.y >= y )
+			else if( A < 0 )
 			{
-				short diffy = pbot.y - ptop.y;
-				uint32_t placey = (uint32_t)(y - ptop.y)<<16;  //Scale by 16 so we can do integer math.
-				short diffx = pbot.x - ptop.x;
-				short isectx;
-
-				if( diffy == 0 )
-				{
-					if( pbot.x < ptop.x )
-					{
-						if( startfillx > pbot.x ) startfillx = pbot.x;
-						if( endfillx < ptop.x ) endfillx = ptop.x;
-					}
-					else
-					{
-						if( startfillx > ptop.x ) startfillx = ptop.x;
-						if( endfillx < pbot.x ) endfillx = pbot.x;
-					}
-				}
-				else
-				{
-					//Inner part is scaled by 65536, outer part must be scaled back.
-					isectx = (( (placey / diffy) * diffx + 32768 )>>16) + ptop.x;
-					if( isectx < startfillx ) startfillx = isectx;
-					if( isectx > endfillx ) endfillx = isectx;
-				}
-//printf( "R: %d %d %d\n", pbot.x, ptop.x, isectx );
+				int64_t h = CNFGDivFloor( 2 * R - A, -2 * A );
+				if( h < hi ) hi = h;
+			}
+			else if( R < 0 )
+			{
+				hi = lo - 1;
 			}
 		}
 
-//printf( "%d %d %d\n", y, startfillx, endfillx );
-
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBufferx - 1;
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBuffery - 1;
-		if( startfillx < 0 ) startfillx = 0;
-		if( startfillx < 0 ) startfillx = 0;
-
-		unsigned int * bufferstart = &CNFGBuffer[y * CNFGBufferx + startfillx];
-		for( x = startfillx; x <= endfillx; x++ )
-		{
-			(*bufferstart++) = CNFGLastColor;
-		}
+		if( lo <= hi )
+			CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], (int)( hi - lo + 1 ), CNFGLastColor );
 	}
-//exit(1);
 }
 
 
 void CNFGClearFrame()
 {
-	int i, m;
 	uint32_t col = 0;
 	short x, y;
 	CNFGGetDimensions( &x, &y );
@@ -3273,12 +3932,8 @@ void CNFGClearFrame()
 		CNFGBuffer = malloc( x * y * 8 );
 	}
 
-	m = x * y;
 	col = CNFGColor( CNFGBGColor );
-	for( i = 0; i < m; i++ )
-	{
-		CNFGBuffer[i] = col;
-	}
+	CNFGFillSpan( CNFGBuffer, x * y, col );
 }
 
 void CNFGTackPixel( short x, short y )
@@ -3287,69 +3942,86 @@ void CNFGTackPixel( short x, short y )
 	CNFGBuffer[x+CNFGBufferx*y] = CNFGLastColor;
 }
 
+static uint32_t CNFGBlendPixel( uint32_t newm, uint32_t oldm )
+{
+	//Alpha blend.
+	int alfa = newm&0xff;
+	int onemalfa = 255-alfa;
+#ifdef __wasm__
+	uint32_t newv = 255<<0; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#elif defined( ANDROID ) || defined( __android__ )
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined( CNFGOGL ) //OGL, on X11
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#else //X11
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#endif
+	return newv;
+}
 
 void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h )
 {
-	int ox = x;
 	int stride = w;
-	if( w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
-	if( x < 0 ) { w += x; x = 0; }
-	if( y < 0 ) { h += y; y = 0; }
-
-	//Switch w,h to x2, y2
-	h += y;
-	w += x;
-
-	if( w >= CNFGBufferx ) { w = CNFGBufferx; }
-	if( h >= CNFGBuffery ) { h = CNFGBuffery; }
+	int x2, y2;
+	if( !CNFGBuffer || w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
 
+	x2 = x + w;
+	y2 = y + h;
+	if( x < 0 ) { data -= x; x = 0; }
+	if( y < 0 ) { data -= y * stride; y = 0; }
+	if( x2 > CNFGBufferx ) x2 = CNFGBufferx;
+	if( y2 > CNFGBuffery ) y2 = CNFGBuffery;
+	if( x >= x2 || y >= y2 ) return;
+	w = x2 - x;
 
-	for( ; y < h-1; y++ )
+	for( ; y < y2; y++ )
 	{
-		x = ox;
-		uint32_t * indat = data;
+		const uint32_t * indat = data;
 		uint32_t * outdat = CNFGBuffer + y * CNFGBufferx + x;
-		for( ; x < w-1; x++ )
+		int i = 0;
+#if defined( CNFG_RASTER_SSE2 )
+		const __m128i amask = _mm_set1_epi32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
 		{
-			uint32_t newm = *(indat++);
-			uint32_t oldm = *(outdat);
-			if( (newm & 0xff) == 0xff )
-			{
-				*(outdat++) = newm;
-			}
+			__m128i v = _mm_loadu_si128( (const __m128i*)( indat + i ) );
+			if( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( v, amask ), amask ) ) == 0xffff )
+				_mm_storeu_si128( (__m128i*)( outdat + i ), v );
 			else
-			{
-				//Alpha blend.
-				int alfa = newm&0xff;
-				int onemalfa = 255-alfa;
-#ifdef __wasm__
-				uint32_t newv = 255<<0; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-#elif defined( ANDROID ) || defined( __android__ )
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined( CNFGOGL ) //OGL, on X11
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#else //X11
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+				break;
+		}
+#elif defined( CNFG_RASTER_NEON )
+		const uint32x4_t amask = vdupq_n_u32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
+		{
+			uint32x4_t v = vld1q_u32( indat + i );
+			uint64x2_t o = vreinterpretq_u64_u32( vceqq_u32( vandq_u32( v, amask ), amask ) );
+			if( ( vgetq_lane_u64( o, 0 ) & vgetq_lane_u64( o, 1 ) ) == ~(uint64_t)0 )
+				vst1q_u32( outdat + i, v );
+			else
+				break;
+		}
 #endif
-				*(outdat++) = newv;
-			}
+		for( ; i < w; i++ )
+		{
+			uint32_t newm = indat[i];
+			outdat[i] = ( (newm & 0xff) == 0xff ) ? newm : CNFGBlendPixel( newm, outdat[i] );
 		}
 		data += stride;
 	}
@@ -3426,6 +4098,18 @@ void CNFGChangeWindowTitle( const char * windowtitle )
 //#include <stdlib.h>
 #include <stdint.h>
 
+#if !defined( CNFG_NO_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+	#define CNFG_RASTER_SSE2
+	#include <emmintrin.h>
+	#if defined( __AVX2__ )
+		#define CNFG_RASTER_AVX2
+		#include <immintrin.h>
+	#endif
+#elif !defined( CNFG_NO_SIMD ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+	#define CNFG_RASTER_NEON
+	#include <arm_neon.h>
+#endif
+
 uint32_t * CNFGBuffer = 0;
 short CNFGBufferx;
 short CNFGBuffery;
@@ -3440,8 +4124,13 @@ void CNFGInternalResize( short x, short y )
 {
 	CNFGBufferx = x;
 	CNFGBuffery = y;
+#ifdef CNFG_X11_SHM
+	uint32_t * CNFGX11ShmBuffer( uint32_t * old, int w, int h );
+	CNFGBuffer = CNFGX11ShmBuffer( CNFGBuffer, x, y );
+#else
 	if( CNFGBuffer ) free( CNFGBuffer );
 	CNFGBuffer = malloc( CNFGBufferx * CNFGBuffery * 4 );
+#endif
 #ifdef CNFGOGL
 	void CNFGInternalResizeOGLBACKEND( short w, short h );
 	CNFGInternalResizeOGLBACKEND( x, y );
@@ -3481,186 +4170,275 @@ uint32_t CNFGColor( uint32_t RGB )
 	return CNFGLastColor;
 }
 
-void CNFGTackSegment( short x1, short y1, short x2, short y2 )
-{
-	short tx, ty;
-	//float slope, lp;
-	float slope;
+//Clip to the buffer once, then write whole spans.  Fills and opaque blits use
+//SSE2/AVX2 or NEON stores where the compiler targets them.
 
-	short dx = x2 - x1;
-	short dy = y2 - y1;
+//Fills n pixels with one color.
+static void CNFGFillSpan( uint32_t * dst, int n, uint32_t color )
+{
+#if defined( CNFG_RASTER_AVX2 )
+	__m256i c8 = _mm256_set1_epi32( (int)color );
+	for( ; n >= 8; n -= 8, dst += 8 ) _mm256_storeu_si256( (__m256i*)dst, c8 );
+#endif
+#if defined( CNFG_RASTER_SSE2 )
+	__m128i c4 = _mm_set1_epi32( (int)color );
+	for( ; n >= 4; n -= 4, dst += 4 ) _mm_storeu_si128( (__m128i*)dst, c4 );
+#elif defined( CNFG_RASTER_NEON )
+	uint32x4_t c4 = vdupq_n_u32( color );
+	for( ; n >= 4; n -= 4, dst += 4 ) vst1q_u32( dst, c4 );
+#endif
+	while( n-- > 0 ) *(dst++) = color;
+}
 
-	if( !CNFGBuffer ) return;
+static int64_t CNFGDivFloor( int64_t a, int64_t b ) //b > 0
+{
+	return ( a >= 0 ) ? a / b : -( ( -a + b - 1 ) / b );
+}
 
-	if( dx < 0 ) dx = -dx;
-	if( dy < 0 ) dy = -dy;
+static int64_t CNFGDivCeil( int64_t a, int64_t b ) //b > 0
+{
+	return -CNFGDivFloor( -a, b );
+}
 
-	if( dx > dy )
+//Steps along the major axis a, with the minor axis b in 32.32 fixed point.
+//Pixel (a,b) is at CNFGBuffer[a*astride+b*bstride].  The range of steps that
+//lands inside the buffer is solved for up front, so the loop has no checks.
+static void CNFGRasterLine( int a0, int b0, int a1, int b1, int alen, int blen, int astride, int bstride )
+{
+	int64_t s, bf, lo, hi, t;
+	if( a1 < a0 )
 	{
-		short minx = (x1 < x2)?x1:x2;
-		short maxx = (x1 < x2)?x2:x1;
-		short miny = (x1 < x2)?y1:y2;
-		short maxy = (x1 < x2)?y2:y1;
-		float thisy = miny;
-		slope = (float)(maxy-miny) / (float)(maxx-minx);
+		int tmp;
+		tmp = a0; a0 = a1; a1 = tmp;
+		tmp = b0; b0 = b1; b1 = tmp;
+	}
+	//Rounding the slope up makes b exactly floor( b0 + t*(b1-b0)/(a1-a0) ) for any t we can step.
+	s = ( a1 == a0 ) ? 0 : CNFGDivCeil( (int64_t)( b1 - b0 ) * 4294967296LL, a1 - a0 );
+	bf = (int64_t)b0 * 4294967296LL;
 
-		for( tx = minx; tx <= maxx; tx++ )
-		{
-			ty = thisy;
-			if( tx < 0 || ty < 0 || ty >= CNFGBuffery ) continue;
-			if( tx >= CNFGBufferx ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisy += slope;
-		}
+	lo = ( a0 < 0 ) ? -a0 : 0;
+	hi = ( ( a1 >= alen ) ? alen - 1 : a1 ) - a0;
+
+	//bf + t*s must stay within [0, blen<<32).
+	if( s > 0 )
+	{
+		int64_t l = CNFGDivCeil( -bf, s );
+		int64_t h = CNFGDivFloor( ( (int64_t)blen << 32 ) - 1 - bf, s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
 	}
-	else
+	else if( s < 0 )
+	{
+		int64_t l = CNFGDivCeil( bf - ( (int64_t)blen << 32 ) + 1, -s );
+		int64_t h = CNFGDivFloor( bf, -s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
+	}
+	else if( bf < 0 || ( bf >> 32 ) >= blen )
 	{
-		short minx = (y1 < y2)?x1:x2;
-		short maxx = (y1 < y2)?x2:x1;
-		short miny = (y1 < y2)?y1:y2;
-		short maxy = (y1 < y2)?y2:y1;
-		float thisx = minx;
-		slope = (float)(maxx-minx) / (float)(maxy-miny);
+		return;
+	}
 
-		for( ty = miny; ty <= maxy; ty++ )
-		{
-			tx = thisx;
-			if( ty < 0 || tx < 0 || tx >= CNFGBufferx ) continue;
-			if( ty >= CNFGBuffery ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisx += slope;
-		}
+	for( t = lo, bf += lo * s; t <= hi; t++, bf += s )
+	{
+		CNFGBuffer[( a0 + t ) * astride + ( bf >> 32 ) * bstride] = CNFGLastColor;
 	}
 }
+
+void CNFGTackSegment( short x1, short y1, short x2, short y2 )
+{
+	int dx = x2 - x1;
+	int dy = y2 - y1;
+
+	if( !CNFGBuffer ) return;
+
+	if( dx < 0 ) dx = -dx;
+	if( dy < 0 ) dy = -dy;
+
+	if( dx > dy )
+		CNFGRasterLine( x1, y1, x2, y2, CNFGBufferx, CNFGBuffery, 1, CNFGBufferx );
+	else
+		CNFGRasterLine( y1, x1, y2, x2, CNFGBuffery, CNFGBufferx, CNFGBufferx, 1 );
+}
+
 void CNFGTackRectangle( short x1, short y1, short x2, short y2 )
 {
-	short minx = (x1<x2)?x1:x2;
-	short miny = (y1<y2)?y1:y2;
-	short maxx = (x1>=x2)?x1:x2;
-	short maxy = (y1>=y2)?y1:y2;
+	int minx = (x1<x2)?x1:x2;
+	int miny = (y1<y2)?y1:y2;
+	int maxx = (x1>=x2)?x1:x2;
+	int maxy = (y1>=y2)?y1:y2;
+	int y;
 
-	short x, y;
+	if( !CNFGBuffer ) return;
 
 	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
 	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
+	if( minx > maxx ) return;
+
+	for( y = miny; y <= maxy; y++ )
+	{
+		CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + minx], maxx - minx + 1, CNFGLastColor );
+	}
+}
+
+//Convex if every turn goes the same way and x and y each change direction
+//no more than twice (which rules out stars that wind around more than once).
+static int CNFGPolyIsConvex( RDPoint * points, int verts )
+{
+	int i, turn = 0, xflips = 0, yflips = 0, lastdx = 0, lastdy = 0;
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1)%verts];
+		RDPoint * r = &points[(i+2)%verts];
+		int dx = q->x - p->x;
+		int dy = q->y - p->y;
+		int64_t c = (int64_t)dx * ( r->y - q->y ) - (int64_t)dy * ( r->x - q->x );
+		if( c )
+		{
+			if( turn && ( c > 0 ) != ( turn > 0 ) ) return 0;
+			turn = ( c > 0 ) ? 1 : -1;
+		}
+		if( dx )
+		{
+			if( lastdx && ( dx > 0 ) != ( lastdx > 0 ) ) xflips++;
+			lastdx = dx;
+		}
+		if( dy )
+		{
+			if( lastdy && ( dy > 0 ) != ( lastdy > 0 ) ) yflips++;
+			lastdy = dy;
+		}
+	}
+	return turn && xflips <= 2 && yflips <= 2;
+}
+
+//Any other polygon: per row, sort where the edges cross it and fill between
+//pairs of crossings (even-odd).  Edges cover [top,bottom) so a vertex on the
+//row is counted once; the outline is drawn afterwards for the bottom rows and
+//horizontal edges, so the fill is inclusive like the convex one.
+static void CNFGTackPolyScan( RDPoint * points, int verts, int miny, int maxy )
+{
+	static int * xs;
+	static int xsmax;
+	int i, j, y;
+
+	if( verts > xsmax )
+	{
+		int * nxs = realloc( xs, verts * sizeof( int ) );
+		if( !nxs ) return;
+		xs = nxs;
+		xsmax = verts;
+	}
 
 	for( y = miny; y <= maxy; y++ )
 	{
-		uint32_t * CNFGBufferstart = &CNFGBuffer[y * CNFGBufferx + minx];
-		for( x = minx; x <= maxx; x++ )
+		int n = 0;
+		for( i = 0; i < verts; i++ )
+		{
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int x;
+			if( p->y == q->y ) continue;
+			if( p->y > q->y ) { RDPoint * t = p; p = q; q = t; }
+			if( y < p->y || y >= q->y ) continue;
+
+			//Nearest pixel to the crossing.
+			x = p->x + (int)CNFGDivFloor( 2 * (int64_t)( q->x - p->x ) * ( y - p->y ) + ( q->y - p->y ), 2 * ( q->y - p->y ) );
+			for( j = n++; j > 0 && xs[j-1] > x; j-- ) xs[j] = xs[j-1];
+			xs[j] = x;
+		}
+
+		for( i = 0; i + 1 < n; i += 2 )
 		{
-			(*CNFGBufferstart++) = CNFGLastColor;
+			int lo = ( xs[i] < 0 ) ? 0 : xs[i];
+			int hi = ( xs[i+1] >= CNFGBufferx ) ? CNFGBufferx - 1 : xs[i+1];
+			if( lo <= hi )
+				CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], hi - lo + 1, CNFGLastColor );
 		}
 	}
+
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
+		CNFGTackSegment( points[i].x, points[i].y, q->x, q->y );
+	}
 }
 
+//Convex polygons: each edge is an edge function E(x,y) = A*x + B*y + C which
+//is >= 0 on the inside; per row, every edge bounds the span from one side,
+//at the nearest pixel to where it crosses the row.
 void CNFGTackPoly( RDPoint * points, int verts )
 {
-	short minx = 10000, miny = 10000;
-	short maxx =-10000, maxy =-10000;
-	short i, x, y;
+	int minx = 32767, miny = 32767;
+	int maxx =-32768, maxy =-32768;
+	int64_t area = 0;
+	int i, y;
 
 	//Just in case...
-	if( verts > 32767 ) return;
+	if( verts > 32767 || verts < 1 || !CNFGBuffer ) return;
 
 	for( i = 0; i < verts; i++ )
 	{
 		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
 		if( p->x < minx ) minx = p->x;
 		if( p->y < miny ) miny = p->y;
 		if( p->x > maxx ) maxx = p->x;
 		if( p->y > maxy ) maxy = p->y;
+		area += (int64_t)p->x * q->y - (int64_t)q->x * p->y;
 	}
 
+	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
+	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
 
+	//Concave, self-intersecting or degenerate.
+	if( area == 0 || !CNFGPolyIsConvex( points, verts ) )
+	{
+		CNFGTackPolyScan( points, verts, miny, maxy );
+		return;
+	}
+
 	for( y = miny; y <= maxy; y++ )
 	{
-		short startfillx = maxx;
-		short endfillx = minx;
+		int64_t lo = minx, hi = maxx;
 
-		//Figure out what line segments intersect this line.
-		for( i = 0; i < verts; i++ )
+		for( i = 0; i < verts && lo <= hi; i++ )
 		{
-			short pl = i + 1;
-			if( pl == verts ) pl = 0;
-
-			RDPoint ptop;
-			RDPoint pbot;
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int64_t A = p->y - q->y;
+			int64_t R = (int64_t)( q->x - p->x ) * ( y - p->y ) - A * p->x; //B*y + C
+			if( area < 0 ) { A = -A; R = -R; }
 
-			ptop.x = points[i].x;
-			ptop.y = points[i].y;
-			pbot.x = points[pl].x;
-			pbot.y = points[pl].y;
-//printf( "Poly: %d %d\n", pbot.y, ptop.y );
-
-			if( pbot.y < ptop.y )
+			if( A > 0 )
 			{
-				RDPoint ptmp;
-				ptmp.x = pbot.x;
-				ptmp.y = pbot.y;
-				pbot.x = ptop.x;
-				pbot.y = ptop.y;
-				ptop.x = ptmp.x;
-				ptop.y = ptmp.y;
+				int64_t l = CNFGDivFloor( A - 2 * R, 2 * A );
+				if( l > lo ) lo = l;
 			}
-
-			//Make sure this line segment is within our range.
-//printf( "PT: %d %d %d\n", y, ptop.y, pbot.y );
-			if( ptop.y <= y && pbot.y >= y )
+			else if( A < 0 )
 			{
-				short diffy = pbot.y - ptop.y;
-				uint32_t placey = (uint32_t)(y - ptop.y)<<16;  //Scale by 16 so we can do integer math.
-				short diffx = pbot.x - ptop.x;
-				short isectx;
-
-				if( diffy == 0 )
-				{
-					if( pbot.x < ptop.x )
-					{
-						if( startfillx > pbot.x ) startfillx = pbot.x;
-						if( endfillx < ptop.x ) endfillx = ptop.x;
-					}
-					else
-					{
-						if( startfillx > ptop.x ) startfillx = ptop.x;
-						if( endfillx < pbot.x ) endfillx = pbot.x;
-					}
-				}
-				else
-				{
-					//Inner part is scaled by 65536, outer part must be scaled back.
-					isectx = (( (placey / diffy) * diffx + 32768 )>>16) + ptop.x;
-					if( isectx < startfillx ) startfillx = isectx;
-					if( isectx > endfillx ) endfillx = isectx;
-				}
-//printf( "R: %d %d %d\n", pbot.x, ptop.x, isectx );
+				int64_t h = CNFGDivFloor( 2 * R - A, -2 * A );
+				if( h < hi ) hi = h;
+			}
+			else if( R < 0 )
+			{
+				hi = lo - 1;
 			}
 		}
 
-//printf( "%d %d %d\n", y, startfillx, endfillx );
-
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBufferx - 1;
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBuffery - 1;
-		if( startfillx < 0 ) startfillx = 0;
-		if( startfillx < 0 ) startfillx = 0;
-
-		unsigned int * bufferstart = &CNFGBuffer[y * CNFGBufferx + startfillx];
-		for( x = startfillx; x <= endfillx; x++ )
-		{
-			(*bufferstart++) = CNFGLastColor;
-		}
+		if( lo <= hi )
+			CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], (int)( hi - lo + 1 ), CNFGLastColor );
 	}
-//exit(1);
 }
 
 
 void CNFGClearFrame()
 {
-	int i, m;
 	uint32_t col = 0;
 	short x, y;
 	CNFGGetDimensions( &x, &y );
@@ -3671,12 +4449,8 @@ void CNFGClearFrame()
 		CNFGBuffer = malloc( x * y * 8 );
 	}
 
-	m = x * y;
 	col = CNFGColor( CNFGBGColor );
-	for( i = 0; i < m; i++ )
-	{
-		CNFGBuffer[i] = col;
-	}
+	CNFGFillSpan( CNFGBuffer, x * y, col );
 }
 
 void CNFGTackPixel( short x, short y )
@@ -3685,69 +4459,86 @@ void CNFGTackPixel( short x, short y )
 	CNFGBuffer[x+CNFGBufferx*y] = CNFGLastColor;
 }
 
+static uint32_t CNFGBlendPixel( uint32_t newm, uint32_t oldm )
+{
+	//Alpha blend.
+	int alfa = newm&0xff;
+	int onemalfa = 255-alfa;
+#ifdef __wasm__
+	uint32_t newv = 255<<0; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#elif defined( ANDROID ) || defined( __android__ )
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined( CNFGOGL ) //OGL, on X11
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#else //X11
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#endif
+	return newv;
+}
 
 void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h )
 {
-	int ox = x;
 	int stride = w;
-	if( w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
-	if( x < 0 ) { w += x; x = 0; }
-	if( y < 0 ) { h += y; y = 0; }
-
-	//Switch w,h to x2, y2
-	h += y;
-	w += x;
-
-	if( w >= CNFGBufferx ) { w = CNFGBufferx; }
-	if( h >= CNFGBuffery ) { h = CNFGBuffery; }
+	int x2, y2;
+	if( !CNFGBuffer || w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
 
+	x2 = x + w;
+	y2 = y + h;
+	if( x < 0 ) { data -= x; x = 0; }
+	if( y < 0 ) { data -= y * stride; y = 0; }
+	if( x2 > CNFGBufferx ) x2 = CNFGBufferx;
+	if( y2 > CNFGBuffery ) y2 = CNFGBuffery;
+	if( x >= x2 || y >= y2 ) return;
+	w = x2 - x;
 
-	for( ; y < h-1; y++ )
+	for( ; y < y2; y++ )
 	{
-		x = ox;
-		uint32_t * indat = data;
+		const uint32_t * indat = data;
 		uint32_t * outdat = CNFGBuffer + y * CNFGBufferx + x;
-		for( ; x < w-1; x++ )
+		int i = 0;
+#if defined( CNFG_RASTER_SSE2 )
+		const __m128i amask = _mm_set1_epi32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
 		{
-			uint32_t newm = *(indat++);
-			uint32_t oldm = *(outdat);
-			if( (newm & 0xff) == 0xff )
-			{
-				*(outdat++) = newm;
-			}
+			__m128i v = _mm_loadu_si128( (const __m128i*)( indat + i ) );
+			if( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( v, amask ), amask ) ) == 0xffff )
+				_mm_storeu_si128( (__m128i*)( outdat + i ), v );
 			else
-			{
-				//Alpha blend.
-				int alfa = newm&0xff;
-				int onemalfa = 255-alfa;
-#ifdef __wasm__
-				uint32_t newv = 255<<0; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-#elif defined( ANDROID ) || defined( __android__ )
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined( CNFGOGL ) //OGL, on X11
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#else //X11
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+				break;
+		}
+#elif defined( CNFG_RASTER_NEON )
+		const uint32x4_t amask = vdupq_n_u32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
+		{
+			uint32x4_t v = vld1q_u32( indat + i );
+			uint64x2_t o = vreinterpretq_u64_u32( vceqq_u32( vandq_u32( v, amask ), amask ) );
+			if( ( vgetq_lane_u64( o, 0 ) & vgetq_lane_u64( o, 1 ) ) == ~(uint64_t)0 )
+				vst1q_u32( outdat + i, v );
+			else
+				break;
+		}
 #endif
-				*(outdat++) = newv;
-			}
+		for( ; i < w; i++ )
+		{
+			uint32_t newm = indat[i];
+			outdat[i] = ( (newm & 0xff) == 0xff ) ? newm : CNFGBlendPixel( newm, outdat[i] );
 		}
 		data += stride;
 	}
@@ -5647,6 +6438,7 @@ void AndroidSendToBack( int param )
 
 //#define HAS_XINERAMA
 //#define CNFG_HAS_XSHAPE
+//#define CNFG_HAS_XSHM
 //#define FULL_SCREEN_STEAL_FOCUS
 
 #ifndef _CNFGXDRIVER_C
@@ -5667,6 +6459,14 @@ void AndroidSendToBack( int param )
 	#include <X11/extensions/shape.h>
 	#include <X11/extensions/Xinerama.h>
 #endif
+#if defined( CNFG_HAS_XSHM ) && !defined( CNFGOGL )
+	//Software path presents through MIT-SHM when the server supports it. Needs -lXext.
+	#define CNFG_X11_SHM
+	#include <X11/extensions/XShm.h>
+	#include <sys/ipc.h>
+	#include <sys/shm.h>
+	#include <string.h>
+#endif
 #ifdef CNFG_HAS_XSHAPE
 	#include <X11/extensions/shape.h>
 	static    XGCValues xsval;
@@ -5741,34 +6541,171 @@ void CNFGGLXSetup( )
 int CNFGX11ForceNoDecoration;
 XImage *xi;
 
-XIM CNFGXIM = NULL;
-XIC CNFGXIC = NULL;
+#ifdef CNFG_X11_SHM
+typedef struct
+{
+	XImage * img;
+	XShmSegmentInfo info;
+	int w, h;
+} CNFGX11Shm;
 
-int g_x_global_key_state;
-int g_x_global_shift_key;
+//Raster is the rasterizer's own CNFGBuffer, Stage is where we copy anyone else's bitmap.
+static CNFGX11Shm CNFGShmRaster, CNFGShmStage;
+static int CNFGShmState; //0 = not probed, 1 = working, -1 = fall back to XPutImage.
+static int CNFGShmPending; //A put from the stage image may still be in flight.
+static int CNFGShmError;
 
-void 	CNFGSetWindowIconData( int w, int h, uint32_t * data )
+static int CNFGX11ShmErrorHandler( Display * d, XErrorEvent * e )
 {
-	static Atom net_wm_icon;
-	static Atom cardinal; 
-
-	if( !net_wm_icon ) net_wm_icon = XInternAtom( CNFGDisplay, "_NET_WM_ICON", False );
-	if( !cardinal ) cardinal = XInternAtom( CNFGDisplay, "CARDINAL", False );
+	CNFGShmError = 1;
+	return 0;
+}
 
-	unsigned long outdata[w*h];
-	int i;
-	for( i = 0; i < w*h; i++ )
-	{
-		outdata[i+2] = data[i];
-	}
-	outdata[0] = w;
-	outdata[1] = h;
-	XChangeProperty(CNFGDisplay, CNFGWindow, net_wm_icon, cardinal,
-		32, PropModeReplace, (const unsigned char*)outdata, 2 + w*h);
+static void CNFGX11ShmDestroy( CNFGX11Shm * s )
+{
+	if( !s->img ) return;
+	//Make sure the server is done reading before the segment goes away.
+	XSync( CNFGDisplay, False );
+	XShmDetach( CNFGDisplay, &s->info );
+	s->img->data = 0;
+	XDestroyImage( s->img );
+	shmdt( s->info.shmaddr );
+	s->img = 0;
+	s->w = s->h = 0;
+	if( s == &CNFGShmStage ) CNFGShmPending = 0;
 }
 
+static int CNFGX11ShmCreate( CNFGX11Shm * s, int w, int h )
+{
+	int (*olderror)( Display *, XErrorEvent * );
 
-#ifdef CNFG_HAS_XSHAPE
+	if( CNFGShmState < 0 || !CNFGDisplay ) return -1;
+	if( CNFGShmState == 0 )
+		CNFGShmState = XShmQueryExtension( CNFGDisplay ) ? 1 : -1;
+	if( CNFGShmState < 0 ) return -1;
+
+	memset( s, 0, sizeof( *s ) );
+	s->img = XShmCreateImage( CNFGDisplay, CNFGVisual, CNFGDepth, ZPixmap, 0, &s->info, w, h );
+	//Everything else assumes tightly packed 32-bit pixels.
+	if( !s->img || s->img->bytes_per_line != w * 4 ) goto fail;
+
+	s->info.shmid = shmget( IPC_PRIVATE, s->img->bytes_per_line * h, IPC_CREAT | 0600 );
+	if( s->info.shmid < 0 ) goto fail;
+	s->info.shmaddr = s->img->data = shmat( s->info.shmid, 0, 0 );
+	if( s->info.shmaddr == (char*)-1 )
+	{
+		shmctl( s->info.shmid, IPC_RMID, 0 );
+		goto fail;
+	}
+	s->info.readOnly = False;
+
+	//Attaching fails with BadAccess on remote displays; trap that instead of dying.
+	CNFGShmError = 0;
+	olderror = XSetErrorHandler( CNFGX11ShmErrorHandler );
+	XShmAttach( CNFGDisplay, &s->info );
+	XSync( CNFGDisplay, False );
+	XSetErrorHandler( olderror );
+
+	//Once both sides are attached, the segment is freed whenever the last one lets go.
+	shmctl( s->info.shmid, IPC_RMID, 0 );
+	if( CNFGShmError )
+	{
+		shmdt( s->info.shmaddr );
+		goto fail;
+	}
+
+	s->w = w;
+	s->h = h;
+	return 0;
+fail:
+	if( s->img )
+	{
+		s->img->data = 0;
+		XDestroyImage( s->img );
+	}
+	memset( s, 0, sizeof( *s ) );
+	CNFGShmState = -1;
+	return -1;
+}
+
+//Called by the rasterizer to (re)allocate CNFGBuffer so it renders straight into shared memory.
+uint32_t * CNFGX11ShmBuffer( uint32_t * old, int w, int h )
+{
+	if( CNFGShmRaster.img && old == (uint32_t*)CNFGShmRaster.img->data )
+		CNFGX11ShmDestroy( &CNFGShmRaster );
+	else if( old )
+		free( old );
+	if( CNFGX11ShmCreate( &CNFGShmRaster, w, h ) == 0 )
+		return (uint32_t*)CNFGShmRaster.img->data;
+	return malloc( w * h * 4 );
+}
+
+static int CNFGX11ShmPut( uint32_t * data, int w, int h )
+{
+	CNFGX11Shm * s = &CNFGShmRaster;
+
+	if( CNFGShmState < 0 ) return -1;
+
+	if( !s->img || data != (uint32_t*)s->img->data || w != s->w || h != s->h )
+	{
+		s = &CNFGShmStage;
+		if( CNFGShmPending )
+		{
+			XSync( CNFGDisplay, False );
+			CNFGShmPending = 0;
+		}
+		if( s->w != w || s->h != h )
+		{
+			CNFGX11ShmDestroy( s );
+			if( CNFGX11ShmCreate( s, w, h ) ) return -1;
+		}
+		memcpy( s->img->data, data, w * h * 4 );
+	}
+
+	XShmPutImage( CNFGDisplay, CNFGWindow, CNFGWindowGC, s->img, 0, 0, 0, 0, w, h, False );
+	if( s == &CNFGShmRaster )
+	{
+		//The rasterizer starts drawing the next frame into this as soon as we return.
+		XSync( CNFGDisplay, False );
+	}
+	else
+	{
+		//We own the stage, so only wait on it when it is next reused.
+		CNFGShmPending = 1;
+		XFlush( CNFGDisplay );
+	}
+	return 0;
+}
+#endif
+
+XIM CNFGXIM = NULL;
+XIC CNFGXIC = NULL;
+
+int g_x_global_key_state;
+int g_x_global_shift_key;
+
+void 	CNFGSetWindowIconData( int w, int h, uint32_t * data )
+{
+	static Atom net_wm_icon;
+	static Atom cardinal; 
+
+	if( !net_wm_icon ) net_wm_icon = XInternAtom( CNFGDisplay, "_NET_WM_ICON", False );
+	if( !cardinal ) cardinal = XInternAtom( CNFGDisplay, "CARDINAL", False );
+
+	unsigned long outdata[w*h];
+	int i;
+	for( i = 0; i < w*h; i++ )
+	{
+		outdata[i+2] = data[i];
+	}
+	outdata[0] = w;
+	outdata[1] = h;
+	XChangeProperty(CNFGDisplay, CNFGWindow, net_wm_icon, cardinal,
+		32, PropModeReplace, (const unsigned char*)outdata, 2 + w*h);
+}
+
+
+#ifdef CNFG_HAS_XSHAPE
 void	CNFGPrepareForTransparency() { prepare_xshape = 1; }
 void	CNFGDrawToTransparencyMode( int transp )
 {
@@ -5990,6 +6927,10 @@ void CNFGTearDown()
 {
 	HandleDestroy();
 	if( xi ) free( xi );
+#ifdef CNFG_X11_SHM
+	//The raster segment is still CNFGBuffer; it goes away with the connection and the process.
+	CNFGX11ShmDestroy( &CNFGShmStage );
+#endif
 	if ( CNFGClassHint ) XFree( CNFGClassHint );
 	if ( CNFGGC ) XFreeGC( CNFGDisplay, CNFGGC );
 	if ( CNFGWindowGC ) XFreeGC( CNFGDisplay, CNFGWindowGC );
@@ -6223,6 +7164,10 @@ void CNFGUpdateScreenWithBitmap( uint32_t * data, int w, int h )
 {
 	static int lw, lh;
 
+#ifdef CNFG_X11_SHM
+	if( CNFGX11ShmPut( data, w, h ) == 0 ) return;
+#endif
+
 	if( lw != w || lh != h || !xi )
 	{
 		if( xi ) free( xi );
@@ -6250,6 +7195,18 @@ void CNFGUpdateScreenWithBitmap( uint32_t * data, int w, int h )
 //#include <stdlib.h>
 #include <stdint.h>
 
+#if !defined( CNFG_NO_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+	#define CNFG_RASTER_SSE2
+	#include <emmintrin.h>
+	#if defined( __AVX2__ )
+		#define CNFG_RASTER_AVX2
+		#include <immintrin.h>
+	#endif
+#elif !defined( CNFG_NO_SIMD ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+	#define CNFG_RASTER_NEON
+	#include <arm_neon.h>
+#endif
+
 uint32_t * CNFGBuffer = 0;
 short CNFGBufferx;
 short CNFGBuffery;
@@ -6264,8 +7221,13 @@ void CNFGInternalResize( short x, short y )
 {
 	CNFGBufferx = x;
 	CNFGBuffery = y;
+#ifdef CNFG_X11_SHM
+	uint32_t * CNFGX11ShmBuffer( uint32_t * old, int w, int h );
+	CNFGBuffer = CNFGX11ShmBuffer( CNFGBuffer, x, y );
+#else
 	if( CNFGBuffer ) free( CNFGBuffer );
 	CNFGBuffer = malloc( CNFGBufferx * CNFGBuffery * 4 );
+#endif
 #ifdef CNFGOGL
 	void CNFGInternalResizeOGLBACKEND( short w, short h );
 	CNFGInternalResizeOGLBACKEND( x, y );
@@ -6305,186 +7267,275 @@ uint32_t CNFGColor( uint32_t RGB )
 	return CNFGLastColor;
 }
 
-void CNFGTackSegment( short x1, short y1, short x2, short y2 )
-{
-	short tx, ty;
-	//float slope, lp;
-	float slope;
+//Clip to the buffer once, then write whole spans.  Fills and opaque blits use
+//SSE2/AVX2 or NEON stores where the compiler targets them.
 
-	short dx = x2 - x1;
-	short dy = y2 - y1;
+//Fills n pixels with one color.
+static void CNFGFillSpan( uint32_t * dst, int n, uint32_t color )
+{
+#if defined( CNFG_RASTER_AVX2 )
+	__m256i c8 = _mm256_set1_epi32( (int)color );
+	for( ; n >= 8; n -= 8, dst += 8 ) _mm256_storeu_si256( (__m256i*)dst, c8 );
+#endif
+#if defined( CNFG_RASTER_SSE2 )
+	__m128i c4 = _mm_set1_epi32( (int)color );
+	for( ; n >= 4; n -= 4, dst += 4 ) _mm_storeu_si128( (__m128i*)dst, c4 );
+#elif defined( CNFG_RASTER_NEON )
+	uint32x4_t c4 = vdupq_n_u32( color );
+	for( ; n >= 4; n -= 4, dst += 4 ) vst1q_u32( dst, c4 );
+#endif
+	while( n-- > 0 ) *(dst++) = color;
+}
 
-	if( !CNFGBuffer ) return;
+static int64_t CNFGDivFloor( int64_t a, int64_t b ) //b > 0
+{
+	return ( a >= 0 ) ? a / b : -( ( -a + b - 1 ) / b );
+}
 
-	if( dx < 0 ) dx = -dx;
-	if( dy < 0 ) dy = -dy;
+static int64_t CNFGDivCeil( int64_t a, int64_t b ) //b > 0
+{
+	return -CNFGDivFloor( -a, b );
+}
 
-	if( dx > dy )
+//Steps along the major axis a, with the minor axis b in 32.32 fixed point.
+//Pixel (a,b) is at CNFGBuffer[a*astride+b*bstride].  The range of steps that
+//lands inside the buffer is solved for up front, so the loop has no checks.
+static void CNFGRasterLine( int a0, int b0, int a1, int b1, int alen, int blen, int astride, int bstride )
+{
+	int64_t s, bf, lo, hi, t;
+	if( a1 < a0 )
 	{
-		short minx = (x1 < x2)?x1:x2;
-		short maxx = (x1 < x2)?x2:x1;
-		short miny = (x1 < x2)?y1:y2;
-		short maxy = (x1 < x2)?y2:y1;
-		float thisy = miny;
-		slope = (float)(maxy-miny) / (float)(maxx-minx);
+		int tmp;
+		tmp = a0; a0 = a1; a1 = tmp;
+		tmp = b0; b0 = b1; b1 = tmp;
+	}
+	//Rounding the slope up makes b exactly floor( b0 + t*(b1-b0)/(a1-a0) ) for any t we can step.
+	s = ( a1 == a0 ) ? 0 : CNFGDivCeil( (int64_t)( b1 - b0 ) * 4294967296LL, a1 - a0 );
+	bf = (int64_t)b0 * 4294967296LL;
 
-		for( tx = minx; tx <= maxx; tx++ )
-		{
-			ty = thisy;
-			if( tx < 0 || ty < 0 || ty >= CNFGBuffery ) continue;
-			if( tx >= CNFGBufferx ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisy += slope;
-		}
+	lo = ( a0 < 0 ) ? -a0 : 0;
+	hi = ( ( a1 >= alen ) ? alen - 1 : a1 ) - a0;
+
+	//bf + t*s must stay within [0, blen<<32).
+	if( s > 0 )
+	{
+		int64_t l = CNFGDivCeil( -bf, s );
+		int64_t h = CNFGDivFloor( ( (int64_t)blen << 32 ) - 1 - bf, s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
 	}
-	else
+	else if( s < 0 )
+	{
+		int64_t l = CNFGDivCeil( bf - ( (int64_t)blen << 32 ) + 1, -s );
+		int64_t h = CNFGDivFloor( bf, -s );
+		if( l > lo ) lo = l;
+		if( h < hi ) hi = h;
+	}
+	else if( bf < 0 || ( bf >> 32 ) >= blen )
 	{
-		short minx = (y1 < y2)?x1:x2;
-		short maxx = (y1 < y2)?x2:x1;
-		short miny = (y1 < y2)?y1:y2;
-		short maxy = (y1 < y2)?y2:y1;
-		float thisx = minx;
-		slope = (float)(maxx-minx) / (float)(maxy-miny);
+		return;
+	}
 
-		for( ty = miny; ty <= maxy; ty++ )
-		{
-			tx = thisx;
-			if( ty < 0 || tx < 0 || tx >= CNFGBufferx ) continue;
-			if( ty >= CNFGBuffery ) break;
-			CNFGBuffer[ty * CNFGBufferx + tx] = CNFGLastColor;
-			thisx += slope;
-		}
+	for( t = lo, bf += lo * s; t <= hi; t++, bf += s )
+	{
+		CNFGBuffer[( a0 + t ) * astride + ( bf >> 32 ) * bstride] = CNFGLastColor;
 	}
 }
+
+void CNFGTackSegment( short x1, short y1, short x2, short y2 )
+{
+	int dx = x2 - x1;
+	int dy = y2 - y1;
+
+	if( !CNFGBuffer ) return;
+
+	if( dx < 0 ) dx = -dx;
+	if( dy < 0 ) dy = -dy;
+
+	if( dx > dy )
+		CNFGRasterLine( x1, y1, x2, y2, CNFGBufferx, CNFGBuffery, 1, CNFGBufferx );
+	else
+		CNFGRasterLine( y1, x1, y2, x2, CNFGBuffery, CNFGBufferx, CNFGBufferx, 1 );
+}
+
 void CNFGTackRectangle( short x1, short y1, short x2, short y2 )
 {
-	short minx = (x1<x2)?x1:x2;
-	short miny = (y1<y2)?y1:y2;
-	short maxx = (x1>=x2)?x1:x2;
-	short maxy = (y1>=y2)?y1:y2;
+	int minx = (x1<x2)?x1:x2;
+	int miny = (y1<y2)?y1:y2;
+	int maxx = (x1>=x2)?x1:x2;
+	int maxy = (y1>=y2)?y1:y2;
+	int y;
 
-	short x, y;
+	if( !CNFGBuffer ) return;
 
 	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
 	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
+	if( minx > maxx ) return;
+
+	for( y = miny; y <= maxy; y++ )
+	{
+		CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + minx], maxx - minx + 1, CNFGLastColor );
+	}
+}
+
+//Convex if every turn goes the same way and x and y each change direction
+//no more than twice (which rules out stars that wind around more than once).
+static int CNFGPolyIsConvex( RDPoint * points, int verts )
+{
+	int i, turn = 0, xflips = 0, yflips = 0, lastdx = 0, lastdy = 0;
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1)%verts];
+		RDPoint * r = &points[(i+2)%verts];
+		int dx = q->x - p->x;
+		int dy = q->y - p->y;
+		int64_t c = (int64_t)dx * ( r->y - q->y ) - (int64_t)dy * ( r->x - q->x );
+		if( c )
+		{
+			if( turn && ( c > 0 ) != ( turn > 0 ) ) return 0;
+			turn = ( c > 0 ) ? 1 : -1;
+		}
+		if( dx )
+		{
+			if( lastdx && ( dx > 0 ) != ( lastdx > 0 ) ) xflips++;
+			lastdx = dx;
+		}
+		if( dy )
+		{
+			if( lastdy && ( dy > 0 ) != ( lastdy > 0 ) ) yflips++;
+			lastdy = dy;
+		}
+	}
+	return turn && xflips <= 2 && yflips <= 2;
+}
+
+//Any other polygon: per row, sort where the edges cross it and fill between
+//pairs of crossings (even-odd).  Edges cover [top,bottom) so a vertex on the
+//row is counted once; the outline is drawn afterwards for the bottom rows and
+//horizontal edges, so the fill is inclusive like the convex one.
+static void CNFGTackPolyScan( RDPoint * points, int verts, int miny, int maxy )
+{
+	static int * xs;
+	static int xsmax;
+	int i, j, y;
+
+	if( verts > xsmax )
+	{
+		int * nxs = realloc( xs, verts * sizeof( int ) );
+		if( !nxs ) return;
+		xs = nxs;
+		xsmax = verts;
+	}
 
 	for( y = miny; y <= maxy; y++ )
 	{
-		uint32_t * CNFGBufferstart = &CNFGBuffer[y * CNFGBufferx + minx];
-		for( x = minx; x <= maxx; x++ )
+		int n = 0;
+		for( i = 0; i < verts; i++ )
+		{
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int x;
+			if( p->y == q->y ) continue;
+			if( p->y > q->y ) { RDPoint * t = p; p = q; q = t; }
+			if( y < p->y || y >= q->y ) continue;
+
+			//Nearest pixel to the crossing.
+			x = p->x + (int)CNFGDivFloor( 2 * (int64_t)( q->x - p->x ) * ( y - p->y ) + ( q->y - p->y ), 2 * ( q->y - p->y ) );
+			for( j = n++; j > 0 && xs[j-1] > x; j-- ) xs[j] = xs[j-1];
+			xs[j] = x;
+		}
+
+		for( i = 0; i + 1 < n; i += 2 )
 		{
-			(*CNFGBufferstart++) = CNFGLastColor;
+			int lo = ( xs[i] < 0 ) ? 0 : xs[i];
+			int hi = ( xs[i+1] >= CNFGBufferx ) ? CNFGBufferx - 1 : xs[i+1];
+			if( lo <= hi )
+				CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], hi - lo + 1, CNFGLastColor );
 		}
 	}
+
+	for( i = 0; i < verts; i++ )
+	{
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
+		CNFGTackSegment( points[i].x, points[i].y, q->x, q->y );
+	}
 }
 
+//Convex polygons: each edge is an edge function E(x,y) = A*x + B*y + C which
+//is >= 0 on the inside; per row, every edge bounds the span from one side,
+//at the nearest pixel to where it crosses the row.
 void CNFGTackPoly( RDPoint * points, int verts )
 {
-	short minx = 10000, miny = 10000;
-	short maxx =-10000, maxy =-10000;
-	short i, x, y;
+	int minx = 32767, miny = 32767;
+	int maxx =-32768, maxy =-32768;
+	int64_t area = 0;
+	int i, y;
 
 	//Just in case...
-	if( verts > 32767 ) return;
+	if( verts > 32767 || verts < 1 || !CNFGBuffer ) return;
 
 	for( i = 0; i < verts; i++ )
 	{
 		RDPoint * p = &points[i];
+		RDPoint * q = &points[(i+1==verts)?0:i+1];
 		if( p->x < minx ) minx = p->x;
 		if( p->y < miny ) miny = p->y;
 		if( p->x > maxx ) maxx = p->x;
 		if( p->y > maxy ) maxy = p->y;
+		area += (int64_t)p->x * q->y - (int64_t)q->x * p->y;
 	}
 
+	if( minx < 0 ) minx = 0;
 	if( miny < 0 ) miny = 0;
+	if( maxx >= CNFGBufferx ) maxx = CNFGBufferx-1;
 	if( maxy >= CNFGBuffery ) maxy = CNFGBuffery-1;
 
+	//Concave, self-intersecting or degenerate.
+	if( area == 0 || !CNFGPolyIsConvex( points, verts ) )
+	{
+		CNFGTackPolyScan( points, verts, miny, maxy );
+		return;
+	}
+
 	for( y = miny; y <= maxy; y++ )
 	{
-		short startfillx = maxx;
-		short endfillx = minx;
+		int64_t lo = minx, hi = maxx;
 
-		//Figure out what line segments intersect this line.
-		for( i = 0; i < verts; i++ )
+		for( i = 0; i < verts && lo <= hi; i++ )
 		{
-			short pl = i + 1;
-			if( pl == verts ) pl = 0;
-
-			RDPoint ptop;
-			RDPoint pbot;
+			RDPoint * p = &points[i];
+			RDPoint * q = &points[(i+1==verts)?0:i+1];
+			int64_t A = p->y - q->y;
+			int64_t R = (int64_t)( q->x - p->x ) * ( y - p->y ) - A * p->x; //B*y + C
+			if( area < 0 ) { A = -A; R = -R; }
 
-			ptop.x = points[i].x;
-			ptop.y = points[i].y;
-			pbot.x = points[pl].x;
-			pbot.y = points[pl].y;
-//printf( "Poly: %d %d\n", pbot.y, ptop.y );
-
-			if( pbot.y < ptop.y )
+			if( A > 0 )
 			{
-				RDPoint ptmp;
-				ptmp.x = pbot.x;
-				ptmp.y = pbot.y;
-				pbot.x = ptop.x;
-				pbot.y = ptop.y;
-				ptop.x = ptmp.x;
-				ptop.y = ptmp.y;
+				int64_t l = CNFGDivFloor( A - 2 * R, 2 * A );
+				if( l > lo ) lo = l;
 			}
-
-			//Make sure this line segment is within our range.
-//printf( "PT: %d %d %d\n", y, ptop.y, pbot.y );
-			if( ptop.y <= y && pbot.y >= y )
+			else if( A < 0 )
 			{
-				short diffy = pbot.y - ptop.y;
-				uint32_t placey = (uint32_t)(y - ptop.y)<<16;  //Scale by 16 so we can do integer math.
-				short diffx = pbot.x - ptop.x;
-				short isectx;
-
-				if( diffy == 0 )
-				{
-					if( pbot.x < ptop.x )
-					{
-						if( startfillx > pbot.x ) startfillx = pbot.x;
-						if( endfillx < ptop.x ) endfillx = ptop.x;
-					}
-					else
-					{
-						if( startfillx > ptop.x ) startfillx = ptop.x;
-						if( endfillx < pbot.x ) endfillx = pbot.x;
-					}
-				}
-				else
-				{
-					//Inner part is scaled by 65536, outer part must be scaled back.
-					isectx = (( (placey / diffy) * diffx + 32768 )>>16) + ptop.x;
-					if( isectx < startfillx ) startfillx = isectx;
-					if( isectx > endfillx ) endfillx = isectx;
-				}
-//printf( "R: %d %d %d\n", pbot.x, ptop.x, isectx );
+				int64_t h = CNFGDivFloor( 2 * R - A, -2 * A );
+				if( h < hi ) hi = h;
+			}
+			else if( R < 0 )
+			{
+				hi = lo - 1;
 			}
 		}
 
-//printf( "%d %d %d\n", y, startfillx, endfillx );
-
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBufferx - 1;
-		if( endfillx >= CNFGBufferx ) endfillx = CNFGBuffery - 1;
-		if( startfillx < 0 ) startfillx = 0;
-		if( startfillx < 0 ) startfillx = 0;
-
-		unsigned int * bufferstart = &CNFGBuffer[y * CNFGBufferx + startfillx];
-		for( x = startfillx; x <= endfillx; x++ )
-		{
-			(*bufferstart++) = CNFGLastColor;
-		}
+		if( lo <= hi )
+			CNFGFillSpan( &CNFGBuffer[y * CNFGBufferx + lo], (int)( hi - lo + 1 ), CNFGLastColor );
 	}
-//exit(1);
 }
 
 
 void CNFGClearFrame()
 {
-	int i, m;
 	uint32_t col = 0;
 	short x, y;
 	CNFGGetDimensions( &x, &y );
@@ -6495,12 +7546,8 @@ void CNFGClearFrame()
 		CNFGBuffer = malloc( x * y * 8 );
 	}
 
-	m = x * y;
 	col = CNFGColor( CNFGBGColor );
-	for( i = 0; i < m; i++ )
-	{
-		CNFGBuffer[i] = col;
-	}
+	CNFGFillSpan( CNFGBuffer, x * y, col );
 }
 
 void CNFGTackPixel( short x, short y )
@@ -6509,69 +7556,86 @@ void CNFGTackPixel( short x, short y )
 	CNFGBuffer[x+CNFGBufferx*y] = CNFGLastColor;
 }
 
+static uint32_t CNFGBlendPixel( uint32_t newm, uint32_t oldm )
+{
+	//Alpha blend.
+	int alfa = newm&0xff;
+	int onemalfa = 255-alfa;
+#ifdef __wasm__
+	uint32_t newv = 255<<0; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#elif defined( ANDROID ) || defined( __android__ )
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#elif defined( CNFGOGL ) //OGL, on X11
+	uint32_t newv = 255<<16; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+#else //X11
+	uint32_t newv = 255UL<<24; //Alpha, then RGB
+	newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
+	newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
+	newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+#endif
+	return newv;
+}
 
 void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h )
 {
-	int ox = x;
 	int stride = w;
-	if( w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
-	if( x < 0 ) { w += x; x = 0; }
-	if( y < 0 ) { h += y; y = 0; }
+	int x2, y2;
+	if( !CNFGBuffer || w <= 0 || h <= 0 || x >= CNFGBufferx || y >= CNFGBuffery ) return;
 
-	//Switch w,h to x2, y2
-	h += y;
-	w += x;
+	x2 = x + w;
+	y2 = y + h;
+	if( x < 0 ) { data -= x; x = 0; }
+	if( y < 0 ) { data -= y * stride; y = 0; }
+	if( x2 > CNFGBufferx ) x2 = CNFGBufferx;
+	if( y2 > CNFGBuffery ) y2 = CNFGBuffery;
+	if( x >= x2 || y >= y2 ) return;
+	w = x2 - x;
 
-	if( w >= CNFGBufferx ) { w = CNFGBufferx; }
-	if( h >= CNFGBuffery ) { h = CNFGBuffery; }
-
-
-	for( ; y < h-1; y++ )
+	for( ; y < y2; y++ )
 	{
-		x = ox;
-		uint32_t * indat = data;
+		const uint32_t * indat = data;
 		uint32_t * outdat = CNFGBuffer + y * CNFGBufferx + x;
-		for( ; x < w-1; x++ )
+		int i = 0;
+#if defined( CNFG_RASTER_SSE2 )
+		const __m128i amask = _mm_set1_epi32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
 		{
-			uint32_t newm = *(indat++);
-			uint32_t oldm = *(outdat);
-			if( (newm & 0xff) == 0xff )
-			{
-				*(outdat++) = newm;
-			}
+			__m128i v = _mm_loadu_si128( (const __m128i*)( indat + i ) );
+			if( _mm_movemask_epi8( _mm_cmpeq_epi32( _mm_and_si128( v, amask ), amask ) ) == 0xffff )
+				_mm_storeu_si128( (__m128i*)( outdat + i ), v );
 			else
-			{
-				//Alpha blend.
-				int alfa = newm&0xff;
-				int onemalfa = 255-alfa;
-#ifdef __wasm__
-				uint32_t newv = 255<<0; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-#elif defined( ANDROID ) || defined( __android__ )
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#elif defined( CNFGOGL ) //OGL, on X11
-				uint32_t newv = 255<<16; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>24)&0xff) * onemalfa + 128)>>8)<<24;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-#else //X11
-				uint32_t newv = 255UL<<24; //Alpha, then RGB
-				newv |= ((((newm>>24)&0xff) * alfa + ((oldm>>16)&0xff) * onemalfa + 128)>>8)<<16;
-				newv |= ((((newm>>16)&0xff) * alfa + ((oldm>>8)&0xff) * onemalfa + 128)>>8)<<8;
-				newv |= ((((newm>>8)&0xff) * alfa + ((oldm>>0)&0xff) * onemalfa + 128)>>8)<<0;
+				break;
+		}
+#elif defined( CNFG_RASTER_NEON )
+		const uint32x4_t amask = vdupq_n_u32( 0xff );
+		for( ; i + 4 <= w; i += 4 )
+		{
+			uint32x4_t v = vld1q_u32( indat + i );
+			uint64x2_t o = vreinterpretq_u64_u32( vceqq_u32( vandq_u32( v, amask ), amask ) );
+			if( ( vgetq_lane_u64( o, 0 ) & vgetq_lane_u64( o, 1 ) ) == ~(uint64_t)0 )
+				vst1q_u32( outdat + i, v );
+			else
+				break;
+		}
 #endif
-				*(outdat++) = newv;
-			}
+		for( ; i < w; i++ )
+		{
+			uint32_t newm = indat[i];
+			outdat[i] = ( (newm & 0xff) == 0xff ) ? newm : CNFGBlendPixel( newm, outdat[i] );
 		}
 		data += stride;
 	}
@@ -6894,6 +7958,29 @@ void CNFGDrawText( const char * text, short scale )
 	}
 }
 
+#if !defined( CNFG_BATCH ) || defined( CNFGRASTERIZER ) || defined( CNFGHTTP ) || defined( __wasm__ )
+void CNFGDrawTextCached( CNFGTextBlock * block, const char * text, short scale )
+{
+	CNFGDrawText( text, scale );
+}
+
+void CNFGFreeTextBlock( CNFGTextBlock * block ) { }
+#endif
+
+#if !defined( CNFGOGL ) || defined( __wasm__ ) || defined( CNFGHTTP )
+void CNFGDrawTextAtlas( const char * text, short scale )
+{
+	CNFGDrawText( text, scale );
+}
+#endif
+
+#if !defined( CNFGOGL ) || defined( CNFGRASTERIZER ) || defined( __wasm__ ) || defined( CNFGHTTP )
+void CNFGBlitImageRect( uint32_t * data, int x, int y, int w, int h, int rx, int ry, int rw, int rh )
+{
+	CNFGBlitImage( data, x, y, w, h );
+}
+#endif
+
 #ifndef FONT_CREATION_TOOL
 #ifdef _CNFG_FANCYFONT
 
@@ -7017,8 +8104,64 @@ uint32_t CNFGVertDataC[CNFG_BATCH];
 int CNFGVertPlace;
 static float wgl_last_width_over_2 = .5f;
 
+#ifdef CNFG_COMPACT_QUADS
+int CNFGCompactQuads;
+int CNFGQuadPlace;
+int16_t CNFGQuadDataV[CNFG_QUAD_BATCH*8];
+uint32_t CNFGQuadDataC[CNFG_QUAD_BATCH];
+
+static int16_t CNFGQuadFixed( float f )
+{
+	f *= (float)(1<<CNFG_QUAD_SUBPIXEL_BITS);
+	if( f > 32767.f ) return 32767;
+	if( f < -32767.f ) return -32767;
+	return (int16_t)( f < 0 ? f - 0.5f : f + 0.5f );
+}
+
+static int CNFGQuadInRange( const float * c )
+{
+	int i;
+	for( i = 0; i < 8; i++ )
+		if( !( c[i] > -CNFG_QUAD_MAXCOORD && c[i] < CNFG_QUAD_MAXCOORD ) ) return 0;
+	return 1;
+}
+#endif
+
+#if !defined( CNFGRASTERIZER ) && !defined( CNFGHTTP ) && !defined( __wasm__ )
+#define CNFG_TEXT_BLOCKS
+static CNFGTextBlock * CNFGRecordBlock;
+static void RecordQuad( float cx0, float cy0, float cx1, float cy1, float cx2, float cy2, float cx3, float cy3 );
+#endif
+
 static void EmitQuad( float cx0, float cy0, float cx1, float cy1, float cx2, float cy2, float cx3, float cy3 ) 
 {
+#ifdef CNFG_TEXT_BLOCKS
+	if( CNFGRecordBlock )
+	{
+		RecordQuad( cx0, cy0, cx1, cy1, cx2, cy2, cx3, cy3 );
+		return;
+	}
+#endif
+#ifdef CNFG_COMPACT_QUADS
+	if( CNFGCompactQuads )
+	{
+		const float c[8] = { cx0, cy0, cx1, cy1, cx2, cy2, cx3, cy3 };
+		if( CNFGQuadInRange( c ) )
+		{
+			//Triangles and quads are separate batches, flush to keep draw order.
+			if( CNFGVertPlace || CNFGQuadPlace >= CNFG_QUAD_BATCH ) CNFGFlushRender();
+			int16_t * qv = &CNFGQuadDataV[CNFGQuadPlace*8];
+			qv[0] = CNFGQuadFixed( cx0 ); qv[1] = CNFGQuadFixed( cy0 );
+			qv[2] = CNFGQuadFixed( cx1 ); qv[3] = CNFGQuadFixed( cy1 );
+			qv[4] = CNFGQuadFixed( cx2 ); qv[5] = CNFGQuadFixed( cy2 );
+			qv[6] = CNFGQuadFixed( cx3 ); qv[7] = CNFGQuadFixed( cy3 );
+			CNFGQuadDataC[CNFGQuadPlace++] = CNFGLastColor;
+			return;
+		}
+		//Too far out for the fixed point corners, clamping would bend it.
+		if( CNFGQuadPlace ) CNFGFlushRender();
+	}
+#endif
 	//Because quads are really useful, but it's best to keep them all triangles if possible.
 	//This lets us draw arbitrary quads.
 	if( CNFGVertPlace >= CNFG_BATCH-6 ) CNFGFlushRender();
@@ -7085,6 +8228,9 @@ void CNFGTackPoly( RDPoint * points, int verts )
 	int i;
 	int tris = verts-2;
 	if( CNFGVertPlace >= CNFG_BATCH-tris*3 ) CNFGFlushRender();
+#ifdef CNFG_COMPACT_QUADS
+	if( CNFGQuadPlace ) CNFGFlushRender();
+#endif
 
 	uint32_t color = CNFGLastColor;
 	short * ptrsrc =  (short*)points;
@@ -7120,15 +8266,168 @@ void	CNFGSetLineWidth( short width )
 
 #endif
 
+#ifdef CNFG_TEXT_BLOCKS
+#include <stdlib.h>
+#include <string.h>
 
-#if !defined( __wasm__ ) && !defined( CNFGHTTP )
-//In WASM, Javascript takes over this functionality.
-
-//Shader compilation errors go to stderr.
-#include <stdio.h>
+#ifdef CNFG_COMPACT_QUADS
+//Turns a compact block into triangles, for when a quad turns up that compact quads can't hold.
+static void CNFGTextBlockToTriangles( CNFGTextBlock * b )
+{
+	static const int corner[6] = { 0, 1, 2, 2, 1, 3 };
+	const float scale = 1.f/(1<<CNFG_QUAD_SUBPIXEL_BITS);
+	float * verts = (float*)malloc( ( b->count * 6 + 6 ) * 3 * sizeof( float ) );
+	uint32_t * colors = (uint32_t*)malloc( ( b->count * 6 + 6 ) * sizeof( uint32_t ) );
+	int i, j;
+	for( i = 0; i < b->count; i++ )
+	{
+		for( j = 0; j < 6; j++ )
+		{
+			float * fv = &verts[(i*6+j)*3];
+			fv[0] = b->quads[i*8+corner[j]*2+0] * scale;
+			fv[1] = b->quads[i*8+corner[j]*2+1] * scale;
+			fv[2] = 0;
+			colors[i*6+j] = b->colors[i];
+		}
+	}
+	free( b->quads );
+	free( b->colors );
+	free( b->verts );
+	b->quads = 0;
+	b->verts = verts;
+	b->colors = colors;
+	b->count *= 6;
+	b->capacity = b->count + 6;
+	b->compact = 0;
+}
+#endif
 
-#ifndef GL_VERTEX_SHADER
-#define GL_FRAGMENT_SHADER                0x8B30
+//Appends a quad to CNFGRecordBlock, in whichever format EmitQuad would have used.
+static void RecordQuad( float cx0, float cy0, float cx1, float cy1, float cx2, float cy2, float cx3, float cy3 )
+{
+	CNFGTextBlock * b = CNFGRecordBlock;
+#ifdef CNFG_COMPACT_QUADS
+	if( b->compact )
+	{
+		const float c[8] = { cx0, cy0, cx1, cy1, cx2, cy2, cx3, cy3 };
+		if( !CNFGQuadInRange( c ) ) CNFGTextBlockToTriangles( b );
+	}
+#endif
+	int per = b->compact ? 1 : 6;
+	if( b->count + per > b->capacity )
+	{
+		b->capacity = ( b->capacity + per ) * 2;
+		if( b->compact )
+			b->quads = (int16_t*)realloc( b->quads, b->capacity * 8 * sizeof( int16_t ) );
+		else
+			b->verts = (float*)realloc( b->verts, b->capacity * 3 * sizeof( float ) );
+		b->colors = (uint32_t*)realloc( b->colors, b->capacity * sizeof( uint32_t ) );
+	}
+#ifdef CNFG_COMPACT_QUADS
+	if( b->compact )
+	{
+		int16_t * qv = &b->quads[b->count*8];
+		qv[0] = CNFGQuadFixed( cx0 ); qv[1] = CNFGQuadFixed( cy0 );
+		qv[2] = CNFGQuadFixed( cx1 ); qv[3] = CNFGQuadFixed( cy1 );
+		qv[4] = CNFGQuadFixed( cx2 ); qv[5] = CNFGQuadFixed( cy2 );
+		qv[6] = CNFGQuadFixed( cx3 ); qv[7] = CNFGQuadFixed( cy3 );
+		b->colors[b->count++] = CNFGLastColor;
+		return;
+	}
+#endif
+	float * fv = &b->verts[b->count*3];
+	fv[0] = cx0; fv[1] = cy0; fv[2] = 0;
+	fv[3] = cx1; fv[4] = cy1; fv[5] = 0;
+	fv[6] = cx2; fv[7] = cy2; fv[8] = 0;
+	fv[9] = cx2; fv[10] = cy2; fv[11] = 0;
+	fv[12] = cx1; fv[13] = cy1; fv[14] = 0;
+	fv[15] = cx3; fv[16] = cy3; fv[17] = 0;
+	uint32_t * col = &b->colors[b->count];
+	uint32_t color = CNFGLastColor;
+	col[0] = color; col[1] = color; col[2] = color; col[3] = color; col[4] = color; col[5] = color;
+	b->count += 6;
+}
+
+void CNFGDrawTextCached( CNFGTextBlock * block, const char * text, short scale )
+{
+	int compact = 0;
+	int done;
+#ifdef CNFG_COMPACT_QUADS
+	compact = CNFGCompactQuads;
+#endif
+
+	if( !block->text || strcmp( block->text, text ) || block->scale != scale ||
+		block->penx != CNFGPenX || block->peny != CNFGPenY || block->color != CNFGLastColor ||
+		block->width != wgl_last_width_over_2 || block->quadmode != compact )
+	{
+		int len = strlen( text );
+		block->text = (char*)realloc( block->text, len + 1 );
+		memcpy( block->text, text, len + 1 );
+		block->scale = scale;
+		block->penx = CNFGPenX;
+		block->peny = CNFGPenY;
+		block->color = CNFGLastColor;
+		block->width = wgl_last_width_over_2;
+		block->quadmode = compact;
+		if( block->compact != compact ) block->capacity = 0; //Capacity was counted for the other array.
+		block->compact = compact;
+		block->count = 0;
+		CNFGRecordBlock = block;
+		CNFGDrawText( text, scale );
+		CNFGRecordBlock = 0;
+	}
+
+	for( done = 0; done < block->count; )
+	{
+		int n;
+#ifdef CNFG_COMPACT_QUADS
+		if( block->compact )
+		{
+			if( CNFGVertPlace || CNFGQuadPlace >= CNFG_QUAD_BATCH ) CNFGFlushRender();
+			n = block->count - done;
+			if( n > CNFG_QUAD_BATCH - CNFGQuadPlace ) n = CNFG_QUAD_BATCH - CNFGQuadPlace;
+			memcpy( &CNFGQuadDataV[CNFGQuadPlace*8], &block->quads[done*8], n * 8 * sizeof( int16_t ) );
+			memcpy( &CNFGQuadDataC[CNFGQuadPlace], &block->colors[done], n * sizeof( uint32_t ) );
+			CNFGQuadPlace += n;
+			done += n;
+			continue;
+		}
+		if( CNFGQuadPlace ) CNFGFlushRender();
+#endif
+		//Only ever split between whole quads.
+		n = ( CNFG_BATCH - CNFGVertPlace ) / 6 * 6;
+		if( n == 0 )
+		{
+			CNFGFlushRender();
+			continue;
+		}
+		if( n > block->count - done ) n = block->count - done;
+		memcpy( &CNFGVertDataV[CNFGVertPlace*3], &block->verts[done*3], n * 3 * sizeof( float ) );
+		memcpy( &CNFGVertDataC[CNFGVertPlace], &block->colors[done], n * sizeof( uint32_t ) );
+		CNFGVertPlace += n;
+		done += n;
+	}
+}
+
+void CNFGFreeTextBlock( CNFGTextBlock * block )
+{
+	free( block->text );
+	free( block->verts );
+	free( block->quads );
+	free( block->colors );
+	memset( block, 0, sizeof( *block ) );
+}
+#endif
+
+
+#if !defined( __wasm__ ) && !defined( CNFGHTTP )
+//In WASM, Javascript takes over this functionality.
+
+//Shader compilation errors go to stderr.
+#include <stdio.h>
+
+#ifndef GL_VERTEX_SHADER
+#define GL_FRAGMENT_SHADER                0x8B30
 #define GL_VERTEX_SHADER                  0x8B31
 #define GL_COMPILE_STATUS                 0x8B81
 #define GL_INFO_LOG_LENGTH                0x8B84
@@ -7140,6 +8439,10 @@ void	CNFGSetLineWidth( short width )
 #define LGLchar GLchar
 #endif
 
+#ifndef GL_TEXTURE0
+#define GL_TEXTURE0                       0x84C0
+#endif
+
 #if defined(WINDOWS) || defined(WIN32) || defined(WIN64) || defined(_WIN32) || defined(_WIN64)
 #define CNFGOGL_NEED_EXTENSION
 #include <GL/gl.h>
@@ -7190,6 +8493,26 @@ CHEWTYPEDEF( void, glUniform4f, , (location,v0,v1,v2,v3), GLint location, GLfloa
 CHEWTYPEDEF( void, glUniform1i, , (location,i0), GLint location, GLint i0 )
 CHEWTYPEDEF( void, glActiveTexture, , (texture), GLenum texture )
 
+#ifdef CNFGOGL_NEED_EXTENSION
+// Optional, for streaming batches through a buffer object ring instead of client-side arrays.
+CHEWTYPEDEF( void, glGenBuffers, , (n,buffers), GLsizei n, GLuint * buffers )
+CHEWTYPEDEF( void, glDeleteBuffers, , (n,buffers), GLsizei n, const GLuint * buffers )
+CHEWTYPEDEF( void, glBindBuffer, , (target,buffer), GLenum target, GLuint buffer )
+CHEWTYPEDEF( void, glBufferData, , (target,size,data,usage), GLenum target, intptr_t size, const void * data, GLenum usage )
+CHEWTYPEDEF( void, glBufferSubData, , (target,offset,size,data), GLenum target, intptr_t offset, intptr_t size, const void * data )
+CHEWTYPEDEF( void, glBufferStorage, , (target,size,data,flags), GLenum target, intptr_t size, const void * data, GLbitfield flags )
+CHEWTYPEDEF( void *, glMapBufferRange, return, (target,offset,length,access), GLenum target, intptr_t offset, intptr_t length, GLbitfield access )
+CHEWTYPEDEF( void *, glFenceSync, return, (condition,flags), GLenum condition, GLbitfield flags )
+CHEWTYPEDEF( GLenum, glClientWaitSync, return, (sync,flags,timeout), void * sync, GLbitfield flags, uint64_t timeout )
+CHEWTYPEDEF( void, glDeleteSync, , (sync), void * sync )
+CHEWTYPEDEF( GLboolean, glUnmapBuffer, return, (target), GLenum target )
+#ifdef CNFG_COMPACT_QUADS
+CHEWTYPEDEF( void, glDisableVertexAttribArray, , (index), GLuint index )
+CHEWTYPEDEF( void, glVertexAttribDivisor, , (index,divisor), GLuint index, GLuint divisor )
+CHEWTYPEDEF( void, glDrawElementsInstanced, , (mode,count,type,indices,instancecount), GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instancecount )
+#endif
+#endif
+
 #ifndef CNFGOGL_NEED_EXTENSION
 #define CNFGglGetUniformLocation glGetUniformLocation
 #define CNFGglEnableVertexAttribArray glEnableVertexAttribArray
@@ -7279,6 +8602,24 @@ static void CNFGLoadExtensionsInternal()
 	CNFGglUniform1i = (CNFGTYPEglUniform1i)CNFGGetProcAddress( "glUniform1i" );
 	CNFGglActiveTexture = (CNFGTYPEglActiveTexture)CNFGGetProcAddress("glActiveTexture");
 
+	// These are optional, without them batches go through client-side arrays.
+	CNFGglGenBuffers = (CNFGTYPEglGenBuffers)CNFGGetProcAddress( "glGenBuffers" );
+	CNFGglDeleteBuffers = (CNFGTYPEglDeleteBuffers)CNFGGetProcAddress( "glDeleteBuffers" );
+	CNFGglBindBuffer = (CNFGTYPEglBindBuffer)CNFGGetProcAddress( "glBindBuffer" );
+	CNFGglBufferData = (CNFGTYPEglBufferData)CNFGGetProcAddress( "glBufferData" );
+	CNFGglBufferSubData = (CNFGTYPEglBufferSubData)CNFGGetProcAddress( "glBufferSubData" );
+	CNFGglBufferStorage = (CNFGTYPEglBufferStorage)CNFGGetProcAddress( "glBufferStorage" );
+	CNFGglMapBufferRange = (CNFGTYPEglMapBufferRange)CNFGGetProcAddress( "glMapBufferRange" );
+	CNFGglFenceSync = (CNFGTYPEglFenceSync)CNFGGetProcAddress( "glFenceSync" );
+	CNFGglClientWaitSync = (CNFGTYPEglClientWaitSync)CNFGGetProcAddress( "glClientWaitSync" );
+	CNFGglDeleteSync = (CNFGTYPEglDeleteSync)CNFGGetProcAddress( "glDeleteSync" );
+	CNFGglUnmapBuffer = (CNFGTYPEglUnmapBuffer)CNFGGetProcAddress( "glUnmapBuffer" );
+#ifdef CNFG_COMPACT_QUADS
+	CNFGglDisableVertexAttribArray = (CNFGTYPEglDisableVertexAttribArray)CNFGGetProcAddress( "glDisableVertexAttribArray" );
+	CNFGglVertexAttribDivisor = (CNFGTYPEglVertexAttribDivisor)CNFGGetProcAddress( "glVertexAttribDivisor" );
+	CNFGglDrawElementsInstanced = (CNFGTYPEglDrawElementsInstanced)CNFGGetProcAddress( "glDrawElementsInstanced" );
+#endif
+
 	// Check if any of these functions didn't get loaded
 	uint8_t not_all_functions_loaded = 
 		!CNFGglGetUniformLocation  || !CNFGglEnableVertexAttribArray || !CNFGglUseProgram       ||
@@ -7385,6 +8726,8 @@ GLuint CNFGGLInternalLoadShader( const char * vertex_shader, const char * fragme
 
 	CNFGglBindAttribLocation(program, 0, "a0");
 	CNFGglBindAttribLocation(program, 1, "a1");
+	CNFGglBindAttribLocation(program, 2, "a2");
+	CNFGglBindAttribLocation(program, 3, "a3");
 
 	CNFGglLinkProgram(program);
 
@@ -7419,6 +8762,240 @@ fail:
 #define PRECISIONB
 #endif
 
+#ifdef CNFGOGL_NEED_EXTENSION
+#include <string.h>
+
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                   0x8892
+#endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW                    0x88E0
+#endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT                  0x0002
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT             0x0040
+#define GL_MAP_COHERENT_BIT               0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE     0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT        0x00000001
+#endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED                0x911B
+#define GL_WAIT_FAILED                    0x911D
+#endif
+
+// Batches are streamed through a ring of CNFG_VBO_SEGMENTS segments, each big
+// enough for one full batch.  If the buffer can be persistently mapped, each
+// segment gets a fence when we leave it and we wait on that fence before
+// writing into it again.  Otherwise the buffer is orphaned every time the
+// ring wraps, and the driver takes care of it.
+#ifndef CNFG_VBO_SEGMENTS
+#define CNFG_VBO_SEGMENTS 3
+#endif
+#define CNFG_VBO_SEGMENT_SIZE ( CNFG_BATCH * ( 3 * sizeof( float ) + sizeof( uint32_t ) ) )
+
+GLuint gRDVBO;
+uint8_t * gRDVBOMap;
+int gRDVBOHead;
+void * gRDVBOFences[CNFG_VBO_SEGMENTS];
+
+static void CNFGSetupVBOInternal()
+{
+	const int size = CNFG_VBO_SEGMENTS * CNFG_VBO_SEGMENT_SIZE;
+	const char * version = (const char*)glGetString( GL_VERSION );
+	const char * extensions = (const char*)glGetString( GL_EXTENSIONS );
+	int persistent;
+
+	if( !CNFGglGenBuffers || !CNFGglDeleteBuffers || !CNFGglBindBuffer || !CNFGglBufferData || !CNFGglBufferSubData )
+		return;
+
+	// Function pointers can resolve even if the context does not support them, so check for 4.4 or ARB_buffer_storage.
+	persistent = CNFGglBufferStorage && CNFGglMapBufferRange && CNFGglFenceSync && CNFGglClientWaitSync && CNFGglDeleteSync &&
+		( ( version && version[0] >= '0' && version[0] <= '9' && version[1] == '.' &&
+			( ( version[0] - '0' ) * 10 + ( version[2] - '0' ) ) >= 44 ) ||
+		( extensions && strstr( extensions, "GL_ARB_buffer_storage" ) ) );
+
+	CNFGglGenBuffers( 1, &gRDVBO );
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDVBO );
+	if( persistent )
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		CNFGglBufferStorage( GL_ARRAY_BUFFER, size, 0, flags );
+		gRDVBOMap = (uint8_t*)CNFGglMapBufferRange( GL_ARRAY_BUFFER, 0, size, flags );
+		if( !gRDVBOMap )
+		{
+			// Storage is immutable now, so start over with a fresh buffer to orphan.
+			CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+			CNFGglDeleteBuffers( 1, &gRDVBO );
+			CNFGglGenBuffers( 1, &gRDVBO );
+			CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDVBO );
+		}
+	}
+	if( !gRDVBOMap )
+		CNFGglBufferData( GL_ARRAY_BUFFER, size, 0, GL_STREAM_DRAW );
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+	gRDVBOHead = 0;
+}
+
+// Returns the offset into gRDVBO to write bytes at, or -1 if it will never fit.
+// Expects gRDVBO to be bound to GL_ARRAY_BUFFER.
+static int CNFGAllocVBOInternal( int bytes )
+{
+	int segment = gRDVBOHead / CNFG_VBO_SEGMENT_SIZE;
+	int ret;
+
+	if( bytes > (int)CNFG_VBO_SEGMENT_SIZE ) return -1;
+
+	if( gRDVBOHead + bytes > ( segment + 1 ) * (int)CNFG_VBO_SEGMENT_SIZE )
+	{
+		int next = ( segment + 1 ) % CNFG_VBO_SEGMENTS;
+		if( gRDVBOMap )
+		{
+			gRDVBOFences[segment] = CNFGglFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+			if( gRDVBOFences[next] )
+			{
+				// Only blocks if the GPU is more than CNFG_VBO_SEGMENTS-1 segments behind us.
+				// The segment can't be written until it signals, however long that takes.
+				GLenum r;
+				do
+					r = CNFGglClientWaitSync( gRDVBOFences[next], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ULL );
+				while( r == GL_TIMEOUT_EXPIRED );
+				if( r == GL_WAIT_FAILED ) glFinish();
+				CNFGglDeleteSync( gRDVBOFences[next] );
+				gRDVBOFences[next] = 0;
+			}
+		}
+		else if( next == 0 )
+		{
+			CNFGglBufferData( GL_ARRAY_BUFFER, CNFG_VBO_SEGMENTS * CNFG_VBO_SEGMENT_SIZE, 0, GL_STREAM_DRAW );
+		}
+		gRDVBOHead = next * CNFG_VBO_SEGMENT_SIZE;
+	}
+
+	ret = gRDVBOHead;
+	gRDVBOHead += ( bytes + 15 ) & ~15;
+	return ret;
+}
+#else
+static void CNFGSetupVBOInternal() { }
+#endif
+
+#ifdef CNFG_COMPACT_QUADS
+#ifndef GL_ELEMENT_ARRAY_BUFFER
+#define GL_ELEMENT_ARRAY_BUFFER           0x8893
+#endif
+#ifndef GL_STATIC_DRAW
+#define GL_STATIC_DRAW                    0x88E4
+#endif
+
+//Each quad is one instance, the static buffers only hold its two triangles.
+GLuint gRDQuadProg = -1;
+GLuint gRDQuadProgUX = -1;
+GLuint gRDQuadCornerVBO;
+GLuint gRDQuadIBO;
+
+static void CNFGSetupQuadsInternal()
+{
+#ifdef CNFGOGL_NEED_EXTENSION
+	static const float corners[4] = { 0, 1, 2, 3 };
+	static const uint16_t indices[6] = { 0, 1, 2, 2, 1, 3 };
+	const char * version = (const char*)glGetString( GL_VERSION );
+	const char * extensions = (const char*)glGetString( GL_EXTENSIONS );
+
+	if( !gRDVBO || !CNFGglDisableVertexAttribArray || !CNFGglVertexAttribDivisor || !CNFGglDrawElementsInstanced )
+		return;
+	if( !( version && version[0] >= '0' && version[0] <= '9' && version[1] == '.' &&
+			( ( version[0] - '0' ) * 10 + ( version[2] - '0' ) ) >= 33 ) &&
+		!( extensions && strstr( extensions, "GL_ARB_instanced_arrays" ) && strstr( extensions, "GL_ARB_draw_instanced" ) ) )
+		return;
+
+	gRDQuadProg = CNFGGLInternalLoadShader(
+		"uniform vec4 xfrm;"
+		"attribute float a0;" //Corner, 0..3
+		"attribute vec4 a1;"  //Color, per quad
+		"attribute vec4 a2;"  //Corners 0 and 1, per quad
+		"attribute vec4 a3;"  //Corners 2 and 3, per quad
+		"varying " PRECISIONA " vec4 vc;"
+		"void main() { vec4 p = ( a0 < 1.5 ) ? a2 : a3; vec2 c = ( mod( a0, 2.0 ) < 0.5 ) ? p.xy : p.zw;"
+		" gl_Position = vec4( c*xfrm.xy+xfrm.zw, 0.0, 0.5 ); vc = a1; }",
+
+		"varying " PRECISIONA " vec4 vc;"
+		"void main() { gl_FragColor = vec4(vc.abgr); }" 
+	);
+	if( gRDQuadProg == 0xFFFFFFFF ) return;
+	gRDQuadProgUX = CNFGglGetUniformLocation( gRDQuadProg, "xfrm" );
+
+	CNFGglGenBuffers( 1, &gRDQuadCornerVBO );
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDQuadCornerVBO );
+	CNFGglBufferData( GL_ARRAY_BUFFER, sizeof( corners ), corners, GL_STATIC_DRAW );
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+	CNFGglGenBuffers( 1, &gRDQuadIBO );
+	CNFGglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, gRDQuadIBO );
+	CNFGglBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof( indices ), indices, GL_STATIC_DRAW );
+	CNFGglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+	CNFGCompactQuads = 1;
+#endif
+}
+
+void CNFGEmitBackendQuads( const int16_t * corners, const uint32_t * colors, int num_quads )
+{
+#ifdef CNFGOGL_NEED_EXTENSION
+	const float scale = 1.f/(1<<CNFG_QUAD_SUBPIXEL_BITS);
+	int vbytes = num_quads * 8 * sizeof( int16_t );
+	int cbytes = num_quads * sizeof( uint32_t );
+	int offset;
+
+	CNFGglUseProgram( gRDQuadProg );
+	CNFGglUniform4f( gRDQuadProgUX, scale/gRDLastResizeW, -scale/gRDLastResizeH, -0.5f, 0.5f);
+
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDVBO );
+	offset = CNFGAllocVBOInternal( vbytes + cbytes );
+	if( offset < 0 )
+	{
+		CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+		return;
+	}
+	if( gRDVBOMap )
+	{
+		memcpy( gRDVBOMap + offset, corners, vbytes );
+		memcpy( gRDVBOMap + offset + vbytes, colors, cbytes );
+	}
+	else
+	{
+		CNFGglBufferSubData( GL_ARRAY_BUFFER, offset, vbytes, corners );
+		CNFGglBufferSubData( GL_ARRAY_BUFFER, offset + vbytes, cbytes, colors );
+	}
+	CNFGglVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (const GLvoid*)(intptr_t)( offset + vbytes ));
+	CNFGglVertexAttribPointer(2, 4, GL_SHORT, GL_FALSE, 16, (const GLvoid*)(intptr_t)offset);
+	CNFGglVertexAttribPointer(3, 4, GL_SHORT, GL_FALSE, 16, (const GLvoid*)(intptr_t)( offset + 8 ));
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDQuadCornerVBO );
+	CNFGglVertexAttribPointer(0, 1, GL_FLOAT, GL_FALSE, 0, 0);
+	CNFGglEnableVertexAttribArray( 2 );
+	CNFGglEnableVertexAttribArray( 3 );
+	CNFGglVertexAttribDivisor( 1, 1 );
+	CNFGglVertexAttribDivisor( 2, 1 );
+	CNFGglVertexAttribDivisor( 3, 1 );
+	CNFGglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, gRDQuadIBO );
+
+	CNFGglDrawElementsInstanced( GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0, num_quads );
+
+	//Put things back the way the rest of rawdraw expects them.
+	CNFGglVertexAttribDivisor( 1, 0 );
+	CNFGglVertexAttribDivisor( 2, 0 );
+	CNFGglVertexAttribDivisor( 3, 0 );
+	CNFGglDisableVertexAttribArray( 2 );
+	CNFGglDisableVertexAttribArray( 3 );
+	CNFGglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+#endif
+}
+#endif
+
 void CNFGSetupBatchInternal()
 {
 	short w, h;
@@ -7463,11 +9040,15 @@ void CNFGSetupBatchInternal()
 	CNFGglUseProgram( gRDBlitProg );
 	gRDBlitProgUX = CNFGglGetUniformLocation ( gRDBlitProg , "xfrm" );
 	gRDBlitProgUT = CNFGglGetUniformLocation ( gRDBlitProg , "tex" );
-	glGenTextures( 1, &gRDBlitProgTex );
 
 	CNFGglEnableVertexAttribArray(0);
 	CNFGglEnableVertexAttribArray(1);
 
+	CNFGSetupVBOInternal();
+#ifdef CNFG_COMPACT_QUADS
+	CNFGSetupQuadsInternal();
+#endif
+
 	glDisable(GL_DEPTH_TEST);
 	glDepthMask( GL_FALSE );
 	glEnable( GL_BLEND );
@@ -7494,6 +9075,36 @@ void	CNFGEmitBackendTriangles( const float * vertices, const uint32_t * colors,
 {
 	CNFGglUseProgram( gRDShaderProg );
 	CNFGglUniform4f( gRDShaderProgUX, 1.f/gRDLastResizeW, -1.f/gRDLastResizeH, -0.5f, 0.5f);
+#ifdef CNFGOGL_NEED_EXTENSION
+	if( gRDVBO )
+	{
+		int vbytes = num_vertices * 3 * sizeof( float );
+		int cbytes = num_vertices * sizeof( uint32_t );
+		int offset;
+		CNFGglBindBuffer( GL_ARRAY_BUFFER, gRDVBO );
+		offset = CNFGAllocVBOInternal( vbytes + cbytes );
+		if( offset >= 0 )
+		{
+			if( gRDVBOMap )
+			{
+				memcpy( gRDVBOMap + offset, vertices, vbytes );
+				memcpy( gRDVBOMap + offset + vbytes, colors, cbytes );
+			}
+			else
+			{
+				CNFGglBufferSubData( GL_ARRAY_BUFFER, offset, vbytes, vertices );
+				CNFGglBufferSubData( GL_ARRAY_BUFFER, offset + vbytes, cbytes, colors );
+			}
+			CNFGglVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, (const GLvoid*)(intptr_t)offset);
+			CNFGglVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, (const GLvoid*)(intptr_t)( offset + vbytes ));
+			glDrawArrays( GL_TRIANGLES, 0, num_vertices);
+			// Everybody else (CNFGBlitTex, user code) passes client-side pointers.
+			CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+			return;
+		}
+		CNFGglBindBuffer( GL_ARRAY_BUFFER, 0 );
+	}
+#endif
 	CNFGglVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, vertices);
 	CNFGglVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, colors);
 	glDrawArrays( GL_TRIANGLES, 0, num_vertices);
@@ -7513,7 +9124,7 @@ unsigned int CNFGTexImage( uint32_t *data, int w, int h )
 
 	glGenTextures(1, &tex);
 	glEnable( GL_TEXTURE_2D );
-	CNFGglActiveTexture( 0 );
+	CNFGglActiveTexture( GL_TEXTURE0 );
 	glBindTexture( GL_TEXTURE_2D, tex );
 
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
@@ -7554,6 +9165,187 @@ void CNFGBlitTex( unsigned int tex, int x, int y, int w, int h )
 	glDrawArrays( GL_TRIANGLES, 0, 6);
 }
 
+#ifndef CNFGRASTERIZER
+//Glyph atlas for CNFGDrawTextAtlas: a 16x16 grid of cells holding white
+//glyphs, drawn with the same strokes and line width as CNFGDrawText.
+GLuint gRDTextProg = -1;
+GLuint gRDTextProgUX = -1;
+GLuint gRDTextProgUT = -1;
+GLuint gRDTextProgUC = -1;
+GLuint gRDTextAtlasTex;
+short gRDTextAtlasScale;
+float gRDTextAtlasWidth;
+int gRDTextAtlasCell;
+int gRDTextAtlasPad;
+
+//Fills the pixels covered by one stroke, laid out like CNFGTackSegment's quads:
+//square ends reaching half a pixel past each end pixel, l2 to either side.
+static void CNFGAtlasStroke( uint32_t * atlas, int stride, int cx, int cy, int cell, float x1, float y1, float x2, float y2, float l2 )
+{
+	float dx = x2 - x1;
+	float dy = y2 - y1;
+	float len = cnfg_sqrtf( dx*dx + dy*dy );
+	int x, y;
+	if( len > 0 ) { dx /= len; dy /= len; }
+	else { dx = 1; dy = 0; }
+	for( y = 0; y < cell; y++ )
+	for( x = 0; x < cell; x++ )
+	{
+		float px = x - x1;
+		float py = y - y1;
+		float along = px * dx + py * dy;
+		float across = px * dy - py * dx;
+		if( along < -0.5f || along > len + 0.5f ) continue;
+		if( across < -l2 || across > l2 ) continue;
+		atlas[(cy+y)*stride+cx+x] = 0xffffffff;
+	}
+}
+
+static int CNFGBuildTextAtlas( short scale )
+{
+	int pad = (int)( wgl_last_width_over_2 + 1.5f );
+	int cell = 8 * scale + 2 * pad;
+	int size = cell * 16;
+	int c;
+	uint32_t * atlas;
+
+	if( size > 4096 ) return -1;
+	atlas = (uint32_t*)calloc( size * size, sizeof( uint32_t ) );
+	if( !atlas ) return -1;
+
+	for( c = 0; c < 256; c++ )
+	{
+		unsigned short index = RawdrawFontCharMap[c];
+		const unsigned char * lmap;
+		int cx = ( c & 15 ) * cell;
+		int cy = ( c >> 4 ) * cell;
+		float penx = 0, peny = 0;
+		unsigned char start_seg = 1;
+		unsigned char data;
+		if( index == 65535 ) continue;
+		lmap = &RawdrawFontCharData[index];
+		do
+		{
+			data = *(lmap++);
+			float x1 = (float)( ((data >> 4) & 0x07)*scale + pad );
+			float y1 = (float)( (data        & 0x07)*scale + pad );
+			if( start_seg )
+			{
+				penx = x1;
+				peny = y1;
+				start_seg = 0;
+				if( data & 0x08 )
+					CNFGAtlasStroke( atlas, size, cx, cy, cell, x1, y1, x1, y1, wgl_last_width_over_2 );
+			}
+			else
+			{
+				CNFGAtlasStroke( atlas, size, cx, cy, cell, penx, peny, x1, y1, wgl_last_width_over_2 );
+				penx = x1;
+				peny = y1;
+			}
+			if( data & 0x08 ) start_seg = 1;
+		} while( !( data & 0x80 ) );
+	}
+
+	if( gRDTextAtlasTex ) CNFGDeleteTex( gRDTextAtlasTex );
+	gRDTextAtlasTex = CNFGTexImage( atlas, size, size );
+	free( atlas );
+	gRDTextAtlasScale = scale;
+	gRDTextAtlasWidth = wgl_last_width_over_2;
+	gRDTextAtlasCell = cell;
+	gRDTextAtlasPad = pad;
+	return 0;
+}
+
+void CNFGDrawTextAtlas( const char * text, short scale )
+{
+	static float verts[6*2*256];
+	static float tcs[6*2*256];
+	float iox = (float)CNFGPenX;
+	float ioy = (float)CNFGPenY;
+	float inv;
+	int quads = 0;
+
+	if( gRDTextAtlasScale != scale || gRDTextAtlasWidth != wgl_last_width_over_2 || !gRDTextAtlasTex )
+	{
+		if( CNFGBuildTextAtlas( scale ) )
+		{
+			CNFGDrawText( text, scale );
+			return;
+		}
+	}
+	if( gRDTextProg == 0xFFFFFFFF )
+	{
+		gRDTextProg = CNFGGLInternalLoadShader(
+			"uniform vec4 xfrm;"
+			"attribute vec3 a0;"
+			"attribute vec4 a1;"
+			"varying " PRECISIONB " vec2 tc;"
+			"void main() { gl_Position = vec4( a0.xy*xfrm.xy+xfrm.zw, 0.0, 0.5 ); tc = a1.xy; }",
+
+			"varying " PRECISIONB " vec2 tc;"
+			"uniform sampler2D tex;"
+			"uniform " PRECISIONA " vec4 col;"
+			"void main() { gl_FragColor = texture2D(tex,tc)*col; }" );
+		CNFGglUseProgram( gRDTextProg );
+		gRDTextProgUX = CNFGglGetUniformLocation( gRDTextProg, "xfrm" );
+		gRDTextProgUT = CNFGglGetUniformLocation( gRDTextProg, "tex" );
+		gRDTextProgUC = CNFGglGetUniformLocation( gRDTextProg, "col" );
+	}
+
+	CNFGFlushRender();
+
+	CNFGglUseProgram( gRDTextProg );
+	CNFGglUniform4f( gRDTextProgUX, 1.f/gRDLastResizeW, -1.f/gRDLastResizeH, -0.5f, 0.5f );
+	CNFGglUniform1i( gRDTextProgUT, 0 );
+	CNFGglUniform4f( gRDTextProgUC,
+		((CNFGLastColor>>24)&0xff)/255.0f, ((CNFGLastColor>>16)&0xff)/255.0f,
+		((CNFGLastColor>>8)&0xff)/255.0f, (CNFGLastColor&0xff)/255.0f );
+	CNFGglActiveTexture( GL_TEXTURE0 );
+	glBindTexture( GL_TEXTURE_2D, gRDTextAtlasTex );
+	CNFGglVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, 0, verts );
+	CNFGglVertexAttribPointer( 1, 2, GL_FLOAT, GL_FALSE, 0, tcs );
+
+	inv = 1.0f / 16.0f;
+	for( ; ; text++ )
+	{
+		unsigned char c = *text;
+		if( quads == 256 || ( !c && quads ) )
+		{
+			glDrawArrays( GL_TRIANGLES, 0, quads * 6 );
+			quads = 0;
+		}
+		if( !c ) break;
+		if( c == 9 ) { iox += 12 * scale; continue; }
+		if( c == 10 ) { iox = (float)CNFGPenX; ioy += 6 * scale; continue; }
+		if( RawdrawFontCharMap[c] != 65535 )
+		{
+			float x0 = iox - gRDTextAtlasPad;
+			float y0 = ioy - gRDTextAtlasPad;
+			float x1 = x0 + gRDTextAtlasCell;
+			float y1 = y0 + gRDTextAtlasCell;
+			float u0 = ( c & 15 ) * inv;
+			float v0 = ( c >> 4 ) * inv;
+			float u1 = u0 + inv;
+			float v1 = v0 + inv;
+			float * fv = &verts[quads*12];
+			float * ft = &tcs[quads*12];
+			fv[0] = x0; fv[1] = y0; fv[2] = x1; fv[3] = y0; fv[4] = x0; fv[5] = y1;
+			fv[6] = x0; fv[7] = y1; fv[8] = x1; fv[9] = y0; fv[10] = x1; fv[11] = y1;
+			ft[0] = u0; ft[1] = v0; ft[2] = u1; ft[3] = v0; ft[4] = u0; ft[5] = v1;
+			ft[6] = u0; ft[7] = v1; ft[8] = u1; ft[9] = v0; ft[10] = u1; ft[11] = v1;
+			quads++;
+		}
+		iox += 3 * scale;
+	}
+}
+#else
+void CNFGDrawTextAtlas( const char * text, short scale )
+{
+	CNFGDrawText( text, scale );
+}
+#endif
+
 void CNFGSetScissors( int * xywh )
 {
 	CNFGFlushRender();
@@ -7569,25 +9361,168 @@ void CNFGGetScissors( int * xywh )
 
 #endif
 
-#ifdef CNFGRASTERIZER
-void CNFGBlitImageInternal( uint32_t * data, int x, int y, int w, int h )
-#else
-void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h )
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER            0x88EC
+#endif
+#ifndef GL_MAP_INVALIDATE_BUFFER_BIT
+#define GL_MAP_INVALIDATE_BUFFER_BIT      0x0008
 #endif
+
+// Blits keep one texture per size, so a size that repeats (like a software
+// rendered frame) is only ever updated with glTexSubImage2D.  The least
+// recently used size gets evicted.
+#ifndef CNFG_BLIT_CACHE
+#define CNFG_BLIT_CACHE 4
+#endif
+
+typedef struct
 {
-	glEnable( GL_TEXTURE_2D );
-	CNFGglActiveTexture( 0 );
-	glBindTexture( GL_TEXTURE_2D, gRDBlitProgTex );
+	GLuint tex;
+	int w, h;
+	const uint32_t * src; //What the texture currently holds.
+	unsigned lastuse;
+} CNFGBlitCacheEntry;
+
+CNFGBlitCacheEntry gRDBlitCache[CNFG_BLIT_CACHE];
+unsigned gRDBlitCacheTick;
+
+#ifdef CNFGOGL_NEED_EXTENSION
+// Uploads are staged through a ring of pixel unpack buffers, so the copy out
+// of data is done by the time we return and the GPU pulls it in on its own.
+#ifndef CNFG_BLIT_PBOS
+#define CNFG_BLIT_PBOS 3
+#endif
+
+GLuint gRDBlitPBO[CNFG_BLIT_PBOS];
+int gRDBlitPBOHead;
+int gRDBlitPBOState; // 0 = not checked, 1 = usable, -1 = not available
+
+static int CNFGBlitPBOUpload( const uint32_t * data, int stride, int rx, int ry, int rw, int rh )
+{
+	int row;
+	uint8_t * map;
+
+	if( gRDBlitPBOState == 0 )
+	{
+		const char * version = (const char*)glGetString( GL_VERSION );
+		const char * extensions = (const char*)glGetString( GL_EXTENSIONS );
+		gRDBlitPBOState = -1;
+		if( CNFGglGenBuffers && CNFGglBindBuffer && CNFGglBufferData && CNFGglMapBufferRange && CNFGglUnmapBuffer &&
+			( ( version && version[0] >= '0' && version[0] <= '9' && version[1] == '.' &&
+				( ( version[0] - '0' ) * 10 + ( version[2] - '0' ) ) >= 30 ) ||
+			( extensions && strstr( extensions, "GL_ARB_pixel_buffer_object" ) && strstr( extensions, "GL_ARB_map_buffer_range" ) ) ) )
+		{
+			CNFGglGenBuffers( CNFG_BLIT_PBOS, gRDBlitPBO );
+			gRDBlitPBOState = 1;
+		}
+	}
+	if( gRDBlitPBOState < 0 ) return -1;
+
+	CNFGglBindBuffer( GL_PIXEL_UNPACK_BUFFER, gRDBlitPBO[gRDBlitPBOHead] );
+	gRDBlitPBOHead = ( gRDBlitPBOHead + 1 ) % CNFG_BLIT_PBOS;
+
+	// Orphan first, so this never waits on the GPU still reading the last upload.
+	CNFGglBufferData( GL_PIXEL_UNPACK_BUFFER, rw * rh * 4, 0, GL_STREAM_DRAW );
+	map = (uint8_t*)CNFGglMapBufferRange( GL_PIXEL_UNPACK_BUFFER, 0, rw * rh * 4, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT );
+	if( !map )
+	{
+		CNFGglBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+		return -1;
+	}
+	for( row = 0; row < rh; row++ )
+		memcpy( map + row * rw * 4, data + ( ry + row ) * stride + rx, rw * 4 );
+	CNFGglUnmapBuffer( GL_PIXEL_UNPACK_BUFFER );
+
+	glTexSubImage2D( GL_TEXTURE_2D, 0, rx, ry, rw, rh, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+	CNFGglBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+	return 0;
+}
+#endif
+
+static CNFGBlitCacheEntry * CNFGBlitCacheGet( int w, int h )
+{
+	CNFGBlitCacheEntry * e = &gRDBlitCache[0];
+	int i;
+
+	gRDBlitCacheTick++;
+	for( i = 0; i < CNFG_BLIT_CACHE; i++ )
+	{
+		if( gRDBlitCache[i].tex && gRDBlitCache[i].w == w && gRDBlitCache[i].h == h )
+		{
+			e = &gRDBlitCache[i];
+			e->lastuse = gRDBlitCacheTick;
+			glBindTexture( GL_TEXTURE_2D, e->tex );
+			return e;
+		}
+		if( gRDBlitCache[i].lastuse < e->lastuse || !gRDBlitCache[i].tex ) e = &gRDBlitCache[i];
+	}
 
+	if( !e->tex ) glGenTextures( 1, &e->tex );
+	glBindTexture( GL_TEXTURE_2D, e->tex );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+	e->w = w;
+	e->h = h;
+	e->src = 0;
+	e->lastuse = gRDBlitCacheTick;
+	return e;
+}
 
-	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0,  GL_RGBA,
-		GL_UNSIGNED_BYTE, data );
+#ifdef CNFGRASTERIZER
+static void CNFGBlitImageRectInternal( uint32_t * data, int x, int y, int w, int h, int rx, int ry, int rw, int rh )
+#else
+void CNFGBlitImageRect( uint32_t * data, int x, int y, int w, int h, int rx, int ry, int rw, int rh )
+#endif
+{
+	CNFGBlitCacheEntry * e;
+
+	if( w <= 0 || h <= 0 ) return;
+
+	glEnable( GL_TEXTURE_2D );
+	CNFGglActiveTexture( GL_TEXTURE0 );
+	e = CNFGBlitCacheGet( w, h );
+
+	// The texture holds some other image, so all of it is out of date.
+	if( e->src != data )
+	{
+		rx = 0; ry = 0; rw = w; rh = h;
+	}
+	if( rx < 0 ) { rw += rx; rx = 0; }
+	if( ry < 0 ) { rh += ry; ry = 0; }
+	if( rx + rw > w ) rw = w - rx;
+	if( ry + rh > h ) rh = h - ry;
+
+	if( rw > 0 && rh > 0 )
+	{
+#ifdef CNFGOGL_NEED_EXTENSION
+		if( CNFGBlitPBOUpload( data, w, rx, ry, rw, rh ) )
+#endif
+		{
+			// Whole rows, since GLES2 has no GL_UNPACK_ROW_LENGTH.
+			glTexSubImage2D( GL_TEXTURE_2D, 0, 0, ry, w, rh, GL_RGBA,
+				GL_UNSIGNED_BYTE, data + ry * w );
+		}
+	}
+	e->src = data;
+	gRDBlitProgTex = e->tex;
+
+	CNFGBlitTex( e->tex, x, y, w, h );
+}
 
-	CNFGBlitTex( gRDBlitProgTex, x, y, w, h );
+#ifdef CNFGRASTERIZER
+void CNFGBlitImageInternal( uint32_t * data, int x, int y, int w, int h )
+{
+	CNFGBlitImageRectInternal( data, x, y, w, h, 0, 0, w, h );
 }
+#else
+void CNFGBlitImage( uint32_t * data, int x, int y, int w, int h )
+{
+	CNFGBlitImageRect( data, x, y, w, h, 0, 0, w, h );
+}
+#endif
 
 void CNFGUpdateScreenWithBitmap( uint32_t * data, int w, int h )
 {
@@ -7604,6 +9539,13 @@ void CNFGUpdateScreenWithBitmap( uint32_t * data, int w, int h )
 
 void CNFGFlushRender()
 {
+#ifdef CNFG_COMPACT_QUADS
+	if( CNFGQuadPlace )
+	{
+		CNFGEmitBackendQuads( CNFGQuadDataV, CNFGQuadDataC, CNFGQuadPlace );
+		CNFGQuadPlace = 0;
+	}
+#endif
 	if( !CNFGVertPlace ) return;
 	CNFGEmitBackendTriangles( CNFGVertDataV, CNFGVertDataC, CNFGVertPlace );
 	CNFGVertPlace = 0;
@@ -7642,6 +9584,13 @@ void CNFGFlushRender() { }
 
 #ifdef CNFG3D
 
+#if !defined( CNFG_NO_SIMD ) && ( defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 ) )
+	#define CNFG3D_SSE
+	#include <xmmintrin.h>
+#elif !defined( CNFG_NO_SIMD ) && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+	#define CNFG3D_NEON
+	#include <arm_neon.h>
+#endif
 
 #ifdef __wasm__
 double sin( double v );
@@ -8116,6 +10065,159 @@ void tdFinalPoint( float * pin, float * pout )
 //	printf( "XFORMFOut: %f %f %f\n", pout[0], pout[1], pout[2] );
 }
 
+#ifdef CNFG3D_SSE
+//Four packed xyz points <-> one register per axis.
+static inline void tdLoadSoA4( const float * p, __m128 * x, __m128 * y, __m128 * z )
+{
+	__m128 a = _mm_loadu_ps( p );     // x0 y0 z0 x1
+	__m128 b = _mm_loadu_ps( p + 4 ); // y1 z1 x2 y2
+	__m128 c = _mm_loadu_ps( p + 8 ); // z2 x3 y3 z3
+	*x = _mm_shuffle_ps( a, _mm_shuffle_ps( b, c, _MM_SHUFFLE( 1, 1, 2, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+	*y = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 1, 1 ) ), _mm_shuffle_ps( b, c, _MM_SHUFFLE( 2, 2, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+	*z = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 1, 1, 2, 2 ) ), _mm_shuffle_ps( c, c, _MM_SHUFFLE( 3, 3, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+}
+
+static inline void tdStoreSoA4( float * p, __m128 x, __m128 y, __m128 z )
+{
+	_mm_storeu_ps( p, _mm_shuffle_ps( _mm_shuffle_ps( x, y, 0 ), _mm_shuffle_ps( z, x, _MM_SHUFFLE( 1, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+	_mm_storeu_ps( p + 4, _mm_shuffle_ps( _mm_shuffle_ps( y, z, _MM_SHUFFLE( 1, 1, 1, 1 ) ), _mm_shuffle_ps( x, y, _MM_SHUFFLE( 2, 2, 2, 2 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+	_mm_storeu_ps( p + 8, _mm_shuffle_ps( _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 3, 2, 2 ) ), _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+}
+
+#define tdSSEROW( x, y, z, r ) \
+	_mm_add_ps( _mm_add_ps( _mm_add_ps( _mm_mul_ps( x, r[0] ), _mm_mul_ps( y, r[1] ) ), _mm_mul_ps( z, r[2] ) ), r[3] )
+#elif defined( CNFG3D_NEON )
+#define tdNEONROW( v, r ) \
+	vmlaq_f32( vmlaq_f32( vmlaq_f32( r[3], v.val[0], r[0] ), v.val[1], r[1] ), v.val[2], r[2] )
+#endif
+
+void tdPTransformArray( const float * pin, float * f, float * pout, int count )
+{
+	int i = 0;
+#if defined( CNFG3D_SSE )
+	__m128 r0[4] = { _mm_set1_ps( f[m00] ), _mm_set1_ps( f[m01] ), _mm_set1_ps( f[m02] ), _mm_set1_ps( f[m03] ) };
+	__m128 r1[4] = { _mm_set1_ps( f[m10] ), _mm_set1_ps( f[m11] ), _mm_set1_ps( f[m12] ), _mm_set1_ps( f[m13] ) };
+	__m128 r2[4] = { _mm_set1_ps( f[m20] ), _mm_set1_ps( f[m21] ), _mm_set1_ps( f[m22] ), _mm_set1_ps( f[m23] ) };
+	for( ; i + 4 <= count; i += 4 )
+	{
+		__m128 x, y, z;
+		tdLoadSoA4( pin + i*3, &x, &y, &z );
+		tdStoreSoA4( pout + i*3, tdSSEROW( x, y, z, r0 ), tdSSEROW( x, y, z, r1 ), tdSSEROW( x, y, z, r2 ) );
+	}
+#elif defined( CNFG3D_NEON )
+	float32x4_t r0[4] = { vdupq_n_f32( f[m00] ), vdupq_n_f32( f[m01] ), vdupq_n_f32( f[m02] ), vdupq_n_f32( f[m03] ) };
+	float32x4_t r1[4] = { vdupq_n_f32( f[m10] ), vdupq_n_f32( f[m11] ), vdupq_n_f32( f[m12] ), vdupq_n_f32( f[m13] ) };
+	float32x4_t r2[4] = { vdupq_n_f32( f[m20] ), vdupq_n_f32( f[m21] ), vdupq_n_f32( f[m22] ), vdupq_n_f32( f[m23] ) };
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float32x4x3_t v = vld3q_f32( pin + i*3 ), o;
+		o.val[0] = tdNEONROW( v, r0 );
+		o.val[1] = tdNEONROW( v, r1 );
+		o.val[2] = tdNEONROW( v, r2 );
+		vst3q_f32( pout + i*3, o );
+	}
+#endif
+	for( ; i < count; i++ )
+		tdPTransform( pin + i*3, f, pout + i*3 );
+}
+
+void tdFinalPointArray( const float * pin, float * pout, int count )
+{
+	float m[16];
+	int i = 0;
+	tdMultiply( gsMatricies[1][gsMPlace[1]], gsMatricies[0][gsMPlace[0]], m );
+#if defined( CNFG3D_SSE )
+	__m128 r0[4] = { _mm_set1_ps( m[m00] ), _mm_set1_ps( m[m01] ), _mm_set1_ps( m[m02] ), _mm_set1_ps( m[m03] ) };
+	__m128 r1[4] = { _mm_set1_ps( m[m10] ), _mm_set1_ps( m[m11] ), _mm_set1_ps( m[m12] ), _mm_set1_ps( m[m13] ) };
+	__m128 r2[4] = { _mm_set1_ps( m[m20] ), _mm_set1_ps( m[m21] ), _mm_set1_ps( m[m22] ), _mm_set1_ps( m[m23] ) };
+	__m128 r3[4] = { _mm_set1_ps( m[m30] ), _mm_set1_ps( m[m31] ), _mm_set1_ps( m[m32] ), _mm_set1_ps( m[m33] ) };
+	__m128 tx = _mm_set1_ps( translateX ), ty = _mm_set1_ps( translateY );
+	__m128 sx = _mm_set1_ps( scaleX ), sy = _mm_set1_ps( scaleY );
+	__m128 one = _mm_set1_ps( 1 );
+	for( ; i + 4 <= count; i += 4 )
+	{
+		__m128 x, y, z, iw;
+		tdLoadSoA4( pin + i*3, &x, &y, &z );
+		iw = _mm_div_ps( one, tdSSEROW( x, y, z, r3 ) );
+		tdStoreSoA4( pout + i*3,
+			_mm_mul_ps( _mm_sub_ps( _mm_mul_ps( tdSSEROW( x, y, z, r0 ), iw ), tx ), sx ),
+			_mm_mul_ps( _mm_sub_ps( _mm_mul_ps( tdSSEROW( x, y, z, r1 ), iw ), ty ), sy ),
+			_mm_mul_ps( tdSSEROW( x, y, z, r2 ), iw ) );
+	}
+#elif defined( CNFG3D_NEON )
+	float32x4_t r0[4] = { vdupq_n_f32( m[m00] ), vdupq_n_f32( m[m01] ), vdupq_n_f32( m[m02] ), vdupq_n_f32( m[m03] ) };
+	float32x4_t r1[4] = { vdupq_n_f32( m[m10] ), vdupq_n_f32( m[m11] ), vdupq_n_f32( m[m12] ), vdupq_n_f32( m[m13] ) };
+	float32x4_t r2[4] = { vdupq_n_f32( m[m20] ), vdupq_n_f32( m[m21] ), vdupq_n_f32( m[m22] ), vdupq_n_f32( m[m23] ) };
+	float32x4_t r3[4] = { vdupq_n_f32( m[m30] ), vdupq_n_f32( m[m31] ), vdupq_n_f32( m[m32] ), vdupq_n_f32( m[m33] ) };
+	float32x4_t tx = vdupq_n_f32( translateX ), ty = vdupq_n_f32( translateY );
+	float32x4_t sx = vdupq_n_f32( scaleX ), sy = vdupq_n_f32( scaleY );
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float32x4x3_t v = vld3q_f32( pin + i*3 ), o;
+		float32x4_t w = tdNEONROW( v, r3 );
+		//Reciprocal estimate plus two Newton steps, close enough to a divide for pixels.
+		float32x4_t iw = vrecpeq_f32( w );
+		iw = vmulq_f32( iw, vrecpsq_f32( w, iw ) );
+		iw = vmulq_f32( iw, vrecpsq_f32( w, iw ) );
+		o.val[0] = vmulq_f32( vsubq_f32( vmulq_f32( tdNEONROW( v, r0 ), iw ), tx ), sx );
+		o.val[1] = vmulq_f32( vsubq_f32( vmulq_f32( tdNEONROW( v, r1 ), iw ), ty ), sy );
+		o.val[2] = vmulq_f32( tdNEONROW( v, r2 ), iw );
+		vst3q_f32( pout + i*3, o );
+	}
+#endif
+	for( ; i < count; i++ )
+	{
+		float tdin[4] = { pin[i*3+0], pin[i*3+1], pin[i*3+2], 1. };
+		float tmp[4];
+		td4Transform( tdin, m, tmp );
+		pout[i*3+0] = (tmp[0]/tmp[3] - translateX) * scaleX;
+		pout[i*3+1] = (tmp[1]/tmp[3] - translateY) * scaleY;
+		pout[i*3+2] = tmp[2]/tmp[3];
+	}
+}
+
+#if !defined( CNFGCONTEXTONLY ) && !defined( CNFGHTTPSERVERONLY )
+#define tdTACKCHUNK 128
+#define tdINDEPTH( z ) ( (z) >= -1 && (z) <= 1 ) //Also rejects the NaNs from w == 0.
+#define tdINSHORT( v ) ( (v) >= -32768.f && (v) < 32768.f ) //Converting anything else to short is undefined.
+#define tdONSCREEN( p ) ( tdINDEPTH( (p)[2] ) && tdINSHORT( (p)[0] ) && tdINSHORT( (p)[1] ) )
+
+void tdTackSegments( const float * pin, int segments )
+{
+	float pt[tdTACKCHUNK*3];
+	int n = segments * 2;
+	int i, j;
+	for( i = 0; i < n; i += tdTACKCHUNK )
+	{
+		int c = ( n - i < tdTACKCHUNK ) ? n - i : tdTACKCHUNK;
+		tdFinalPointArray( pin + i*3, pt, c );
+		for( j = 0; j < c; j += 2 )
+		{
+			float * a = pt + j*3;
+			float * b = a + 3;
+			if( !tdONSCREEN( a ) || !tdONSCREEN( b ) ) continue;
+			CNFGTackSegment( a[0], a[1], b[0], b[1] );
+		}
+	}
+}
+
+void tdTackPoly( const float * pin, int verts )
+{
+	float pt[tdPOLYMAXVERTS*3];
+	RDPoint rp[tdPOLYMAXVERTS];
+	int i;
+	if( verts < 3 || verts > tdPOLYMAXVERTS ) return;
+	tdFinalPointArray( pin, pt, verts );
+	for( i = 0; i < verts; i++ )
+	{
+		if( !tdONSCREEN( pt + i*3 ) ) return;
+		rp[i].x = pt[i*3+0];
+		rp[i].y = pt[i*3+1];
+	}
+	CNFGTackPoly( rp, verts );
+}
+#endif
+
 
 
 
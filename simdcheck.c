@@ -0,0 +1,121 @@
+// Checks the SSE2/NEON matrix utilities in tsopenxr against the plain C
+// reference versions.  Run "make check".  No window or headset is needed.
+//
+// (C) 2022 Charles Lohr (under the MIT/x11 license)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "os_generic.h"
+
+#define CNFGOGL
+#define CNFGOGL_NEED_EXTENSION
+#define CNFG_IMPLEMENTATION
+#include "rawdraw_sf.h"
+
+#define TSOPENXR_IMPLEMENTATION
+#include "tsopenxr.h"
+
+#define ITERATIONS 200000
+
+// Allowed difference in units in the last place.  The SSE2 path matches
+// bit-for-bit, but compilers may contract the scalar code into FMAs on ARM.
+#define MAX_ULPS 8
+
+int failures;
+int worstUlps;
+
+static float RandF( float scale )
+{
+	return ( rand() / (float)RAND_MAX * 2.0f - 1.0f ) * scale;
+}
+
+static int UlpDistance( float a, float b )
+{
+	int32_t ia, ib;
+	if( a == b ) return 0;
+	memcpy( &ia, &a, 4 );
+	memcpy( &ib, &b, 4 );
+	if( ia < 0 ) ia = 0x80000000 - ia;
+	if( ib < 0 ) ib = 0x80000000 - ib;
+	int64_t d = (int64_t)ia - ib;
+	if( d < 0 ) d = -d;
+	return d > 0x7fffffff ? 0x7fffffff : (int)d;
+}
+
+static void Compare( const char * what, const float * simd, const float * scalar )
+{
+	int i;
+	for( i = 0; i < 16; i++ )
+	{
+		int ulps = UlpDistance( simd[i], scalar[i] );
+		// Values that cancel to almost zero can be many ulps apart and still be fine.
+		if( ulps > MAX_ULPS && fabsf( simd[i] - scalar[i] ) > 1e-5f )
+		{
+			if( failures++ < 10 )
+				printf( "%s [%d]: %.9g (SIMD) != %.9g (scalar)\n", what, i, simd[i], scalar[i] );
+		}
+		if( ulps > worstUlps && ulps <= MAX_ULPS ) worstUlps = ulps;
+	}
+}
+
+int main()
+{
+	int it, i;
+
+#if TSO_SIMD_SSE2
+	printf( "Checking SSE2 matrix utilities against scalar.\n" );
+#elif TSO_SIMD_NEON
+	printf( "Checking NEON matrix utilities against scalar.\n" );
+#else
+	printf( "No SIMD path compiled in, only the scalar versions are being run.\n" );
+#endif
+
+	for( it = 0; it < ITERATIONS; it++ )
+	{
+		XrPosef pose;
+		XrQuaternionf * q = &pose.orientation;
+		float simd[16], scalar[16], pm[16], inv[16], m[16];
+
+		q->x = RandF( 1 ); q->y = RandF( 1 ); q->z = RandF( 1 ); q->w = RandF( 1 );
+		float n = sqrtf( q->x*q->x + q->y*q->y + q->z*q->z + q->w*q->w );
+		if( n < 1e-3f ) continue;
+		q->x /= n; q->y /= n; q->z /= n; q->w /= n;
+		pose.position.x = RandF( 10 );
+		pose.position.y = RandF( 10 );
+		pose.position.z = RandF( 10 );
+
+		tsoUtilInitPoseMat( simd, &pose );
+		tsoUtilInitPoseMatScalar( scalar, &pose );
+		Compare( "tsoUtilInitPoseMat", simd, scalar );
+
+		// Feed both inverses the same input so errors don't compound.
+		memcpy( pm, scalar, sizeof( pm ) );
+		tsoInvertOrthogonalMat( simd, pm );
+		tsoInvertOrthogonalMatScalar( scalar, pm );
+		Compare( "tsoInvertOrthogonalMat", simd, scalar );
+		memcpy( inv, scalar, sizeof( inv ) );
+
+		for( i = 0; i < 16; i++ ) m[i] = RandF( 5 );
+		tsoMultiplyMat( simd, m, inv );
+		tsoMultiplyMatScalar( scalar, m, inv );
+		Compare( "tsoMultiplyMat", simd, scalar );
+	}
+
+	if( failures )
+	{
+		printf( "FAILED: %d mismatches\n", failures );
+		return 1;
+	}
+	printf( "OK: %d iterations, worst difference %d ulp\n", ITERATIONS, worstUlps );
+	return 0;
+}
+
+//For rawdraw (we don't use this)
+void HandleKey( int keycode, int bDown ) { }
+void HandleButton( int x, int y, int button, int bDown ) { }
+void HandleMotion( int x, int y, int mask ) { }
+int HandleDestroy() { return 0; }
@@ -0,0 +1,129 @@
+// CPU-only example for tsopenxr.
+// Every view is rasterized on the CPU by the tile-binned software rasterizer
+// and then streamed into the swapchain images.  No shaders, no draw calls.
+//
+// (C) 2022 Charles Lohr (under the MIT/x11 license)
+//
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "os_generic.h"
+
+#define CNFGOGL
+#define CNFGOGL_NEED_EXTENSION
+#define CNFG_IMPLEMENTATION
+#include "rawdraw_sf.h"
+
+#define TSOPENXR_ENABLE_SOFTRASTER 1
+#define TSOPENXR_IMPLEMENTATION
+#include "tsopenxr.h"
+
+#ifndef GL_MAJOR_VERSION
+#define GL_MAJOR_VERSION   0x821B
+#define GL_MINOR_VERSION   0x821C
+#endif
+
+#define SOFTRASTER_THREADS 4
+
+tsoContext TSO;
+tsoSoftRaster SR;
+int frameNumber;
+
+int RenderLayer( tsoContext * ctx, XrTime predictedDisplayTime, XrCompositionLayerProjectionView * projectionLayerViews, int viewCountOutput )
+{
+	int w = projectionLayerViews[0].subImage.imageRect.extent.width;
+	int h = projectionLayerViews[0].subImage.imageRect.extent.height;
+	int v, i;
+
+	if( tsoSoftRasterBegin( &SR, viewCountOutput, w, h ) ) return -1;
+
+	// Things drawn while the view is -1 go to all views.
+	tsoSoftRasterSetView( &SR, -1 );
+	tsoSoftRasterClear( &SR, 0x101030ff );
+
+	tsoSoftRasterColor( &SR, 0x404060ff );
+	for( i = 0; i < w; i += 32 )
+		tsoSoftRasterSegment( &SR, i, 0, i, h-1 );
+	for( i = 0; i < h; i += 32 )
+		tsoSoftRasterSegment( &SR, 0, i, w-1, i );
+
+	// Offset the content a little per eye so there is something to fuse.
+	for( v = 0; v < viewCountOutput; v++ )
+	{
+		int cx = w/2 + ( v ? -8 : 8 );
+		int cy = h/2;
+		float a = frameNumber * 0.02f;
+		tsoSoftRasterSetView( &SR, v );
+		tsoSoftRasterColor( &SR, 0xff8020ff );
+		tsoSoftRasterTriangle( &SR,
+			cx + cosf( a ) * 200, cy + sinf( a ) * 200,
+			cx + cosf( a + 2.094f ) * 200, cy + sinf( a + 2.094f ) * 200,
+			cx + cosf( a + 4.189f ) * 200, cy + sinf( a + 4.189f ) * 200 );
+		tsoSoftRasterColor( &SR, 0x20ff20ff );
+		tsoSoftRasterRectangle( &SR, cx - 20, cy - 20, cx + 20, cy + 20 );
+	}
+
+	tsoSoftRasterFinish( &SR );
+	frameNumber++;
+
+	return tsoSoftRasterSubmit( ctx, &SR, projectionLayerViews, viewCountOutput );
+}
+
+
+int main()
+{
+	int r;
+
+	// Tell windows we want to use VT100 terminal color codes.
+	#ifdef USE_WINDOWS
+	system("");
+	#endif
+
+	CNFGSetup( "TSOpenXR Software Raster Example", -1, -1 );
+
+	int32_t major = 0;
+	int32_t minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+
+	if( ( r = tsoInitialize( &TSO, major, minor, TSO_DO_DEBUG, "TSOpenXR Software Raster Example", 0 ) ) ) return r;
+
+	TSO.tsoRenderLayer = RenderLayer;
+
+	if ( ( r = tsoDefaultCreateActions( &TSO ) ) ) return r;
+
+	tsoSoftRasterCreate( &SR, SOFTRASTER_THREADS );
+
+	while ( CNFGHandleInput() )
+	{
+		tsoHandleLoop( &TSO );
+
+		if (!TSO.tsoSessionReady)
+		{
+			OGUSleep(100000);
+			continue;
+		}
+
+		if ( ( r = tsoSyncInput( &TSO ) ) )
+		{
+			return r;
+		}
+
+		if ( ( r = tsoRenderFrame( &TSO ) ) )
+		{
+			return r;
+		}
+	}
+
+	tsoSoftRasterDestroy( &SR );
+	return tsoTeardown( &TSO );
+}
+
+//For rawdraw (we don't use this)
+void HandleKey( int keycode, int bDown ) { }
+void HandleButton( int x, int y, int button, int bDown ) { }
+void HandleMotion( int x, int y, int mask ) { }
+int HandleDestroy() { return 0; }
@@ -36,6 +36,12 @@
 #define XR_USE_PLATFORM_XLIB
 #endif
 
+#ifndef USE_WINDOWS
+// For XR_KHR_convert_timespec_time.
+#include <time.h>
+#define XR_USE_TIMESPEC
+#endif
+
 #include "openxr/openxr.h"
 #include "openxr/openxr_platform.h"
 
@@ -53,12 +59,195 @@ typedef struct
 	int32_t height;
 } tsoSwapchainInfo;
 
+// Swapchains are pooled by ( format, width, height, arraySize, sampleCount ) so switching
+// back to a configuration we've seen before does not stall on creation.
+typedef struct
+{
+	XrSwapchain handle;
+	int64_t format;
+	int32_t width;
+	int32_t height;
+	uint32_t arraySize;
+	uint32_t sampleCount;
+	uint32_t length;
+	XrSwapchainImageOpenGLKHR * images; //[length]
+	int inUse;
+	uint32_t lastUsed;
+} tsoSwapchainPoolEntry;
+
+// Most views any view configuration we support can have.
+#ifndef TSO_MAX_VIEWS
+#define TSO_MAX_VIEWS 4
+#endif
+
+// How many frames of GPU timer queries are in flight before we give up on the oldest.
+// Must be at least 3 so results can be read back without waiting on the GPU.
+#ifndef TSO_GPU_TIMER_FRAMES
+#define TSO_GPU_TIMER_FRAMES 4
+#endif
+
+typedef struct
+{
+	// CPU time of each stage of the last tsoRenderFrame, in seconds.
+	double cpuWaitFrame;
+	double cpuBeginFrame;
+	double cpuRender; // tsoRenderLayer callback
+	double cpuEndFrame;
+	double cpuTotal;
+
+	// GPU time from TSO_GPU_TIMING, in seconds.  These trail the CPU numbers by a
+	// couple of frames; gpuFrameNumber says which frame they belong to.
+	double gpuRender;
+	double gpuView[TSO_MAX_VIEWS];
+	int gpuViewCount;
+	int gpuFrameNumber;
+
+	// From the fence inserted after each tsoRenderLayer, for the newest frame the GPU
+	// is known to have finished (gpuDoneFrameNumber).  Completion is timestamped on the
+	// GPU when timer queries exist, otherwise it is when a poll first saw the fence,
+	// which can be up to a frame late.  A gpuLatency close to the frame interval with
+	// gpuQueueDepth of 2 or more means GPU bound; a short gpuLatency means CPU bound.
+	double gpuDoneAfterBegin; // GPU finished, seconds after xrBeginFrame returned.
+	double gpuDoneBeforeDisplay; // Slack before predictedDisplayTime, negative if late.  Needs the runtime to convert XrTime.
+	double gpuLatency; // From the end of tsoRenderLayer to the GPU finishing.
+	int gpuQueueDepth; // Frames submitted that the GPU had not finished at the last poll.
+	int gpuDoneFrameNumber;
+
+	// Frames that kept the early matrices because the GPU still had the late latch slot, or
+	// had already reached the frame's draws when the late pose came in, in total.
+	int lateLatchSkipped;
+} tsoFrameStats;
+
+typedef struct
+{
+	uint32_t queries[TSO_GPU_TIMER_FRAMES][TSO_MAX_VIEWS+2]; // Timestamps: start, one per view mark, end.
+	int8_t markView[TSO_GPU_TIMER_FRAMES][TSO_MAX_VIEWS+2];
+	int numMarks[TSO_GPU_TIMER_FRAMES];
+	int frameNumber[TSO_GPU_TIMER_FRAMES];
+	int pending[TSO_GPU_TIMER_FRAMES];
+	int active; // Slot+1 while inside the render callback.
+} tsoGPUTimer;
+
+// Fences in flight for GPU completion tracking.  A frame that takes longer than this
+// many frames to finish on the GPU is dropped from the stats.
+#ifndef TSO_FRAME_FENCES
+#define TSO_FRAME_FENCES 4
+#endif
+
+// Seconds between readings of the GPU clock, which each wait for the GPU.  The clocks
+// drift apart only slowly.
+#ifndef TSO_GPU_CLOCK_RECALIBRATE
+#define TSO_GPU_CLOCK_RECALIBRATE 5.0
+#endif
+
+typedef struct
+{
+	void * sync;
+	uint32_t query;
+	int timed; // query and gpuClockOffset are valid.
+	int frameNumber;
+	double beginTime;
+	double submitTime;
+	double displayTime; // 0 if the runtime cannot convert XrTime.
+	double gpuClockOffset; // Add to GPU seconds to get OGGetAbsoluteTime.  From the last calibration.
+} tsoFrameFence;
+
+// A texture you can render into, with an optional depth buffer.
+typedef struct
+{
+	uint32_t fbo;
+	uint32_t color;
+	uint32_t depth;
+	int width;
+	int height;
+} tsoRenderTarget;
+
+#if defined( _MSC_VER )
+#define TSO_ALIGN( x ) __declspec( align( x ) )
+#else
+#define TSO_ALIGN( x ) __attribute__(( aligned( x ) ))
+#endif
+
+// Everything a view needs to render, computed once per frame by tsoRenderFrame.
+// Column-major, OpenGL clip space.
+typedef struct TSO_ALIGN( 16 )
+{
+	float proj[16];
+	float view[16];
+	float invView[16]; // The view's pose.
+	float viewProj[16];
+} tsoViewMatrices;
+
+typedef struct
+{
+	XrFovf fov;
+	float nearZ;
+	float farZ;
+	int reverseZ;
+	int valid;
+} tsoProjectionCacheKey;
+
+// Ring slots for late-latched matrices; one is written while the GPU may still read the others.
+#ifndef TSO_LATE_LATCH_SLOTS
+#define TSO_LATE_LATCH_SLOTS 3
+#endif
+
+// Uniform buffer binding point the late-latch block is bound to.
+#ifndef TSO_LATE_LATCH_BINDING
+#define TSO_LATE_LATCH_BINDING 1
+#endif
+
+// Planes are { a, b, c, d } with a*x + b*y + c*z + d >= 0 inside.  Left, right, down, up, near, far.
+typedef struct
+{
+	float planes[6][4];
+} tsoFrustum;
+
 struct tsoContext_t;
 
 // return zero to indicate layer submissions are good.
 // Nonzero will be a "no-render" for the layer.
 typedef int (*tsoRenderLayerFunction_t)(struct tsoContext_t * ctx, XrTime predictedDisplayTime, XrCompositionLayerProjectionView * projectionLayerViews, int viewCountOutput );
 
+// Same, but also gets matrices[viewCountOutput] from tsoComputeViewMatrices.  Used instead of tsoRenderLayer if set.
+typedef int (*tsoRenderLayerExFunction_t)(struct tsoContext_t * ctx, XrTime predictedDisplayTime, XrCompositionLayerProjectionView * projectionLayerViews, const tsoViewMatrices * matrices, int viewCountOutput );
+
+// Most quad layers that can be registered at once.
+#ifndef TSO_MAX_QUAD_LAYERS
+#define TSO_MAX_QUAD_LAYERS 8
+#endif
+
+struct tsoQuadLayer_t;
+
+// Draws a quad layer's content.  The layer's image is bound as the framebuffer with the
+// viewport set to width x height; both are put back afterwards.  Nonzero keeps showing the
+// previous image, if there is one, and leaves the layer dirty so it is tried again next frame.
+typedef int (*tsoQuadLayerRenderFunction_t)(struct tsoContext_t * ctx, struct tsoQuadLayer_t * ql );
+
+typedef struct tsoQuadLayer_t
+{
+	// Where it is, in stage space, and its size in meters.  Free to change every frame.
+	XrPosef pose;
+	float sizeX, sizeY;
+	int visible;
+	XrCompositionLayerFlags layerFlags; // Defaults to XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT.
+
+	// Set dirty to have render called again on the next tsoRenderFrame.  Changing the
+	// resolution also needs dirty set.
+	int width, height;
+	int dirty;
+	tsoQuadLayerRenderFunction_t render;
+	void * opaque;
+
+	// For content redrawn every second or so, like live stats.  The layer then keeps an
+	// ordinary swapchain and each redraw renders into its next image, instead of creating
+	// a new static image every time.  A render that fails still shows what it drew.
+	int dynamic;
+
+	XrSwapchain swapchain;
+	int swapchainWidth, swapchainHeight, swapchainDynamic; // What swapchain was created for.
+} tsoQuadLayer;
+
 typedef struct tsoContext_t
 {
 	XrExtensionProperties * tsoExtensionProps;
@@ -66,7 +255,16 @@ typedef struct tsoContext_t
 	XrApiLayerProperties * tsoLayerProps;
 	int tsoNumLayerProps;
 	XrViewConfigurationView * tsoViewConfigs;
-	int tsoNumViewConfigs;
+	int tsoNumViewConfigs; // Views rendered each frame, including software insets.
+
+	// PRIMARY_STEREO, or PRIMARY_QUAD_VARJO for TSO_QUAD_VIEWS on runtimes that have it.
+	XrViewConfigurationType tsoViewConfigType;
+	// TSO_QUAD_VIEWS without runtime support: an inset view is made for each view, narrowed to
+	// tsoInsetFraction of its field of view around straight ahead.  The wide views are rendered at
+	// tsoPeripheryScale and the insets go on top as a second projection layer.
+	int tsoSoftwareInset;
+	float tsoInsetFraction;
+	float tsoPeripheryScale;
 		
 	XrSpace tsoHandSpace[2];
 	XrTime tsoPredictedDisplayTime;
@@ -102,6 +300,70 @@ typedef struct tsoContext_t
 	tsoSwapchainInfo * tsoSwapchains;
 	XrSwapchainImageOpenGLKHR ** tsoSwapchainImages; //[tsoNumViewConfigs][tsoSwapchainLengths[...]]
 	uint32_t * tsoSwapchainLengths; //[tsoNumViewConfigs]
+
+	// Everything above points into the pool.  Unused entries stay alive until trimmed.
+	tsoSwapchainPoolEntry * tsoSwapchainPool;
+	int tsoSwapchainPoolSize;
+	uint32_t tsoSwapchainPoolAge;
+	int64_t * tsoSwapchainFormats;
+	int tsoNumSwapchainFormats;
+	int64_t tsoSwapchainFormat;
+
+	// Scale applied to the recommended image size; change at runtime to switch quality.
+	float tsoRenderScale;
+
+	// For TSO_HALF_RATE, what was submitted the last time we rendered.
+	XrCompositionLayerProjectionView * tsoLastProjectionViews;
+	int tsoLastViewCount;
+	int tsoResubmitNext;
+
+	int tsoFrameNumber;
+	tsoFrameStats tsoStats;
+	tsoGPUTimer tsoGPUTiming;
+
+	// Desktop mirror, see tsoSetMirror.  Copied GPU-side from the swapchain right
+	// before it is released, so nothing is ever read back from the window.
+	int tsoMirrorView;
+	float tsoMirrorRate;
+	int tsoMirrorWidth;
+	int tsoMirrorHeight;
+	int tsoMirrorPending;
+	double tsoMirrorLastTime;
+	uint32_t tsoMirrorImage;
+	uint32_t tsoMirrorReadFBO;
+	tsoRenderTarget tsoMirrorTarget;
+
+	// Per-view matrices for this frame.  Projections are only rebuilt when fov or clip planes change.
+	tsoViewMatrices tsoMatrices[TSO_MAX_VIEWS];
+	tsoProjectionCacheKey tsoProjectionCache[TSO_MAX_VIEWS];
+	float tsoNearZ;
+	float tsoFarZ; // Set <= tsoNearZ for an infinite far plane.
+	int tsoReverseZ; // Set by tsoEnableReverseZ.
+
+	// One frustum around all views in stage space, rebuilt every frame before tsoRenderLayer.
+	tsoFrustum tsoCullFrustum;
+
+	// Late latching, see tsoEnableLateLatch.
+	int tsoLateLatch;
+	uint32_t tsoLateLatchBuffer;
+	uint8_t * tsoLateLatchMap;
+	int tsoLateLatchSlotSize;
+	int tsoLateLatchSlot; // -1 when this frame was not latched.
+	void * tsoLateLatchFences[TSO_LATE_LATCH_SLOTS];
+	void * tsoLateLatchStart; // Fence in front of this frame's draws.
+	uint32_t tsoLateLatchFallback; // Plain uniform buffer with the early matrices for skipped frames.
+	uint32_t tsoLateLatchReleases; // Swapchains whose release waits for the latch, one bit each.
+
+	// GPU completion of recent frames, see tsoFrameStats.
+	tsoFrameFence tsoFrameFences[TSO_FRAME_FENCES];
+	double tsoGPUClockOffset;
+	double tsoGPUClockCalibrated; // When tsoGPUClockOffset was measured, 0 for never.
+	PFN_xrVoidFunction tsoConvertTime; // XR_KHR_convert_timespec_time or its Win32 equivalent.
+
+	// Quad layers, submitted on top of the projection layer in this order.
+	tsoQuadLayer * tsoQuadLayers[TSO_MAX_QUAD_LAYERS];
+	int tsoNumQuadLayers;
+	uint32_t tsoQuadLayerFBO;
 	
 	// For debugging.
 	int tsoPrintAll;
@@ -109,6 +371,7 @@ typedef struct tsoContext_t
 	int tsoSessionReady;
 	XrSessionState tsoXRState;
 	tsoRenderLayerFunction_t tsoRenderLayer;
+	tsoRenderLayerExFunction_t tsoRenderLayerEx;
 	int flags;
 	void * opaque;
 } tsoContext;
@@ -130,6 +393,14 @@ typedef struct tsoContext_t
 // Init Flags
 #define TSO_DO_DEBUG 1	// Log all
 #define TSO_DOUBLEWIDE 2  // Enable double-wide frames.
+#define TSO_HALF_RATE 4   // Only call tsoRenderLayer every other frame, resubmit the last images in between.
+#define TSO_GPU_TIMING 8  // Time the render callback on the GPU, see tsoStats and tsoGPUTimerView.
+#define TSO_QUAD_VIEWS 16 // Two wide low-res views then two full-res insets, see tsoSoftwareInset.
+
+// How many unused swapchains to keep around for reuse.
+#ifndef TSO_SWAPCHAIN_POOL_SPARE
+#define TSO_SWAPCHAIN_POOL_SPARE 4
+#endif
 
 // Most functions return 0 on success.
 // nonzero on failure.
@@ -144,36 +415,311 @@ int tsoSyncInput( tsoContext * ctx );
 int tsoRenderFrame( tsoContext * ctx );
 int tsoAcquireSwapchain( tsoContext * ctx, int swapchain, uint32_t * swapchainImageIndex );
 int tsoReleaseSwapchain( tsoContext * ctx, int swapchain );
-int tsoDestroySwapchains( tsoContext * ctx );
+int tsoDestroySwapchains( tsoContext * ctx ); // Destroys all swapchains, pooled or not.
+int tsoTrimSwapchainPool( tsoContext * ctx, int keep ); // Destroy all but the `keep` most recently used unused swapchains.
+int tsoSwapchainsNeedRecreate( tsoContext * ctx );
+int tsoSwapchainForView( tsoContext * ctx, int view ); // With TSO_DOUBLEWIDE, views are paired up side by side.
 int tsoTeardown( tsoContext * ctx );
 
+// With TSO_GPU_TIMING, call at the start of each view inside tsoRenderLayer to get per-view GPU times.
+void tsoGPUTimerView( tsoContext * ctx, int view );
+
+// Mirror `view` to the desktop at most `rateHz` times a second (0 for every frame).
+// width/height of 0 keep the view's own resolution.  Pass a negative view to turn it off.
+int tsoSetMirror( tsoContext * ctx, int view, float rateHz, int width, int height );
+// Blits the newest mirror image to the window, cropped to its aspect.  Returns 1 if it
+// drew, in which case you probably want to swap buffers; 0 if there was nothing new.
+int tsoMirrorToWindow( tsoContext * ctx, int windowWidth, int windowHeight );
+
+// Have tsoComputeViewMatrices build reverse-Z projections, and run tsoRenderLayer with the GL clip
+// space at [0,1] and the depth test at GL_GEQUAL.  Both are restored when the callback returns, so
+// the mirror and window drawing are unaffected.  Clear depth to 0 instead of 1 inside the callback
+// while this is on.  Needs glClipControl (GL 4.5, ARB_clip_control or EXT_clip_control); returns
+// nonzero and changes nothing without it.
+int tsoEnableReverseZ( tsoContext * ctx, int enable );
+
+// Quad layers: flat panels the compositor draws over the projection layer, for menus, loading
+// screens and debug text.  The content lives in a XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT swapchain
+// that is drawn once and then handed to xrEndFrame every frame without rendering anything.
+// Set ql->dynamic for content that changes regularly.
+// The layer starts visible and dirty; ql must stay valid until tsoQuadLayerDestroy or tsoTeardown.
+int tsoQuadLayerCreate( tsoContext * ctx, tsoQuadLayer * ql, int width, int height, float sizeX, float sizeY, tsoQuadLayerRenderFunction_t render );
+void tsoQuadLayerDestroy( tsoContext * ctx, tsoQuadLayer * ql );
+
+// Offscreen render targets, for things like drawing UI to show in the headset.
+int tsoRenderTargetCreate( tsoRenderTarget * rt, int width, int height, int withDepth );
+void tsoRenderTargetBind( tsoRenderTarget * rt ); // Pass NULL to go back to the window.
+void tsoRenderTargetDestroy( tsoRenderTarget * rt );
+
+// Instanced stereo: draw each object once for both halves of a TSO_DOUBLEWIDE swapchain.
+// Every draw is issued with twice the instances; odd instances go to the right eye.
+// Where the vertex shader can write gl_ViewportIndex (ARB_shader_viewport_layer_array or
+// AMD_vertex_shader_viewport_index, plus ARB_viewport_array), each eye gets its own viewport.
+// Otherwise one viewport spans both eyes and each eye is squeezed into its half and clipped
+// there with gl_ClipDistance.
+#define TSO_STEREO_VIEWPORT_INDEX 1
+#define TSO_STEREO_CLIP_DISTANCE  2
+
+typedef struct
+{
+	int mode;
+	const char * shaderHeader; // Put right after #version; enables the extension the mode needs.
+	uint32_t ubo;
+	int instances; // Per draw; 2 between tsoStereoBegin and tsoStereoEnd, otherwise 0.
+} tsoStereo;
+
+// Prepend shaderHeader then this to a vertex shader (GLSL 150+) and set gl_Position = tsoStereoPosition( worldPos ).
+// With TSO_LATE_LATCH_GLSL in front of it, it reads the late-latched matrices instead.
+// Use tsoInstanceID instead of gl_InstanceID for your own instancing.
+#define TSO_STEREO_GLSL \
+	"#ifdef TSO_LATE_LATCH\n" \
+	"#define tsoStereoViewProj( eye ) tsoLateViewProj[eye]\n" \
+	"#else\n" \
+	"layout(std140) uniform tsoStereoBlock { mat4 tsoViewProj[2]; mat4 tsoView[2]; };\n" \
+	"#define tsoStereoViewProj( eye ) tsoViewProj[eye]\n" \
+	"#endif\n" \
+	"#define tsoInstanceID ( gl_InstanceID / 2 )\n" \
+	"#ifndef TSO_STEREO_VIEWPORT_INDEX\n" \
+	"out float gl_ClipDistance[1];\n" \
+	"#endif\n" \
+	"vec4 tsoStereoPosition( vec4 worldPos )\n" \
+	"{\n" \
+	"	int eye = gl_InstanceID & 1;\n" \
+	"	vec4 p = tsoStereoViewProj( eye ) * worldPos;\n" \
+	"#ifdef TSO_STEREO_VIEWPORT_INDEX\n" \
+	"	gl_ViewportIndex = eye;\n" \
+	"#else\n" \
+	"	p.x = p.x * 0.5 + ( float( eye ) - 0.5 ) * p.w;\n" \
+	"	gl_ClipDistance[0] = ( eye == 0 ) ? -p.x : p.x;\n" \
+	"#endif\n" \
+	"	return p;\n" \
+	"}\n"
+
+// Returns nonzero if there is no uniform buffer or instanced drawing support.
+int tsoStereoInit( tsoStereo * st );
+void tsoStereoDestroy( tsoStereo * st );
+void tsoStereoBindProgram( tsoStereo * st, uint32_t program ); // Once per program, after linking.
+// Uploads both eyes' matrices and sets up viewports.  Views must be side by side in one image.
+// Returns nonzero, without touching any GL state, unless there are exactly two such views;
+// draw each view separately then.
+int tsoStereoBegin( tsoStereo * st, const XrCompositionLayerProjectionView * views, const tsoViewMatrices * matrices, int viewCount );
+void tsoStereoEnd( tsoStereo * st );
+// These draw nothing outside tsoStereoBegin/tsoStereoEnd.
+void tsoStereoDrawArrays( tsoStereo * st, uint32_t mode, int first, int count );
+void tsoStereoDrawElements( tsoStereo * st, uint32_t mode, int count, uint32_t type, const void * indices );
+
+// Late latching: the view matrices live in a persistently mapped uniform buffer ring.  They are
+// written before tsoRenderLayer, then views are located again after it returns and the slot is
+// overwritten with the newer pose before anything is handed to the GPU.  tsoReleaseSwapchain
+// calls inside tsoRenderLayer are held back until then, so don't glFlush or glFinish in there.
+// If the GPU already reached the frame's draws (because the driver flushed on its own), or still
+// has the ring slot from an earlier frame, the early matrices stay; see tsoStats.lateLatchSkipped.
+// GL can't promise that every draw reads the rewritten slot, so the poses given to xrEndFrame
+// stay the ones from the first xrLocateViews and ctx->tsoMatrices keeps the early matrices.
+// Needs glBufferStorage (GL 4.4 or ARB_buffer_storage) and fence syncs.
+// Prepend TSO_LATE_LATCH_GLSL to shaders and call tsoLateLatchBindProgram on them.
+#define TSO_STRINGIFY2( x ) #x
+#define TSO_STRINGIFY( x ) TSO_STRINGIFY2( x )
+#define TSO_LATE_LATCH_GLSL \
+	"#define TSO_LATE_LATCH\n" \
+	"layout(std140) uniform tsoLateLatchBlock {\n" \
+	"	mat4 tsoLateViewProj[" TSO_STRINGIFY( TSO_MAX_VIEWS ) "];\n" \
+	"	mat4 tsoLateView[" TSO_STRINGIFY( TSO_MAX_VIEWS ) "];\n" \
+	"	mat4 tsoLateInvView[" TSO_STRINGIFY( TSO_MAX_VIEWS ) "];\n" \
+	"};\n"
+int tsoEnableLateLatch( tsoContext * ctx, int enable );
+void tsoLateLatchBindProgram( uint32_t program );
+
+// World-space debug drawing.  Record lines, boxes, axes and text once per frame, then draw the
+// same buffer for every view; it is uploaded once, on the first draw after it changed.
+// Draws use the bound program with attribute 0 = vec3 position and 1 = normalized RGBA8 color.
+// Colors are 0xAABBGGRR (bytes in RGBA order).
+typedef struct
+{
+	float pos[3];
+	uint32_t color;
+} tsoDebugVertex;
+
+typedef struct
+{
+	tsoDebugVertex * verts; // GL_LINES
+	int count;
+	int capacity;
+	int dirty;
+	uint32_t vbo;
+} tsoDebugDraw;
+
+int tsoDebugDrawInit( tsoDebugDraw * dd ); // Returns nonzero if there are no buffer objects.
+void tsoDebugDrawDestroy( tsoDebugDraw * dd );
+void tsoDebugDrawReset( tsoDebugDraw * dd ); // Call at the start of each frame.
+void tsoDebugLine( tsoDebugDraw * dd, const float * a, const float * b, uint32_t color );
+void tsoDebugBox( tsoDebugDraw * dd, const float * mins, const float * maxs, uint32_t color );
+void tsoDebugAxes( tsoDebugDraw * dd, const XrPosef * pose, float size ); // X red, Y green, Z blue.
+#ifdef _CNFG_H
+// Rawdraw's stroke font, top left at pos, billboarded toward facing (or in the XY plane if NULL).
+// height is one line of text in meters.
+void tsoDebugText( tsoDebugDraw * dd, const tsoViewMatrices * facing, const float * pos, float height, uint32_t color, const char * text );
+#endif
+// Pass the program's view-projection uniform location and matrix, or -1 to leave it alone.
+void tsoDebugDrawView( tsoDebugDraw * dd, int viewProjUniform, const float * viewProj );
+// Both eyes at once, between tsoStereoBegin and tsoStereoEnd, with a TSO_STEREO_GLSL program.
+void tsoDebugDrawStereo( tsoDebugDraw * dd, tsoStereo * st );
+
 // Utility functions
 void tsoUtilInitPoseMat(float* result, const XrPosef * pose);
 enum GraphicsAPI { GRAPHICS_VULKAN, GRAPHICS_OPENGL, GRAPHICS_OPENGL_ES, GRAPHICS_D3D };
 void tsoUtilInitProjectionMat(XrCompositionLayerProjectionView * layerView, float* projMat, float * invViewMat, float * viewMat, float * modelViewProjMat,
 								enum GraphicsAPI graphicsApi, 
 								const float nearZ, const float farZ);
-void tsoInvertOrthogonalMat(float* result, float* src);
+void tsoUtilInitFovProjectionMat(float* projMat, const XrFovf * fov, enum GraphicsAPI graphicsApi, const float nearZ, const float farZ);
+// Maps near to 1 and far to 0 in a [0,1] clip space (glClipControl( GL_LOWER_LEFT, GL_ZERO_TO_ONE ) on OpenGL).
+// farZ <= nearZ puts the far plane at infinity.  Only really pays off with a floating point depth buffer.
+void tsoUtilInitReverseZProjectionMat(float* projMat, const XrFovf * fov, enum GraphicsAPI graphicsApi, const float nearZ, const float farZ);
+void tsoInvertOrthogonalMat(float* result, const float* src);
 void tsoMultiplyMat(float* result, const float* a, const float* b);
 
+// Plain C reference versions of the above, which use SSE2 or NEON when available.
+void tsoUtilInitPoseMatScalar(float* result, const XrPosef * pose);
+void tsoInvertOrthogonalMatScalar(float* result, const float* src);
+void tsoMultiplyMatScalar(float* result, const float* a, const float* b);
+
+// Pose math directly on XrPosef/XrQuaternionf, cheaper than going through 4x4 matrices.
+// Quaternions are expected to be unit length.  Results may alias inputs.
+void tsoQuatMultiply(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b);
+void tsoQuatRotateVector(XrVector3f * result, const XrQuaternionf * q, const XrVector3f * v);
+void tsoQuatNlerp(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b, float t);
+void tsoQuatSlerp(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b, float t);
+void tsoPoseMultiply(XrPosef * result, const XrPosef * a, const XrPosef * b); // Applies b, then a.
+void tsoPoseInvert(XrPosef * result, const XrPosef * pose);
+void tsoPoseTransformPoint(XrVector3f * result, const XrPosef * pose, const XrVector3f * point);
+void tsoPoseTransformVector(XrVector3f * result, const XrPosef * pose, const XrVector3f * vector); // Rotation only.
+void tsoPoseInterpolate(XrPosef * result, const XrPosef * a, const XrPosef * b, float t); // Lerp position, slerp orientation.
+void tsoPoseMultiplyArray(XrPosef * result, const XrPosef * parent, const XrPosef * poses, int count);
+void tsoPoseTransformPoints(XrVector3f * result, const XrPosef * pose, const XrVector3f * points, int count);
+void tsoPoseTransformVectors(XrVector3f * result, const XrPosef * pose, const XrVector3f * vectors, int count);
+
+// Build one conservative frustum containing every view's frustum, so a single cull pass works for all eyes.
+// farZ <= nearZ (infinite far) drops the far plane and sizes the sides out to TSO_CULL_INFINITE_FAR.
+void tsoFrustumFromViews(tsoFrustum * frustum, const XrCompositionLayerProjectionView * views, int viewCount, float nearZ, float farZ);
+// Structure-of-arrays culling.  Sets bit i of visible[i/32] for every object that may be visible;
+// visible needs (count+31)/32 words.  Returns the number of visible objects.
+int tsoCullSpheres(const tsoFrustum * frustum, const float * x, const float * y, const float * z, const float * radius, int count, uint32_t * visible);
+int tsoCullAABBs(const tsoFrustum * frustum, const float * minX, const float * minY, const float * minZ,
+	const float * maxX, const float * maxY, const float * maxZ, int count, uint32_t * visible);
+
 
 // Internal functions.
 int tsoCheck( tsoContext * ctx, XrResult result, const char* str );
+int tsoSelectViewConfig( tsoContext * ctx );
 int tsoEnumeratetsoViewConfigs( tsoContext * ctx );
 int tsoEnumerateExtensions( tsoContext * ctx );
 int tsoExtensionSupported( tsoContext * ctx, const char* extensionName); // Returns 1 if supported, 0 if not.
 int tsoEnumerateLayers( tsoContext * ctx );
+int tsoEnumerateSwapchainFormats( tsoContext * ctx );
+int tsoLoadGL( tsoContext * ctx ); // Loads the OpenGL entry points the library itself needs.
+void tsoGPUTimerBegin( tsoContext * ctx );
+void tsoGPUTimerEnd( tsoContext * ctx );
+void tsoGPUTimerCollect( tsoContext * ctx );
 int tsoCreateInstance( tsoContext * ctx, const char * appname );
 int tsoGetSystemId( tsoContext * ctx );
 int tsoCreateSession( tsoContext * ctx, uint32_t openglMajor, uint32_t openglMinor );
 int tsoCreateStageSpace( tsoContext * ctx );
 int tsoBeginSession( tsoContext * ctx );
+void tsoComputeViewMatrices( tsoContext * ctx, const XrCompositionLayerProjectionView * projectionLayerViews, int viewCount );
+
+
+// Tile-binned, multithreaded software rasterizer that renders every view into
+// a CPU buffer and then streams those buffers into the XR swapchain images.
+// Useful for headless rigs or when driver overhead dominates.  Needs os_generic.h
+// for threads.  Primitives mirror rawdraw's (colors are 0xRRGGBBAA).
+#ifndef TSOPENXR_ENABLE_SOFTRASTER
+#define TSOPENXR_ENABLE_SOFTRASTER 0
+#endif
+
+#if TSOPENXR_ENABLE_SOFTRASTER
+
+#include "os_generic.h"
+
+#ifndef TSO_SOFTRASTER_TILE
+#define TSO_SOFTRASTER_TILE 64
+#endif
+
+#ifndef TSO_SOFTRASTER_MAX_THREADS
+#define TSO_SOFTRASTER_MAX_THREADS 32
+#endif
+
+typedef struct
+{
+	uint8_t type;
+	int8_t view; // -1 for all views.
+	uint32_t color;
+	short x0, y0, x1, y1, x2, y2;
+	short minx, miny, maxx, maxy;
+} tsoSoftRasterCmd;
+
+typedef struct
+{
+	int * cmds;
+	int numCmds;
+	int maxCmds;
+} tsoSoftRasterTile;
+
+typedef struct tsoSoftRaster_t
+{
+	int numViews;
+	int width;
+	int height;
+	uint32_t ** buffers; //[numViews][width*height], in GL_RGBA byte order.
+
+	tsoSoftRasterCmd * cmds;
+	int numCmds;
+	int maxCmds;
+	int curView;
+	uint32_t curColor;
+
+	int tilesX, tilesY;
+	tsoSoftRasterTile * tiles; //[numViews][tilesY][tilesX]
+	int numTiles;
+
+	// Worker state
+	int numThreads;
+	og_thread_t threads[TSO_SOFTRASTER_MAX_THREADS];
+	og_sema_t workSema;
+	og_sema_t doneSema;
+	og_mutex_t tileMutex;
+	int nextTile;
+	int quitting;
+} tsoSoftRaster;
+
+// numThreads of 0 means render only on the calling thread.
+int tsoSoftRasterCreate( tsoSoftRaster * sr, int numThreads );
+void tsoSoftRasterDestroy( tsoSoftRaster * sr );
+
+// Begin a frame; (re)allocates view buffers if the size changed and drops all queued commands.
+int tsoSoftRasterBegin( tsoSoftRaster * sr, int numViews, int width, int height );
+void tsoSoftRasterSetView( tsoSoftRaster * sr, int view ); // -1 = draw to all views.
+uint32_t tsoSoftRasterColor( tsoSoftRaster * sr, uint32_t RGBA );
+void tsoSoftRasterClear( tsoSoftRaster * sr, uint32_t RGBA );
+void tsoSoftRasterPixel( tsoSoftRaster * sr, short x, short y );
+void tsoSoftRasterSegment( tsoSoftRaster * sr, short x1, short y1, short x2, short y2 );
+void tsoSoftRasterRectangle( tsoSoftRaster * sr, short x1, short y1, short x2, short y2 );
+void tsoSoftRasterTriangle( tsoSoftRaster * sr, short x0, short y0, short x1, short y1, short x2, short y2 );
+
+// Bin everything into tiles and rasterize across all threads.  Blocks until complete.
+int tsoSoftRasterFinish( tsoSoftRaster * sr );
+
+// Acquire, upload each view's buffer into its subImage and release.  Call from a tsoRenderLayer callback.
+int tsoSoftRasterSubmit( tsoContext * ctx, tsoSoftRaster * sr, XrCompositionLayerProjectionView * projectionLayerViews, int viewCountOutput );
+
+#endif
 
 #ifdef TSOPENXR_IMPLEMENTATION
 
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
+#include <math.h>
 
 // For limited OpenGL Platforms, Like Windows.
 #ifndef GL_SRGB8_ALPHA8
@@ -188,6 +734,233 @@ int tsoBeginSession( tsoContext * ctx );
 #define alloca _alloca
 #endif
 
+#ifndef TSO_CULL_INFINITE_FAR
+#define TSO_CULL_INFINITE_FAR 10000.0f
+#endif
+
+// Set to 0 to force the scalar matrix utilities.
+#ifndef TSOPENXR_ENABLE_SIMD
+#define TSOPENXR_ENABLE_SIMD 1
+#endif
+
+#if TSOPENXR_ENABLE_SIMD && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+#define TSO_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif TSOPENXR_ENABLE_SIMD && ( defined( __ARM_NEON ) || defined( __ARM_NEON__ ) )
+#define TSO_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#include "os_generic.h"
+
+#ifndef GL_TIMESTAMP
+#define GL_TIMESTAMP 0x8E28
+#endif
+
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER 0x8D40
+#endif
+
+#ifndef GL_READ_FRAMEBUFFER
+#define GL_READ_FRAMEBUFFER 0x8CA8
+#define GL_DRAW_FRAMEBUFFER 0x8CA9
+#endif
+
+#ifndef GL_READ_FRAMEBUFFER_BINDING
+#define GL_DRAW_FRAMEBUFFER_BINDING 0x8CA6
+#define GL_READ_FRAMEBUFFER_BINDING 0x8CAA
+#endif
+
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+
+#ifndef GL_DEPTH_ATTACHMENT
+#define GL_DEPTH_ATTACHMENT 0x8D00
+#endif
+
+#ifndef GL_DEPTH_COMPONENT24
+#define GL_DEPTH_COMPONENT24 0x81A6
+#endif
+
+#ifndef GL_RGBA8
+#define GL_RGBA8 0x8058
+#endif
+
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE 0x812F
+#endif
+
+#ifndef GL_UNIFORM_BUFFER
+#define GL_UNIFORM_BUFFER 0x8A11
+#endif
+
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER 0x8892
+#endif
+
+#ifndef GL_CLIP_DISTANCE0
+#define GL_CLIP_DISTANCE0 0x3000
+#endif
+
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_WRITE_BIT 0x0002
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x0001
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_WAIT_FAILED 0x911D
+#endif
+
+#ifdef XR_USE_PLATFORM_WIN32
+#define TSO_CONVERT_TIME_EXTENSION XR_KHR_WIN32_CONVERT_PERFORMANCE_COUNTER_TIME_EXTENSION_NAME
+#define TSO_CONVERT_TIME_FUNCTION "xrConvertTimeToWin32PerformanceCounterKHR"
+#else
+#define TSO_CONVERT_TIME_EXTENSION XR_KHR_CONVERT_TIMESPEC_TIME_EXTENSION_NAME
+#define TSO_CONVERT_TIME_FUNCTION "xrConvertTimeToTimespecTimeKHR"
+#endif
+
+#ifndef GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+#define GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT 0x8A34
+#endif
+
+#ifndef GL_NUM_EXTENSIONS
+#define GL_NUM_EXTENSIONS 0x821D
+#endif
+
+#ifndef GL_ZERO_TO_ONE
+#define GL_LOWER_LEFT 0x8CA1
+#define GL_NEGATIVE_ONE_TO_ONE 0x935E
+#define GL_ZERO_TO_ONE 0x935F
+#endif
+
+#ifndef GL_CLIP_ORIGIN
+#define GL_CLIP_ORIGIN 0x935C
+#define GL_CLIP_DEPTH_MODE 0x935D
+#endif
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+// How we find OpenGL functions beyond 1.1.  rawdraw provides this with CNFGOGL_NEED_EXTENSION.
+#ifndef TSOPENXR_GETPROCADDRESS
+#if defined( CNFGOGL_NEED_EXTENSION )
+#define TSOPENXR_GETPROCADDRESS CNFGGetProcAddress
+#elif defined( USE_WINDOWS )
+static void * tsoDefaultGetProcAddress( const char * name )
+{
+	return (void*)wglGetProcAddress( name );
+}
+#define TSOPENXR_GETPROCADDRESS tsoDefaultGetProcAddress
+#else
+#include <dlfcn.h>
+#ifndef RTLD_DEFAULT
+#define RTLD_DEFAULT ((void*)0) // glibc only exposes it with _GNU_SOURCE.
+#endif
+static void * tsoDefaultGetProcAddress( const char * name )
+{
+	return dlsym( RTLD_DEFAULT, name );
+}
+#define TSOPENXR_GETPROCADDRESS tsoDefaultGetProcAddress
+#endif
+#endif
+
+static int tsoGLLoaded;
+static void (APIENTRY *tsoglGenQueries)( GLsizei n, GLuint * ids );
+static void (APIENTRY *tsoglDeleteQueries)( GLsizei n, const GLuint * ids );
+static void (APIENTRY *tsoglQueryCounter)( GLuint id, GLenum target );
+static void (APIENTRY *tsoglGetQueryObjectuiv)( GLuint id, GLenum pname, GLuint * params );
+static void (APIENTRY *tsoglGetQueryObjectui64v)( GLuint id, GLenum pname, uint64_t * params );
+static void (APIENTRY *tsoglGenFramebuffers)( GLsizei n, GLuint * ids );
+static void (APIENTRY *tsoglDeleteFramebuffers)( GLsizei n, const GLuint * ids );
+static void (APIENTRY *tsoglBindFramebuffer)( GLenum target, GLuint framebuffer );
+static void (APIENTRY *tsoglFramebufferTexture2D)( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level );
+static void (APIENTRY *tsoglClipControl)( GLenum origin, GLenum depth );
+static void (APIENTRY *tsoglGenBuffers)( GLsizei n, GLuint * buffers );
+static void (APIENTRY *tsoglDeleteBuffers)( GLsizei n, const GLuint * buffers );
+static void (APIENTRY *tsoglBindBuffer)( GLenum target, GLuint buffer );
+static void (APIENTRY *tsoglBufferData)( GLenum target, intptr_t size, const void * data, GLenum usage );
+static void (APIENTRY *tsoglBindBufferBase)( GLenum target, GLuint index, GLuint buffer );
+static GLuint (APIENTRY *tsoglGetUniformBlockIndex)( GLuint program, const char * name );
+static void (APIENTRY *tsoglUniformBlockBinding)( GLuint program, GLuint blockIndex, GLuint binding );
+static void (APIENTRY *tsoglViewportArrayv)( GLuint first, GLsizei count, const GLfloat * v );
+static void (APIENTRY *tsoglDrawArraysInstanced)( GLenum mode, GLint first, GLsizei count, GLsizei instances );
+static void (APIENTRY *tsoglDrawElementsInstanced)( GLenum mode, GLsizei count, GLenum type, const void * indices, GLsizei instances );
+static const GLubyte * (APIENTRY *tsoglGetStringi)( GLenum name, GLuint index );
+static void (APIENTRY *tsoglBufferStorage)( GLenum target, intptr_t size, const void * data, GLbitfield flags );
+static void * (APIENTRY *tsoglMapBufferRange)( GLenum target, intptr_t offset, intptr_t length, GLbitfield access );
+static GLboolean (APIENTRY *tsoglUnmapBuffer)( GLenum target );
+static void (APIENTRY *tsoglBindBufferRange)( GLenum target, GLuint index, GLuint buffer, intptr_t offset, intptr_t size );
+static void * (APIENTRY *tsoglFenceSync)( GLenum condition, GLbitfield flags );
+static GLenum (APIENTRY *tsoglClientWaitSync)( void * sync, GLbitfield flags, uint64_t timeout );
+static void (APIENTRY *tsoglDeleteSync)( void * sync );
+static void (APIENTRY *tsoglGetInteger64v)( GLenum pname, int64_t * data );
+static void (APIENTRY *tsoglVertexAttribPointer)( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer );
+static void (APIENTRY *tsoglEnableVertexAttribArray)( GLuint index );
+static void (APIENTRY *tsoglUniformMatrix4fv)( GLint location, GLsizei count, GLboolean transpose, const GLfloat * value );
+static void (APIENTRY *tsoglBlitFramebuffer)( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter );
+
+static void * tsoGetGLProc( const char * name, const char * extName )
+{
+	void * ret = TSOPENXR_GETPROCADDRESS( name );
+	if( !ret && extName ) ret = TSOPENXR_GETPROCADDRESS( extName );
+	return ret;
+}
+
+int tsoLoadGL( tsoContext * ctx )
+{
+	if( tsoGLLoaded ) return 0;
+	tsoglGenQueries = tsoGetGLProc( "glGenQueries", "glGenQueriesEXT" );
+	tsoglDeleteQueries = tsoGetGLProc( "glDeleteQueries", "glDeleteQueriesEXT" );
+	tsoglQueryCounter = tsoGetGLProc( "glQueryCounter", "glQueryCounterEXT" );
+	tsoglGetQueryObjectuiv = tsoGetGLProc( "glGetQueryObjectuiv", "glGetQueryObjectuivEXT" );
+	tsoglGetQueryObjectui64v = tsoGetGLProc( "glGetQueryObjectui64v", "glGetQueryObjectui64vEXT" );
+	tsoglGenFramebuffers = tsoGetGLProc( "glGenFramebuffers", "glGenFramebuffersEXT" );
+	tsoglDeleteFramebuffers = tsoGetGLProc( "glDeleteFramebuffers", "glDeleteFramebuffersEXT" );
+	tsoglBindFramebuffer = tsoGetGLProc( "glBindFramebuffer", "glBindFramebufferEXT" );
+	tsoglFramebufferTexture2D = tsoGetGLProc( "glFramebufferTexture2D", "glFramebufferTexture2DEXT" );
+	tsoglBlitFramebuffer = tsoGetGLProc( "glBlitFramebuffer", "glBlitFramebufferEXT" );
+	tsoglClipControl = tsoGetGLProc( "glClipControl", "glClipControlEXT" );
+	tsoglGenBuffers = tsoGetGLProc( "glGenBuffers", "glGenBuffersARB" );
+	tsoglDeleteBuffers = tsoGetGLProc( "glDeleteBuffers", "glDeleteBuffersARB" );
+	tsoglBindBuffer = tsoGetGLProc( "glBindBuffer", "glBindBufferARB" );
+	tsoglBufferData = tsoGetGLProc( "glBufferData", "glBufferDataARB" );
+	tsoglBindBufferBase = tsoGetGLProc( "glBindBufferBase", 0 );
+	tsoglGetUniformBlockIndex = tsoGetGLProc( "glGetUniformBlockIndex", 0 );
+	tsoglUniformBlockBinding = tsoGetGLProc( "glUniformBlockBinding", 0 );
+	tsoglViewportArrayv = tsoGetGLProc( "glViewportArrayv", "glViewportArrayvNV" );
+	tsoglDrawArraysInstanced = tsoGetGLProc( "glDrawArraysInstanced", "glDrawArraysInstancedARB" );
+	tsoglDrawElementsInstanced = tsoGetGLProc( "glDrawElementsInstanced", "glDrawElementsInstancedARB" );
+	tsoglGetStringi = tsoGetGLProc( "glGetStringi", 0 );
+	tsoglBufferStorage = tsoGetGLProc( "glBufferStorage", "glBufferStorageEXT" );
+	tsoglMapBufferRange = tsoGetGLProc( "glMapBufferRange", "glMapBufferRangeEXT" );
+	tsoglUnmapBuffer = tsoGetGLProc( "glUnmapBuffer", "glUnmapBufferOES" );
+	tsoglBindBufferRange = tsoGetGLProc( "glBindBufferRange", 0 );
+	tsoglFenceSync = tsoGetGLProc( "glFenceSync", 0 );
+	tsoglClientWaitSync = tsoGetGLProc( "glClientWaitSync", 0 );
+	tsoglDeleteSync = tsoGetGLProc( "glDeleteSync", 0 );
+	tsoglGetInteger64v = tsoGetGLProc( "glGetInteger64v", "glGetInteger64vEXT" );
+	tsoglVertexAttribPointer = tsoGetGLProc( "glVertexAttribPointer", "glVertexAttribPointerARB" );
+	tsoglEnableVertexAttribArray = tsoGetGLProc( "glEnableVertexAttribArray", "glEnableVertexAttribArrayARB" );
+	tsoglUniformMatrix4fv = tsoGetGLProc( "glUniformMatrix4fv", "glUniformMatrix4fvARB" );
+	tsoGLLoaded = 1;
+	return 0;
+}
+
 int tsoInitialize( tsoContext * ctx, int32_t openglMajor, int32_t openglMinor, int flags, const char * appname, void * opaque )
 {
 	int r;
@@ -195,6 +968,13 @@ int tsoInitialize( tsoContext * ctx, int32_t openglMajor, int32_t openglMinor, i
 	ctx->opaque = opaque;
 	ctx->flags = flags;
 	ctx->tsoPrintAll = !!(flags & TSO_DO_DEBUG);
+	ctx->tsoRenderScale = 1.0f;
+	ctx->tsoNearZ = 0.05f;
+	ctx->tsoFarZ = 100.0f;
+	ctx->tsoLateLatchSlot = -1;
+	ctx->tsoViewConfigType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+	ctx->tsoInsetFraction = 0.4f;
+	ctx->tsoPeripheryScale = 0.5f;
 
 #ifdef XR_USE_PLATFORM_ANDROID
 	PFN_xrInitializeLoaderKHR loaderFunc;
@@ -228,10 +1008,30 @@ int tsoInitialize( tsoContext * ctx, int32_t openglMajor, int32_t openglMinor, i
 	if( ( r = tsoCreateInstance( ctx, appname ) ) ) return r;
 	if( ( r = tsoEnumerateLayers( ctx ) ) ) return r;
 	if( ( r = tsoGetSystemId( ctx ) ) ) return r;
+	if( ( r = tsoSelectViewConfig( ctx ) ) ) return r;
 	if( ( r = tsoEnumeratetsoViewConfigs( ctx ) ) ) return r;
 	if( ( r = tsoCreateSession( ctx, openglMajor, openglMinor ) ) ) return r;
 	if( ( r = tsoCreateStageSpace( ctx ) ) ) return r;
 
+	// The per-frame fences behind tsoStats.gpuDone* and gpuLatency are always on when the GL has them.
+	tsoLoadGL( ctx );
+	if( !tsoglFenceSync || !tsoglClientWaitSync || !tsoglDeleteSync )
+		TSOPENXR_INFO( "No fence syncs, GPU completion and latency stats will stay at zero.\n" );
+
+	if( flags & TSO_GPU_TIMING )
+	{
+		tsoLoadGL( ctx );
+		if( !tsoglGenQueries || !tsoglQueryCounter || !tsoglGetQueryObjectuiv || !tsoglGetQueryObjectui64v )
+		{
+			TSOPENXR_ERROR( "TSO_GPU_TIMING requested, but timer queries are not available.\n" );
+			ctx->flags &= ~TSO_GPU_TIMING;
+		}
+		else
+		{
+			tsoglGenQueries( TSO_GPU_TIMER_FRAMES * (TSO_MAX_VIEWS+2), &ctx->tsoGPUTiming.queries[0][0] );
+		}
+	}
+
 	return 0;
 }
 
@@ -362,11 +1162,17 @@ int tsoCreateInstance(tsoContext * ctx, const char * appname )
 
 	// create openxr tsoInstance
 	XrResult result;
-	const char* const enabledExtensions[] = {OPENXR_SELECTED_GRAPHICS_API};
+	const char* enabledExtensions[3] = {OPENXR_SELECTED_GRAPHICS_API};
+	int enabledExtensionCount = 1;
+	int convertTime = tsoExtensionSupported( ctx, TSO_CONVERT_TIME_EXTENSION );
+	if( convertTime )
+		enabledExtensions[enabledExtensionCount++] = TSO_CONVERT_TIME_EXTENSION;
+	if( ( ctx->flags & TSO_QUAD_VIEWS ) && tsoExtensionSupported( ctx, XR_VARJO_QUAD_VIEWS_EXTENSION_NAME ) )
+		enabledExtensions[enabledExtensionCount++] = XR_VARJO_QUAD_VIEWS_EXTENSION_NAME;
 	XrInstanceCreateInfo ici = { XR_TYPE_INSTANCE_CREATE_INFO };
 	ici.next = NULL;
 	ici.createFlags = 0;
-	ici.enabledExtensionCount = 1;
+	ici.enabledExtensionCount = enabledExtensionCount;
 	ici.enabledExtensionNames = enabledExtensions;
 	ici.enabledApiLayerCount = 0;
 	ici.enabledApiLayerNames = NULL;
@@ -382,6 +1188,10 @@ int tsoCreateInstance(tsoContext * ctx, const char * appname )
 		return result;
 	}
 
+	// Only used for frame stats, so it's fine if this fails.
+	if( convertTime )
+		xrGetInstanceProcAddr( *tsoInstance, TSO_CONVERT_TIME_FUNCTION, &ctx->tsoConvertTime );
+
 #if TSOPENXR_ENABLE_DEBUG
 	if ( ctx->tsoPrintAll)
 	{
@@ -441,6 +1251,41 @@ int tsoGetSystemId( tsoContext * ctx )
 	return 0;
 }
 
+int tsoSelectViewConfig( tsoContext * ctx )
+{
+	XrResult result;
+	uint32_t count = 0;
+	uint32_t i;
+
+	if( !( ctx->flags & TSO_QUAD_VIEWS ) ) return 0;
+
+	result = xrEnumerateViewConfigurations( ctx->tsoInstance, ctx->tsoSystemId, 0, &count, NULL );
+	if( tsoCheck( ctx, result, "xrEnumerateViewConfigurations" ) )
+	{
+		return result;
+	}
+	XrViewConfigurationType * types = alloca( count * sizeof( XrViewConfigurationType ) );
+	result = xrEnumerateViewConfigurations( ctx->tsoInstance, ctx->tsoSystemId, count, &count, types );
+	if( tsoCheck( ctx, result, "xrEnumerateViewConfigurations" ) )
+	{
+		return result;
+	}
+
+	// The view configuration is only there if we enabled the extension in tsoCreateInstance.
+	for( i = 0; i < count; i++ )
+	{
+		if( types[i] == XR_VIEW_CONFIGURATION_TYPE_PRIMARY_QUAD_VARJO )
+		{
+			ctx->tsoViewConfigType = types[i];
+			return 0;
+		}
+	}
+
+	TSOPENXR_INFO( "No quad views on this runtime, using a software inset.\n" );
+	ctx->tsoSoftwareInset = 1;
+	return 0;
+}
+
 int tsoEnumeratetsoViewConfigs( tsoContext * ctx )
 {
 	
@@ -448,32 +1293,38 @@ int tsoEnumeratetsoViewConfigs( tsoContext * ctx )
 	XrSystemId tsoSystemId = ctx->tsoSystemId;
 	
 	XrResult result;
-	uint32_t viewCount = ctx->tsoNumViewConfigs;
-	XrViewConfigurationType stereoViewConfigType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
-	result = xrEnumerateViewConfigurationViews(tsoInstance, tsoSystemId, stereoViewConfigType, viewCount, &viewCount, ctx->tsoViewConfigs);
+	int insets = ctx->tsoSoftwareInset ? 2 : 1;
+	uint32_t viewCount = ctx->tsoNumViewConfigs / insets;
+	result = xrEnumerateViewConfigurationViews(tsoInstance, tsoSystemId, ctx->tsoViewConfigType, viewCount, &viewCount, ctx->tsoViewConfigs);
 	if (tsoCheck(ctx, result, "xrEnumerateViewConfigurationViews"))
 	{
 		return result;
 	}
 
 	XrViewConfigurationView * tsoViewConfigs = ctx->tsoViewConfigs;
+	uint32_t totalViews = viewCount * insets;
 
-	if( ctx->tsoNumViewConfigs != viewCount )
+	if( ctx->tsoNumViewConfigs != totalViews )
 	{
-		tsoViewConfigs = ctx->tsoViewConfigs = realloc( ctx->tsoViewConfigs, viewCount * sizeof(XrViewConfigurationView) );
-		for (uint32_t i = 0; i < viewCount; i++)
+		tsoViewConfigs = ctx->tsoViewConfigs = realloc( ctx->tsoViewConfigs, totalViews * sizeof(XrViewConfigurationView) );
+		for (uint32_t i = 0; i < totalViews; i++)
 		{
 			tsoViewConfigs[i].type = XR_TYPE_VIEW_CONFIGURATION_VIEW;
 			tsoViewConfigs[i].next = NULL;
 		}
 
-		result = xrEnumerateViewConfigurationViews(tsoInstance, tsoSystemId, stereoViewConfigType, viewCount, &viewCount, tsoViewConfigs);
+		result = xrEnumerateViewConfigurationViews(tsoInstance, tsoSystemId, ctx->tsoViewConfigType, viewCount, &viewCount, tsoViewConfigs);
 		if (tsoCheck(ctx, result, "xrEnumerateViewConfigurationViews"))
 		{
 			return result;
 		}
 	}
 
+	// Software insets start out as copies of their view; tsoGetDesiredViewSize scales them.
+	if( ctx->tsoSoftwareInset )
+		memcpy( tsoViewConfigs + viewCount, tsoViewConfigs, viewCount * sizeof(XrViewConfigurationView) );
+	viewCount = totalViews;
+
 #if TSOPENXR_ENABLE_DEBUG
 	if (ctx->tsoPrintAll && ctx->tsoNumViewConfigs != viewCount )
 	{
@@ -843,15 +1694,9 @@ int tsoCreateStageSpace( tsoContext * ctx )
 
 
 
-int tsoCreateSwapchains( tsoContext * ctx )
+int tsoEnumerateSwapchainFormats( tsoContext * ctx )
 {
 	XrSession tsoSession = ctx->tsoSession;
-	XrViewConfigurationView * tsoViewConfigs = ctx->tsoViewConfigs;
-	int tsoNumViewConfigs = ctx->tsoNumViewConfigs;
-	tsoSwapchainInfo ** tsoSwapchains = &ctx->tsoSwapchains; // Will allocate to tsoNumViewConfigs
-	XrSwapchainImageOpenGLKHR *** tsoSwapchainImages = &ctx->tsoSwapchainImages;
-	uint32_t ** tsoSwapchainLengths = &ctx->tsoSwapchainLengths; // Actually array of pointers to pointers
-					  
 	int i;
 	XrResult result;
 	uint32_t swapchainFormatCount;
@@ -861,7 +1706,7 @@ int tsoCreateSwapchains( tsoContext * ctx )
 		return result;
 	}
 
-	int64_t * swapchainFormats = alloca(swapchainFormatCount * sizeof( int64_t ));
+	int64_t * swapchainFormats = ctx->tsoSwapchainFormats = realloc( ctx->tsoSwapchainFormats, swapchainFormatCount * sizeof( int64_t ) );
 	result = xrEnumerateSwapchainFormats(tsoSession, swapchainFormatCount, &swapchainFormatCount, swapchainFormats);
 	if (tsoCheck(ctx, result, "xrEnumerateSwapchainFormats"))
 	{
@@ -897,102 +1742,260 @@ int tsoCreateSwapchains( tsoContext * ctx )
 	}
 #endif
 
-	if( *tsoSwapchains )
+	// For now we just pick the default one.
+	ctx->tsoNumSwapchainFormats = swapchainFormatCount;
+	ctx->tsoSwapchainFormat = swapchainFormats[selfmt];
+	return 0;
+}
+
+// Double-wide swapchains hold a pair of views, so the wide and inset views of quad views
+// each get a swapchain at their own resolution.
+static int tsoViewsPerSwapchain( tsoContext * ctx )
+{
+	if( !( ctx->flags & TSO_DOUBLEWIDE ) ) return 1;
+	return ( ctx->tsoNumViewConfigs > 2 ) ? 2 : ctx->tsoNumViewConfigs;
+}
+
+int tsoSwapchainForView( tsoContext * ctx, int view )
+{
+	return view / tsoViewsPerSwapchain( ctx );
+}
+
+static void tsoGetDesiredViewSize( tsoContext * ctx, int view, int32_t * width, int32_t * height )
+{
+	const XrViewConfigurationView * vc = ctx->tsoViewConfigs + view;
+	float scale = ( ctx->tsoRenderScale > 0 ) ? ctx->tsoRenderScale : 1.0f;
+
+	// Same pixel density in the inset as the full view would have had.
+	if( ctx->tsoSoftwareInset )
+		scale *= ( view < ctx->tsoNumViewConfigs / 2 ) ? ctx->tsoPeripheryScale : ctx->tsoInsetFraction;
+
+	int32_t w = vc->recommendedImageRectWidth * scale;
+	int32_t h = vc->recommendedImageRectHeight * scale;
+	if( w > vc->maxImageRectWidth ) w = vc->maxImageRectWidth;
+	if( h > vc->maxImageRectHeight ) h = vc->maxImageRectHeight;
+	if( w < 1 ) w = 1;
+	if( h < 1 ) h = 1;
+
+	*width = w;
+	*height = h;
+}
+
+static void tsoGetDesiredSwapchainSize( tsoContext * ctx, int swapchainNumber, int32_t * width, int32_t * height )
+{
+	int perSwapchain = tsoViewsPerSwapchain( ctx );
+	int i;
+
+	*width = 0;
+	*height = 0;
+	for( i = 0; i < perSwapchain; i++ )
 	{
-		tsoDestroySwapchains( ctx );
+		int32_t w, h;
+		tsoGetDesiredViewSize( ctx, swapchainNumber * perSwapchain + i, &w, &h );
+		if( w > *width ) *width = w;
+		if( h > *height ) *height = h;
 	}
+	*width *= perSwapchain;
+}
 
-	// For now we just pick the default one.
-	int64_t swapchainFormatToUse = swapchainFormats[selfmt];
+int tsoSwapchainsNeedRecreate( tsoContext * ctx )
+{
+	int i;
+	int numSwapchainsPerFrame = ctx->tsoNumViewConfigs / tsoViewsPerSwapchain( ctx );
+	if( !ctx->tsoSwapchains || !ctx->tsoNumViewConfigs ) return 1;
+	if( numSwapchainsPerFrame != ctx->numSwapchainsPerFrame ) return 1;
+	for( i = 0; i < numSwapchainsPerFrame; i++ )
+	{
+		int32_t w, h;
+		tsoGetDesiredSwapchainSize( ctx, i, &w, &h );
+		if( w != ctx->tsoSwapchains[i].width || h != ctx->tsoSwapchains[i].height ) return 1;
+	}
+	return 0;
+}
 
-	int numSwapchainsPerFrame = ctx->numSwapchainsPerFrame = (ctx->flags & TSO_DOUBLEWIDE)?1:tsoNumViewConfigs;
+// Find an unused pooled swapchain matching the key, or make a new one.  Returns the pool index in entryOut.
+static int tsoSwapchainPoolGet( tsoContext * ctx, int64_t format, int32_t width, int32_t height, uint32_t arraySize, uint32_t sampleCount, int * entryOut )
+{
+	int i;
+	XrResult result;
+	tsoSwapchainPoolEntry * e;
 
-	*tsoSwapchains = realloc( *tsoSwapchains, numSwapchainsPerFrame * sizeof( tsoSwapchainInfo ) );
-	*tsoSwapchainLengths = realloc( *tsoSwapchainLengths, numSwapchainsPerFrame * sizeof( uint32_t ) );
-	for (uint32_t i = 0; i < numSwapchainsPerFrame; i++)
+	for( i = 0; i < ctx->tsoSwapchainPoolSize; i++ )
 	{
-		XrSwapchainCreateInfo sci = { XR_TYPE_SWAPCHAIN_CREATE_INFO };
-		sci.createFlags = 0;
-		sci.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
-		sci.format = swapchainFormatToUse;
-		sci.sampleCount = 1;
-		sci.width = tsoViewConfigs[i].recommendedImageRectWidth * ((ctx->flags & TSO_DOUBLEWIDE)?tsoNumViewConfigs:1);
-		sci.height = tsoViewConfigs[i].recommendedImageRectHeight;
-		sci.faceCount = 1;
-		sci.arraySize = 1;
-		sci.mipCount = 1;
-
-		XrSwapchain swapchainHandle;
-		result = xrCreateSwapchain(tsoSession, &sci, &swapchainHandle);
-		if (tsoCheck(ctx, result, "xrCreateSwapchain"))
+		e = ctx->tsoSwapchainPool + i;
+		if( !e->inUse && e->format == format && e->width == width && e->height == height &&
+			e->arraySize == arraySize && e->sampleCount == sampleCount )
 		{
-			return result;
+			e->inUse = 1;
+			e->lastUsed = ++ctx->tsoSwapchainPoolAge;
+			*entryOut = i;
+			return 0;
 		}
+	}
 
-		(*tsoSwapchains)[i].handle = swapchainHandle;
-		(*tsoSwapchains)[i].width = sci.width;
-		(*tsoSwapchains)[i].height = sci.height;
+	XrSwapchainCreateInfo sci = { XR_TYPE_SWAPCHAIN_CREATE_INFO };
+	sci.createFlags = 0;
+	sci.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+	sci.format = format;
+	sci.sampleCount = sampleCount;
+	sci.width = width;
+	sci.height = height;
+	sci.faceCount = 1;
+	sci.arraySize = arraySize;
+	sci.mipCount = 1;
+
+	XrSwapchain swapchainHandle;
+	result = xrCreateSwapchain(ctx->tsoSession, &sci, &swapchainHandle);
+	if (tsoCheck(ctx, result, "xrCreateSwapchain"))
+	{
+		return result;
+	}
 
-		result = xrEnumerateSwapchainImages((*tsoSwapchains)[i].handle, 0, &(*tsoSwapchainLengths)[i], NULL);
-		if (tsoCheck(ctx, result, "xrEnumerateSwapchainImages [view]"))
-		{
-			return result;
-		}
+	uint32_t length;
+	result = xrEnumerateSwapchainImages(swapchainHandle, 0, &length, NULL);
+	if (tsoCheck(ctx, result, "xrEnumerateSwapchainImages [view]"))
+	{
+		xrDestroySwapchain( swapchainHandle );
+		return result;
 	}
 
-	*tsoSwapchainImages = realloc( *tsoSwapchainImages, numSwapchainsPerFrame * sizeof( XrSwapchainImageOpenGLKHR * ) ); 
-	for (uint32_t i = 0; i < numSwapchainsPerFrame; i++)
+	XrSwapchainImageOpenGLKHR * images = malloc( length * sizeof(XrSwapchainImageOpenGLKHR) );
+	for (uint32_t j = 0; j < length; j++)
 	{
-		(*tsoSwapchainImages)[i] = malloc( (*tsoSwapchainLengths)[i] * sizeof(XrSwapchainImageOpenGLKHR) );
-		for (uint32_t j = 0; j < (*tsoSwapchainLengths)[i]; j++)
-		{
 #ifdef ANDROID
-			(*tsoSwapchainImages)[i][j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR;
+		images[j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR;
 #else
-			(*tsoSwapchainImages)[i][j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
+		images[j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
 #endif
-			(*tsoSwapchainImages)[i][j].next = NULL;
-		}
-
-		result = xrEnumerateSwapchainImages((*tsoSwapchains)[i].handle, (*tsoSwapchainLengths)[i], &(*tsoSwapchainLengths)[i],
-											(XrSwapchainImageBaseHeader*)((*tsoSwapchainImages)[i]));
-
-		if (tsoCheck(ctx, result, "xrEnumerateSwapchainImages [final]"))
-		{
-			return result;
-		}
+		images[j].next = NULL;
 	}
-	
-	return 0;
-}
-
 
-int tsoBeginSession( tsoContext * ctx )
-{
-	XrResult result;
-	XrViewConfigurationType stereoViewConfigType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
-	XrSessionBeginInfo sbi;
-	sbi.type = XR_TYPE_SESSION_BEGIN_INFO;
-	sbi.next = NULL;
-	sbi.primaryViewConfigurationType = stereoViewConfigType;
-
-	result = xrBeginSession(ctx->tsoSession, &sbi);
-	if (tsoCheck(ctx, result, "xrBeginSession"))
+	result = xrEnumerateSwapchainImages(swapchainHandle, length, &length, (XrSwapchainImageBaseHeader*)images);
+	if (tsoCheck(ctx, result, "xrEnumerateSwapchainImages [final]"))
 	{
+		free( images );
+		xrDestroySwapchain( swapchainHandle );
 		return result;
 	}
 
+	ctx->tsoSwapchainPool = realloc( ctx->tsoSwapchainPool, ( ctx->tsoSwapchainPoolSize + 1 ) * sizeof( tsoSwapchainPoolEntry ) );
+	e = ctx->tsoSwapchainPool + ctx->tsoSwapchainPoolSize;
+	e->handle = swapchainHandle;
+	e->format = format;
+	e->width = width;
+	e->height = height;
+	e->arraySize = arraySize;
+	e->sampleCount = sampleCount;
+	e->length = length;
+	e->images = images;
+	e->inUse = 1;
+	e->lastUsed = ++ctx->tsoSwapchainPoolAge;
+	*entryOut = ctx->tsoSwapchainPoolSize++;
 	return 0;
 }
 
-
-int tsoSyncInput( tsoContext * ctx )
+int tsoTrimSwapchainPool( tsoContext * ctx, int keep )
 {
-	XrSession tsoSession = ctx->tsoSession;
-	XrActionSet tsoActionSet = ctx->tsoActionSet;
-	XrResult result;
-
-	// syncInput
+	int i;
+	int ret = 0;
+	while( 1 )
+	{
+		int unused = 0;
+		int oldest = -1;
+		for( i = 0; i < ctx->tsoSwapchainPoolSize; i++ )
+		{
+			const tsoSwapchainPoolEntry * e = ctx->tsoSwapchainPool + i;
+			if( e->inUse ) continue;
+			unused++;
+			if( oldest < 0 || e->lastUsed < ctx->tsoSwapchainPool[oldest].lastUsed ) oldest = i;
+		}
+		if( unused <= keep ) break;
+
+		tsoSwapchainPoolEntry * e = ctx->tsoSwapchainPool + oldest;
+		XrResult result = xrDestroySwapchain( e->handle );
+		if( tsoCheck(ctx, result, "xrDestroySwapchain") ) ret = result;
+		free( e->images );
+		*e = ctx->tsoSwapchainPool[--ctx->tsoSwapchainPoolSize];
+	}
+	return ret;
+}
+
+int tsoCreateSwapchains( tsoContext * ctx )
+{
+	int tsoNumViewConfigs = ctx->tsoNumViewConfigs;
+	int i;
+	XrResult result;
+
+	if( !ctx->tsoSwapchainFormats )
+	{
+		if( ( result = tsoEnumerateSwapchainFormats( ctx ) ) ) return result;
+	}
+
+	int numSwapchainsPerFrame = tsoNumViewConfigs / tsoViewsPerSwapchain( ctx );
+	int * entries = alloca( numSwapchainsPerFrame * sizeof( int ) );
+
+	// Hand everything back to the pool first so matching configurations get reused.
+	for( i = 0; i < ctx->tsoSwapchainPoolSize; i++ )
+		ctx->tsoSwapchainPool[i].inUse = 0;
+
+	for( i = 0; i < numSwapchainsPerFrame; i++ )
+	{
+		int32_t w, h;
+		tsoGetDesiredSwapchainSize( ctx, i, &w, &h );
+		if( ( result = tsoSwapchainPoolGet( ctx, ctx->tsoSwapchainFormat, w, h, 1, 1, &entries[i] ) ) )
+		{
+			ctx->numSwapchainsPerFrame = 0;
+			return result;
+		}
+	}
+
+	// The pool may have been realloc'd above, so only resolve entries now.
+	ctx->tsoSwapchains = realloc( ctx->tsoSwapchains, numSwapchainsPerFrame * sizeof( tsoSwapchainInfo ) );
+	ctx->tsoSwapchainLengths = realloc( ctx->tsoSwapchainLengths, numSwapchainsPerFrame * sizeof( uint32_t ) );
+	ctx->tsoSwapchainImages = realloc( ctx->tsoSwapchainImages, numSwapchainsPerFrame * sizeof( XrSwapchainImageOpenGLKHR * ) );
+	for( i = 0; i < numSwapchainsPerFrame; i++ )
+	{
+		const tsoSwapchainPoolEntry * e = ctx->tsoSwapchainPool + entries[i];
+		ctx->tsoSwapchains[i].handle = e->handle;
+		ctx->tsoSwapchains[i].width = e->width;
+		ctx->tsoSwapchains[i].height = e->height;
+		ctx->tsoSwapchainLengths[i] = e->length;
+		ctx->tsoSwapchainImages[i] = e->images;
+	}
+	ctx->numSwapchainsPerFrame = numSwapchainsPerFrame;
+
+	// Anything saved for TSO_HALF_RATE may reference swapchains that are no longer current.
+	ctx->tsoLastViewCount = 0;
+
+	return tsoTrimSwapchainPool( ctx, TSO_SWAPCHAIN_POOL_SPARE );
+}
+
+
+int tsoBeginSession( tsoContext * ctx )
+{
+	XrResult result;
+	XrSessionBeginInfo sbi;
+	sbi.type = XR_TYPE_SESSION_BEGIN_INFO;
+	sbi.next = NULL;
+	sbi.primaryViewConfigurationType = ctx->tsoViewConfigType;
+
+	result = xrBeginSession(ctx->tsoSession, &sbi);
+	if (tsoCheck(ctx, result, "xrBeginSession"))
+	{
+		return result;
+	}
+
+	return 0;
+}
+
+
+int tsoSyncInput( tsoContext * ctx )
+{
+	XrSession tsoSession = ctx->tsoSession;
+	XrActionSet tsoActionSet = ctx->tsoActionSet;
+	XrResult result;
+
+	// syncInput
 	XrActiveActionSet aas;
 	aas.actionSet = tsoActionSet;
 	aas.subactionPath = XR_NULL_PATH;
@@ -1014,6 +2017,497 @@ int tsoSyncInput( tsoContext * ctx )
 	return 0;
 }
 
+// For tsoSoftwareInset, add an inset after the located views: same pose, fov cut down to
+// tsoInsetFraction of the view's extent around straight ahead (in tangent space).
+// Returns nonzero if the insets were added.
+static int tsoSoftwareInsetViews( tsoContext * ctx, XrView * views, uint32_t * viewCount )
+{
+	uint32_t n = *viewCount;
+	uint32_t i;
+	if( !ctx->tsoSoftwareInset || n * 2 > (uint32_t)ctx->tsoNumViewConfigs ) return 0;
+
+	for( i = 0; i < n; i++ )
+	{
+		const XrFovf * fov = &views[i].fov;
+		float l = tanf( fov->angleLeft ), r = tanf( fov->angleRight );
+		float d = tanf( fov->angleDown ), u = tanf( fov->angleUp );
+		float hw = ( r - l ) * 0.5f * ctx->tsoInsetFraction;
+		float hh = ( u - d ) * 0.5f * ctx->tsoInsetFraction;
+
+		// Centered on the view axis, but kept inside the full view.
+		float cx = 0, cy = 0;
+		if( cx - hw < l ) cx = l + hw;
+		if( cx + hw > r ) cx = r - hw;
+		if( cy - hh < d ) cy = d + hh;
+		if( cy + hh > u ) cy = u - hh;
+
+		XrView * inset = views + n + i;
+		*inset = views[i];
+		inset->fov.angleLeft = atanf( cx - hw );
+		inset->fov.angleRight = atanf( cx + hw );
+		inset->fov.angleDown = atanf( cy - hh );
+		inset->fov.angleUp = atanf( cy + hh );
+	}
+	*viewCount = n * 2;
+	return 1;
+}
+
+static double tsoXrTimeToAbsolute( tsoContext * ctx, XrTime time )
+{
+	if( !ctx->tsoConvertTime ) return 0;
+#ifdef XR_USE_PLATFORM_WIN32
+	LARGE_INTEGER li, freq;
+	if( ((PFN_xrConvertTimeToWin32PerformanceCounterKHR)ctx->tsoConvertTime)( ctx->tsoInstance, time, &li ) != XR_SUCCESS ) return 0;
+	QueryPerformanceFrequency( &freq );
+	return (double)li.QuadPart / (double)freq.QuadPart;
+#else
+	struct timespec ts;
+	if( ((PFN_xrConvertTimeToTimespecTimeKHR)ctx->tsoConvertTime)( ctx->tsoInstance, time, &ts ) != XR_SUCCESS ) return 0;
+	return ts.tv_sec + ts.tv_nsec * 0.000000001;
+#endif
+}
+
+static void tsoFrameFenceInsert( tsoContext * ctx, double beginTime, XrTime displayTime )
+{
+	if( !tsoglFenceSync ) return;
+
+	tsoFrameFence * f = &ctx->tsoFrameFences[ctx->tsoFrameNumber % TSO_FRAME_FENCES];
+
+	// Not signaled after TSO_FRAME_FENCES frames.  Give up on it rather than wait.
+	if( f->sync ) tsoglDeleteSync( f->sync );
+
+	f->frameNumber = ctx->tsoFrameNumber;
+	f->beginTime = beginTime;
+	f->displayTime = tsoXrTimeToAbsolute( ctx, displayTime );
+
+	// A timestamp next to the fence.  Reading the GPU clock itself is a round trip, so the
+	// offset between the two clocks is only measured every TSO_GPU_CLOCK_RECALIBRATE seconds.
+	f->submitTime = OGGetAbsoluteTime();
+	f->timed = 0;
+	if( tsoglQueryCounter && tsoglGetQueryObjectui64v && tsoglGetInteger64v )
+	{
+		if( !ctx->tsoGPUClockCalibrated || f->submitTime - ctx->tsoGPUClockCalibrated >= TSO_GPU_CLOCK_RECALIBRATE )
+		{
+			int64_t gpuNow = 0;
+			tsoglGetInteger64v( GL_TIMESTAMP, &gpuNow );
+			ctx->tsoGPUClockCalibrated = OGGetAbsoluteTime();
+			ctx->tsoGPUClockOffset = ctx->tsoGPUClockCalibrated - gpuNow * 0.000000001;
+		}
+		if( !f->query ) tsoglGenQueries( 1, &f->query );
+		tsoglQueryCounter( f->query, GL_TIMESTAMP );
+		f->gpuClockOffset = ctx->tsoGPUClockOffset;
+		f->timed = 1;
+	}
+	f->sync = tsoglFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+static void tsoFrameFencePoll( tsoContext * ctx )
+{
+	tsoFrameStats * stats = &ctx->tsoStats;
+	int slot, depth = 0;
+	if( !tsoglClientWaitSync ) return;
+
+	double now = OGGetAbsoluteTime();
+	for( slot = 0; slot < TSO_FRAME_FENCES; slot++ )
+	{
+		tsoFrameFence * f = &ctx->tsoFrameFences[slot];
+		if( !f->sync ) continue;
+
+		// The flush bit makes sure the fence reaches the GPU, without waiting for it.
+		GLenum status = tsoglClientWaitSync( f->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0 );
+		if( status == GL_TIMEOUT_EXPIRED )
+		{
+			depth++;
+			continue;
+		}
+		tsoglDeleteSync( f->sync );
+		f->sync = 0;
+		if( status == GL_WAIT_FAILED || f->frameNumber <= stats->gpuDoneFrameNumber ) continue;
+
+		double done = now;
+		if( f->timed )
+		{
+			uint64_t stamp = 0;
+			tsoglGetQueryObjectui64v( f->query, GL_QUERY_RESULT, &stamp );
+			done = f->gpuClockOffset + (double)stamp * 0.000000001;
+		}
+
+		stats->gpuDoneAfterBegin = done - f->beginTime;
+		stats->gpuLatency = ( done > f->submitTime ) ? done - f->submitTime : 0;
+		stats->gpuDoneBeforeDisplay = f->displayTime ? f->displayTime - done : 0;
+		stats->gpuDoneFrameNumber = f->frameNumber;
+	}
+	stats->gpuQueueDepth = depth;
+}
+
+int tsoEnableLateLatch( tsoContext * ctx, int enable )
+{
+	int i;
+	if( !enable )
+	{
+		for( i = 0; i < TSO_LATE_LATCH_SLOTS; i++ )
+		{
+			if( ctx->tsoLateLatchFences[i] ) tsoglDeleteSync( ctx->tsoLateLatchFences[i] );
+			ctx->tsoLateLatchFences[i] = 0;
+		}
+		if( ctx->tsoLateLatchStart ) tsoglDeleteSync( ctx->tsoLateLatchStart );
+		ctx->tsoLateLatchStart = 0;
+		ctx->tsoLateLatchSlot = -1;
+		if( ctx->tsoLateLatchFallback ) tsoglDeleteBuffers( 1, &ctx->tsoLateLatchFallback );
+		ctx->tsoLateLatchFallback = 0;
+		if( ctx->tsoLateLatchBuffer )
+		{
+			tsoglBindBuffer( GL_UNIFORM_BUFFER, ctx->tsoLateLatchBuffer );
+			tsoglUnmapBuffer( GL_UNIFORM_BUFFER );
+			tsoglBindBuffer( GL_UNIFORM_BUFFER, 0 );
+			tsoglDeleteBuffers( 1, &ctx->tsoLateLatchBuffer );
+		}
+		ctx->tsoLateLatchBuffer = 0;
+		ctx->tsoLateLatchMap = 0;
+		ctx->tsoLateLatch = 0;
+		return 0;
+	}
+
+	if( ctx->tsoLateLatch ) return 0;
+
+	tsoLoadGL( ctx );
+	if( !tsoglGenBuffers || !tsoglBufferData || !tsoglBufferStorage || !tsoglMapBufferRange || !tsoglBindBufferRange ||
+		!tsoglFenceSync || !tsoglClientWaitSync || !tsoglDeleteSync )
+	{
+		TSOPENXR_ERROR( "Late latching requested, but persistent buffer mapping is not available.\n" );
+		return -1;
+	}
+
+	GLint align = 256;
+	glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align );
+	if( align < 16 ) align = 16;
+	int size = 3 * TSO_MAX_VIEWS * 16 * sizeof( float );
+	ctx->tsoLateLatchSlotSize = ( size + align - 1 ) / align * align;
+
+	const GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	tsoglGenBuffers( 1, &ctx->tsoLateLatchBuffer );
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, ctx->tsoLateLatchBuffer );
+	tsoglBufferStorage( GL_UNIFORM_BUFFER, ctx->tsoLateLatchSlotSize * TSO_LATE_LATCH_SLOTS, 0, mapFlags );
+	ctx->tsoLateLatchMap = tsoglMapBufferRange( GL_UNIFORM_BUFFER, 0, ctx->tsoLateLatchSlotSize * TSO_LATE_LATCH_SLOTS, mapFlags );
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, 0 );
+	if( !ctx->tsoLateLatchMap )
+	{
+		TSOPENXR_ERROR( "Could not map late latch buffer.\n" );
+		tsoglDeleteBuffers( 1, &ctx->tsoLateLatchBuffer );
+		ctx->tsoLateLatchBuffer = 0;
+		return -1;
+	}
+
+	tsoglGenBuffers( 1, &ctx->tsoLateLatchFallback );
+	ctx->tsoLateLatch = 1;
+	return 0;
+}
+
+void tsoLateLatchBindProgram( uint32_t program )
+{
+	GLuint block = tsoglGetUniformBlockIndex( program, "tsoLateLatchBlock" );
+	if( block != 0xffffffff )
+		tsoglUniformBlockBinding( program, block, TSO_LATE_LATCH_BINDING );
+}
+
+static void tsoLateLatchWrite( const tsoViewMatrices * matrices, float * slot, int viewCount )
+{
+	int i;
+	if( viewCount > TSO_MAX_VIEWS ) viewCount = TSO_MAX_VIEWS;
+	for( i = 0; i < viewCount; i++ )
+	{
+		memcpy( slot + ( 0 * TSO_MAX_VIEWS + i ) * 16, matrices[i].viewProj, 16 * sizeof( float ) );
+		memcpy( slot + ( 1 * TSO_MAX_VIEWS + i ) * 16, matrices[i].view, 16 * sizeof( float ) );
+		memcpy( slot + ( 2 * TSO_MAX_VIEWS + i ) * 16, matrices[i].invView, 16 * sizeof( float ) );
+	}
+}
+
+static void tsoLateLatchBegin( tsoContext * ctx, const XrCompositionLayerProjectionView * projectionLayerViews, int viewCount )
+{
+	int slot = ctx->tsoFrameNumber % TSO_LATE_LATCH_SLOTS;
+
+	// Early matrices, in case the GPU starts on the draws before the late update.
+	tsoComputeViewMatrices( ctx, projectionLayerViews, viewCount );
+
+	// The GPU is normally done with a slot long before we come back around to it.  If it
+	// is not, don't stall the frame loop on it; this frame just doesn't get latched.
+	void * fence = ctx->tsoLateLatchFences[slot];
+	if( fence )
+	{
+		if( tsoglClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0 ) == GL_TIMEOUT_EXPIRED )
+		{
+			float early[3 * TSO_MAX_VIEWS * 16] = { 0 };
+			tsoLateLatchWrite( ctx->tsoMatrices, early, viewCount );
+			tsoglBindBuffer( GL_UNIFORM_BUFFER, ctx->tsoLateLatchFallback );
+			tsoglBufferData( GL_UNIFORM_BUFFER, sizeof( early ), early, GL_STREAM_DRAW );
+			tsoglBindBuffer( GL_UNIFORM_BUFFER, 0 );
+			tsoglBindBufferRange( GL_UNIFORM_BUFFER, TSO_LATE_LATCH_BINDING, ctx->tsoLateLatchFallback, 0, sizeof( early ) );
+			ctx->tsoLateLatchSlot = -1;
+			ctx->tsoStats.lateLatchSkipped++;
+			return;
+		}
+		tsoglDeleteSync( fence );
+		ctx->tsoLateLatchFences[slot] = 0;
+	}
+
+	ctx->tsoLateLatchSlot = slot;
+	tsoLateLatchWrite( ctx->tsoMatrices, (float*)( ctx->tsoLateLatchMap + slot * ctx->tsoLateLatchSlotSize ), viewCount );
+	tsoglBindBufferRange( GL_UNIFORM_BUFFER, TSO_LATE_LATCH_BINDING, ctx->tsoLateLatchBuffer,
+		slot * ctx->tsoLateLatchSlotSize, ctx->tsoLateLatchSlotSize );
+
+	// Commands run in order, so until this signals none of the frame's draws have started.
+	ctx->tsoLateLatchStart = tsoglFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
+
+static void tsoLateLatchEnd( tsoContext * ctx, XrViewLocateInfo * vli, XrView * views, int viewCount )
+{
+	XrViewState viewState = { XR_TYPE_VIEW_STATE };
+	uint32_t viewCountOutput = 0;
+	uint32_t releases;
+	int i;
+	int slot = ctx->tsoLateLatchSlot;
+
+	// Skipped in tsoLateLatchBegin; nothing was held back.
+	if( slot < 0 ) return;
+
+	// No flush, that would hand the draws to the GPU.  If the driver already did, it may be
+	// reading the slot, so leave it alone rather than have it see half of each matrix.
+	if( tsoglClientWaitSync( ctx->tsoLateLatchStart, 0, 0 ) != GL_TIMEOUT_EXPIRED )
+	{
+		ctx->tsoStats.lateLatchSkipped++;
+	}
+	else
+	{
+		// Poses predicted later are predicted better.  Ask again for the same display time.
+		XrResult result = xrLocateViews( ctx->tsoSession, vli, &viewState, ctx->tsoNumViewConfigs, &viewCountOutput, views );
+		if( result == XR_SUCCESS ) tsoSoftwareInsetViews( ctx, views, &viewCountOutput );
+		if( result == XR_SUCCESS && (int)viewCountOutput == viewCount &&
+			( viewState.viewStateFlags & XR_VIEW_STATE_ORIENTATION_VALID_BIT ) )
+		{
+			// Same fov, so the projections from tsoLateLatchBegin still hold.
+			tsoViewMatrices late[TSO_MAX_VIEWS];
+			if( viewCount > TSO_MAX_VIEWS ) viewCount = TSO_MAX_VIEWS;
+			for( i = 0; i < viewCount; i++ )
+			{
+				tsoUtilInitPoseMat( late[i].invView, &views[i].pose );
+				tsoInvertOrthogonalMat( late[i].view, late[i].invView );
+				tsoMultiplyMat( late[i].viewProj, ctx->tsoMatrices[i].proj, late[i].view );
+			}
+			tsoLateLatchWrite( late, (float*)( ctx->tsoLateLatchMap + slot * ctx->tsoLateLatchSlotSize ), viewCount );
+		}
+	}
+	tsoglDeleteSync( ctx->tsoLateLatchStart );
+	ctx->tsoLateLatchStart = 0;
+
+	ctx->tsoLateLatchFences[slot] = tsoglFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+	// Now the images can go.
+	releases = ctx->tsoLateLatchReleases;
+	ctx->tsoLateLatchSlot = -1;
+	ctx->tsoLateLatchReleases = 0;
+	for( i = 0; releases; i++, releases >>= 1 )
+		if( releases & 1 ) tsoReleaseSwapchain( ctx, i );
+	glFlush();
+}
+
+int tsoQuadLayerCreate( tsoContext * ctx, tsoQuadLayer * ql, int width, int height, float sizeX, float sizeY, tsoQuadLayerRenderFunction_t render )
+{
+	if( ctx->tsoNumQuadLayers >= TSO_MAX_QUAD_LAYERS )
+	{
+		TSOPENXR_ERROR( "Too many quad layers, raise TSO_MAX_QUAD_LAYERS.\n" );
+		return -1;
+	}
+
+	memset( ql, 0, sizeof( *ql ) );
+	ql->pose.orientation.w = 1;
+	ql->sizeX = sizeX;
+	ql->sizeY = sizeY;
+	ql->visible = 1;
+	ql->layerFlags = XR_COMPOSITION_LAYER_BLEND_TEXTURE_SOURCE_ALPHA_BIT;
+	ql->width = width;
+	ql->height = height;
+	ql->dirty = 1;
+	ql->render = render;
+	ctx->tsoQuadLayers[ctx->tsoNumQuadLayers++] = ql;
+	return 0;
+}
+
+void tsoQuadLayerDestroy( tsoContext * ctx, tsoQuadLayer * ql )
+{
+	int i;
+	for( i = 0; i < ctx->tsoNumQuadLayers; i++ )
+	{
+		if( ctx->tsoQuadLayers[i] != ql ) continue;
+		memmove( ctx->tsoQuadLayers + i, ctx->tsoQuadLayers + i + 1, ( ctx->tsoNumQuadLayers - i - 1 ) * sizeof( tsoQuadLayer * ) );
+		ctx->tsoNumQuadLayers--;
+		break;
+	}
+	if( ql->swapchain ) xrDestroySwapchain( ql->swapchain );
+	ql->swapchain = XR_NULL_HANDLE;
+}
+
+// A static image can only be acquired once, so new content means a new swapchain.
+// Dynamic layers keep theirs for as long as the size stays the same.
+static int tsoQuadLayerUpdate( tsoContext * ctx, tsoQuadLayer * ql )
+{
+	XrResult result;
+	XrSwapchain swapchainHandle = ql->swapchain;
+	int reuse = ql->dynamic && ql->swapchain && ql->swapchainDynamic &&
+		ql->swapchainWidth == ql->width && ql->swapchainHeight == ql->height;
+
+	// The old image stays up until a new one is complete; on failure we try again next frame.
+	if( !reuse )
+	{
+		XrSwapchainCreateInfo sci = { XR_TYPE_SWAPCHAIN_CREATE_INFO };
+		sci.createFlags = ql->dynamic ? 0 : XR_SWAPCHAIN_CREATE_STATIC_IMAGE_BIT;
+		sci.usageFlags = XR_SWAPCHAIN_USAGE_SAMPLED_BIT | XR_SWAPCHAIN_USAGE_COLOR_ATTACHMENT_BIT;
+		sci.format = ctx->tsoSwapchainFormat;
+		sci.sampleCount = 1;
+		sci.width = ql->width;
+		sci.height = ql->height;
+		sci.faceCount = 1;
+		sci.arraySize = 1;
+		sci.mipCount = 1;
+
+		result = xrCreateSwapchain( ctx->tsoSession, &sci, &swapchainHandle );
+		if( XR_FAILED( result ) && sci.createFlags )
+		{
+			// Still only acquired once per update, just without the runtime knowing it.
+			sci.createFlags = 0;
+			result = xrCreateSwapchain( ctx->tsoSession, &sci, &swapchainHandle );
+		}
+		if( tsoCheck( ctx, result, "xrCreateSwapchain [quad]" ) )
+		{
+			return result;
+		}
+	}
+
+	uint32_t length;
+	result = xrEnumerateSwapchainImages( swapchainHandle, 0, &length, NULL );
+	if( tsoCheck( ctx, result, "xrEnumerateSwapchainImages [quad]" ) || length == 0 )
+	{
+		if( !reuse ) xrDestroySwapchain( swapchainHandle );
+		return result ? result : -1;
+	}
+
+	XrSwapchainImageOpenGLKHR * images = alloca( length * sizeof( XrSwapchainImageOpenGLKHR ) );
+	for( uint32_t j = 0; j < length; j++ )
+	{
+#ifdef ANDROID
+		images[j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_ES_KHR;
+#else
+		images[j].type = XR_TYPE_SWAPCHAIN_IMAGE_OPENGL_KHR;
+#endif
+		images[j].next = NULL;
+	}
+	result = xrEnumerateSwapchainImages( swapchainHandle, length, &length, (XrSwapchainImageBaseHeader*)images );
+	if( tsoCheck( ctx, result, "xrEnumerateSwapchainImages [quad final]" ) )
+	{
+		if( !reuse ) xrDestroySwapchain( swapchainHandle );
+		return result;
+	}
+
+	uint32_t index;
+	XrSwapchainImageAcquireInfo ai = { XR_TYPE_SWAPCHAIN_IMAGE_ACQUIRE_INFO };
+	result = xrAcquireSwapchainImage( swapchainHandle, &ai, &index );
+	if( tsoCheck( ctx, result, "xrAcquireSwapchainImage [quad]" ) )
+	{
+		if( !reuse ) xrDestroySwapchain( swapchainHandle );
+		return result;
+	}
+	XrSwapchainImageWaitInfo wi = { XR_TYPE_SWAPCHAIN_IMAGE_WAIT_INFO };
+	wi.timeout = XR_INFINITE_DURATION;
+	result = xrWaitSwapchainImage( swapchainHandle, &wi );
+	if( tsoCheck( ctx, result, "xrWaitSwapchainImage [quad]" ) )
+	{
+		if( !reuse ) xrDestroySwapchain( swapchainHandle );
+		return result;
+	}
+
+	tsoLoadGL( ctx );
+
+	// Put the caller's framebuffers and viewport back once the panel is drawn.
+	GLint drawFBO = 0, readFBO = 0, viewport[4];
+	glGetIntegerv( GL_DRAW_FRAMEBUFFER_BINDING, &drawFBO );
+	glGetIntegerv( GL_READ_FRAMEBUFFER_BINDING, &readFBO );
+	glGetIntegerv( GL_VIEWPORT, viewport );
+
+	if( !ctx->tsoQuadLayerFBO ) tsoglGenFramebuffers( 1, &ctx->tsoQuadLayerFBO );
+	tsoglBindFramebuffer( GL_FRAMEBUFFER, ctx->tsoQuadLayerFBO );
+	tsoglFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, images[index].image, 0 );
+	glViewport( 0, 0, ql->width, ql->height );
+	int r = ql->render ? ql->render( ctx, ql ) : 0;
+	tsoglFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0 );
+	tsoglBindFramebuffer( GL_DRAW_FRAMEBUFFER, drawFBO );
+	tsoglBindFramebuffer( GL_READ_FRAMEBUFFER, readFBO );
+	glViewport( viewport[0], viewport[1], viewport[2], viewport[3] );
+
+	XrSwapchainImageReleaseInfo ri = { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
+	result = xrReleaseSwapchainImage( swapchainHandle, &ri );
+	if( tsoCheck( ctx, result, "xrReleaseSwapchainImage [quad]" ) || r )
+	{
+		if( !reuse ) xrDestroySwapchain( swapchainHandle );
+		return result ? result : r;
+	}
+
+	if( !reuse )
+	{
+		if( ql->swapchain ) xrDestroySwapchain( ql->swapchain );
+		ql->swapchain = swapchainHandle;
+		ql->swapchainWidth = ql->width;
+		ql->swapchainHeight = ql->height;
+		ql->swapchainDynamic = ql->dynamic;
+	}
+	ql->dirty = 0;
+	return 0;
+}
+
+static int tsoQuadLayersSubmit( tsoContext * ctx, XrCompositionLayerQuad * quads, const XrCompositionLayerBaseHeader ** layers )
+{
+	int i;
+	int count = 0;
+	for( i = 0; i < ctx->tsoNumQuadLayers; i++ )
+	{
+		tsoQuadLayer * ql = ctx->tsoQuadLayers[i];
+		if( !ql->visible ) continue;
+		if( ql->dirty ) tsoQuadLayerUpdate( ctx, ql );
+		if( !ql->swapchain ) continue;
+
+		XrCompositionLayerQuad * q = quads + count;
+		memset( q, 0, sizeof( *q ) );
+		q->type = XR_TYPE_COMPOSITION_LAYER_QUAD;
+		q->layerFlags = ql->layerFlags;
+		q->space = ctx->tsoStageSpace;
+		q->eyeVisibility = XR_EYE_VISIBILITY_BOTH;
+		q->subImage.swapchain = ql->swapchain;
+		q->subImage.imageRect.extent.width = ql->width;
+		q->subImage.imageRect.extent.height = ql->height;
+		q->pose = ql->pose;
+		q->size.width = ql->sizeX;
+		q->size.height = ql->sizeY;
+		layers[count++] = (XrCompositionLayerBaseHeader *)q;
+	}
+	return count;
+}
+
+// Only the eye passes run in [0,1] clip space; saved[3] holds the caller's state to go back to.
+static void tsoReverseZBegin( tsoContext * ctx, GLint * saved )
+{
+	if( !ctx->tsoReverseZ ) return;
+	glGetIntegerv( GL_CLIP_ORIGIN, &saved[0] );
+	glGetIntegerv( GL_CLIP_DEPTH_MODE, &saved[1] );
+	glGetIntegerv( GL_DEPTH_FUNC, &saved[2] );
+	tsoglClipControl( GL_LOWER_LEFT, GL_ZERO_TO_ONE );
+	glDepthFunc( GL_GEQUAL );
+}
+
+static void tsoReverseZEnd( tsoContext * ctx, const GLint * saved )
+{
+	if( !ctx->tsoReverseZ ) return;
+	tsoglClipControl( saved[0], saved[1] );
+	glDepthFunc( saved[2] );
+}
+
 int tsoRenderFrame( tsoContext * ctx )
 {
 	XrSession tsoSession = ctx->tsoSession;
@@ -1028,12 +2522,24 @@ int tsoRenderFrame( tsoContext * ctx )
 	fwi.type = XR_TYPE_FRAME_WAIT_INFO;
 	fwi.next = NULL;
 
+	tsoFrameStats * stats = &ctx->tsoStats;
+	double timeStart = OGGetAbsoluteTime();
+	double timeMark;
+
+	tsoFrameFencePoll( ctx );
+
 	XrResult result = xrWaitFrame(tsoSession, &fwi, &fs);
 	if (tsoCheck(ctx, result, "xrWaitFrame"))
 	{
 		return result;
 	}
 
+	timeMark = OGGetAbsoluteTime();
+	stats->cpuWaitFrame = timeMark - timeStart;
+
+	// Most of the time the GPU finishes while we block in xrWaitFrame.
+	tsoFrameFencePoll( ctx );
+
 	XrFrameBeginInfo fbi;
 	fbi.type = XR_TYPE_FRAME_BEGIN_INFO;
 	fbi.next = NULL;
@@ -1043,11 +2549,16 @@ int tsoRenderFrame( tsoContext * ctx )
 		return result;
 	}
 
+	double timeBegun = OGGetAbsoluteTime();
+	stats->cpuBeginFrame = timeBegun - timeMark;
+	stats->cpuRender = 0;
+	ctx->tsoFrameNumber++;
+
 	// Potentially resize.
 	tsoEnumeratetsoViewConfigs( ctx );
 	
-	// Originally written this way to allow for  || ctx->tsoViewConfigs[0].recommendedImageRectWidth != ctx->tsoSwapchains[0].width  ... But this doesn't work in any current runtimes.
-	if( !ctx->tsoNumViewConfigs || !ctx->tsoSwapchains )
+	// Swapchains are pooled, so switching tsoRenderScale or view configurations back and forth is cheap.
+	if( tsoSwapchainsNeedRecreate( ctx ) )
 	{
 		if ( ( result = tsoCreateSwapchains( ctx ) ) ) return result;
 	}		
@@ -1058,7 +2569,9 @@ int tsoRenderFrame( tsoContext * ctx )
 	layer.next = NULL;
 	layer.space = tsoStageSpace;
 
-	const XrCompositionLayerBaseHeader * layers[1] = { (XrCompositionLayerBaseHeader *)&layer };
+	XrCompositionLayerProjection insetLayer = layer;
+	const XrCompositionLayerBaseHeader * layers[2+TSO_MAX_QUAD_LAYERS] = { (XrCompositionLayerBaseHeader *)&layer };
+	XrCompositionLayerQuad quads[TSO_MAX_QUAD_LAYERS];
 
 	XrView * views = alloca( sizeof( XrView) * tsoNumViewConfigs );
 	for (size_t i = 0; i < tsoNumViewConfigs; i++)
@@ -1072,7 +2585,8 @@ int tsoRenderFrame( tsoContext * ctx )
 
 	XrViewLocateInfo vli;
 	vli.type = XR_TYPE_VIEW_LOCATE_INFO;
-	vli.viewConfigurationType = XR_VIEW_CONFIGURATION_TYPE_PRIMARY_STEREO;
+	vli.next = NULL;
+	vli.viewConfigurationType = ctx->tsoViewConfigType;
 	ctx->tsoPredictedDisplayTime = vli.displayTime = fs.predictedDisplayTime;
 	vli.space = tsoStageSpace;
 	result = xrLocateViews( tsoSession, &vli, &viewState, tsoNumViewConfigs, &viewCountOutput, views );
@@ -1080,69 +2594,211 @@ int tsoRenderFrame( tsoContext * ctx )
 	{
 		return result;
 	}
+	int insetViews = tsoSoftwareInsetViews( ctx, views, &viewCountOutput );
 
 	XrCompositionLayerProjectionView *projectionLayerViews = alloca( viewCountOutput * sizeof( XrCompositionLayerProjectionView ) );
 	memset( projectionLayerViews, 0, sizeof( XrCompositionLayerProjectionView ) * viewCountOutput );
 
 	int i;
 	int viewCounts = (ctx->flags & TSO_DOUBLEWIDE)?1:viewCountOutput;
+	int perSwapchain = tsoViewsPerSwapchain( ctx );
 	for( i = 0; i < viewCountOutput; i++ )
 	{
-		// Each view has a separate swapchain which is acquired, rendered to, and released.
+		// Each swapchain is acquired, rendered to, and released; double-wide ones hold two views side by side.
 		XrCompositionLayerProjectionView * layerView = projectionLayerViews + i;
 		layerView->type = XR_TYPE_COMPOSITION_LAYER_PROJECTION_VIEW;
 		layerView->pose = views[i].pose;
 		layerView->fov = views[i].fov;
-		
-		if( ctx->flags & TSO_DOUBLEWIDE )
-		{
-			const tsoSwapchainInfo * viewSwapchain = ctx->tsoSwapchains;
-			int individualWidth = viewSwapchain->width / viewCountOutput;
-			layerView->subImage.swapchain = viewSwapchain->handle;
-			layerView->subImage.imageRect.offset.x = i*individualWidth;
-			layerView->subImage.imageRect.offset.y = 0;
-			layerView->subImage.imageRect.extent.width = individualWidth;
-			layerView->subImage.imageRect.extent.height = viewSwapchain->height;
-			layerView->subImage.imageArrayIndex = 0;
-		}
-		else
-		{
-			const tsoSwapchainInfo * viewSwapchain = ctx->tsoSwapchains + i;
-			layerView->subImage.swapchain = viewSwapchain->handle;
-			layerView->subImage.imageRect.offset.x = 0;
-			layerView->subImage.imageRect.offset.y = 0;
-			layerView->subImage.imageRect.extent.width = viewSwapchain->width;
-			layerView->subImage.imageRect.extent.height = viewSwapchain->height;
-			layerView->subImage.imageArrayIndex = 0;
-		}
+
+		const tsoSwapchainInfo * viewSwapchain = ctx->tsoSwapchains + i / perSwapchain;
+		int individualWidth = viewSwapchain->width / perSwapchain;
+		layerView->subImage.swapchain = viewSwapchain->handle;
+		layerView->subImage.imageRect.offset.x = ( i % perSwapchain ) * individualWidth;
+		layerView->subImage.imageRect.offset.y = 0;
+		layerView->subImage.imageRect.extent.width = individualWidth;
+		layerView->subImage.imageRect.extent.height = viewSwapchain->height;
+		layerView->subImage.imageArrayIndex = 0;
 	}
 		
-	// We only support up to 1 layer.
+	// The projection layer, if there is one, goes under the quad layers.
 	if (fs.shouldRender == XR_TRUE && XR_UNQUALIFIED_SUCCESS(result))
 	{
-		if (ctx->tsoRenderLayer(ctx, fs.predictedDisplayTime, projectionLayerViews, viewCountOutput) == 0)
+		if( ( ctx->flags & TSO_HALF_RATE ) && ctx->tsoResubmitNext && ctx->tsoLastViewCount == viewCountOutput )
 		{
+			// Off frame: hand the runtime last frame's images with the poses they were
+			// rendered at.  We never acquired, so the last released images are still current.
 			layer.viewCount = viewCountOutput;
-			layer.views = projectionLayerViews;
+			layer.views = ctx->tsoLastProjectionViews;
 			layerCount = 1;
+			ctx->tsoResubmitNext = 0;
 		}
-	}
+		else
+		{
+			timeMark = OGGetAbsoluteTime();
+			tsoGPUTimerBegin( ctx );
+			int rendered;
+			tsoFrustumFromViews( &ctx->tsoCullFrustum, projectionLayerViews, viewCountOutput, ctx->tsoNearZ, ctx->tsoFarZ );
+			if( ctx->tsoLateLatch )
+				tsoLateLatchBegin( ctx, projectionLayerViews, viewCountOutput );
+			GLint clipState[3];
+			tsoReverseZBegin( ctx, clipState );
+			if( ctx->tsoRenderLayerEx )
+			{
+				// tsoLateLatchBegin already did.
+				if( !ctx->tsoLateLatch )
+					tsoComputeViewMatrices( ctx, projectionLayerViews, viewCountOutput );
+				rendered = ctx->tsoRenderLayerEx(ctx, fs.predictedDisplayTime, projectionLayerViews, ctx->tsoMatrices, viewCountOutput);
+			}
+			else
+			{
+				rendered = ctx->tsoRenderLayer(ctx, fs.predictedDisplayTime, projectionLayerViews, viewCountOutput);
+			}
+			tsoReverseZEnd( ctx, clipState );
+			tsoGPUTimerEnd( ctx );
+			stats->cpuRender = OGGetAbsoluteTime() - timeMark;
 
-	XrFrameEndInfo fei = { XR_TYPE_FRAME_END_INFO };
-	fei.displayTime = fs.predictedDisplayTime;
-	fei.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
-	fei.layerCount = layerCount;
-	fei.layers = layers;
+			if( ctx->tsoLateLatch )
+				tsoLateLatchEnd( ctx, &vli, views, viewCountOutput );
+			tsoFrameFenceInsert( ctx, timeBegun, fs.predictedDisplayTime );
 
-	result = xrEndFrame(tsoSession, &fei);
-	if (tsoCheck(ctx, result, "xrEndFrame"))
+			if( rendered == 0 )
+			{
+				layer.viewCount = viewCountOutput;
+				layer.views = projectionLayerViews;
+				layerCount = 1;
+
+				if( ctx->flags & TSO_HALF_RATE )
+				{
+					ctx->tsoLastProjectionViews = realloc( ctx->tsoLastProjectionViews, viewCountOutput * sizeof( XrCompositionLayerProjectionView ) );
+					memcpy( ctx->tsoLastProjectionViews, projectionLayerViews, viewCountOutput * sizeof( XrCompositionLayerProjectionView ) );
+					ctx->tsoLastViewCount = viewCountOutput;
+					ctx->tsoResubmitNext = 1;
+				}
+			}
+			else
+			{
+				ctx->tsoLastViewCount = 0;
+			}
+		}
+	}
+
+	if( layerCount && insetViews )
+	{
+		// The insets go on top as a layer of their own; the compositor only draws a view inside its fov.
+		layer.viewCount /= 2;
+		insetLayer.viewCount = layer.viewCount;
+		insetLayer.views = layer.views + layer.viewCount;
+		layers[layerCount++] = (XrCompositionLayerBaseHeader *)&insetLayer;
+	}
+
+	if( fs.shouldRender == XR_TRUE )
+	{
+		layerCount += tsoQuadLayersSubmit( ctx, quads, layers + layerCount );
+	}
+
+	XrFrameEndInfo fei = { XR_TYPE_FRAME_END_INFO };
+	fei.displayTime = fs.predictedDisplayTime;
+	fei.environmentBlendMode = XR_ENVIRONMENT_BLEND_MODE_OPAQUE;
+	fei.layerCount = layerCount;
+	fei.layers = layers;
+
+	timeMark = OGGetAbsoluteTime();
+	result = xrEndFrame(tsoSession, &fei);
+	if (tsoCheck(ctx, result, "xrEndFrame"))
 	{
 		return result;
 	}
 
+	stats->cpuEndFrame = OGGetAbsoluteTime() - timeMark;
+	stats->cpuTotal = OGGetAbsoluteTime() - timeStart;
+
 	return 0;
 }
 
+void tsoGPUTimerBegin( tsoContext * ctx )
+{
+	tsoGPUTimer * t = &ctx->tsoGPUTiming;
+	if( !( ctx->flags & TSO_GPU_TIMING ) ) return;
+
+	tsoGPUTimerCollect( ctx );
+
+	int slot = ctx->tsoFrameNumber % TSO_GPU_TIMER_FRAMES;
+
+	// If this slot's results still aren't back the GPU is more than TSO_GPU_TIMER_FRAMES
+	// behind.  Drop them instead of waiting.
+	t->pending[slot] = 0;
+	t->markView[slot][0] = -1;
+	tsoglQueryCounter( t->queries[slot][0], GL_TIMESTAMP );
+	t->numMarks[slot] = 1;
+	t->active = slot + 1;
+}
+
+void tsoGPUTimerView( tsoContext * ctx, int view )
+{
+	tsoGPUTimer * t = &ctx->tsoGPUTiming;
+	if( !t->active || view < 0 || view >= TSO_MAX_VIEWS ) return;
+
+	int slot = t->active - 1;
+	int mark = t->numMarks[slot];
+	if( mark >= TSO_MAX_VIEWS + 1 ) return; // Leave room for the end mark.
+
+	t->markView[slot][mark] = view;
+	tsoglQueryCounter( t->queries[slot][mark], GL_TIMESTAMP );
+	t->numMarks[slot] = mark + 1;
+}
+
+void tsoGPUTimerEnd( tsoContext * ctx )
+{
+	tsoGPUTimer * t = &ctx->tsoGPUTiming;
+	if( !t->active ) return;
+
+	int slot = t->active - 1;
+	int mark = t->numMarks[slot];
+	t->markView[slot][mark] = -1;
+	tsoglQueryCounter( t->queries[slot][mark], GL_TIMESTAMP );
+	t->numMarks[slot] = mark + 1;
+	t->frameNumber[slot] = ctx->tsoFrameNumber;
+	t->pending[slot] = 1;
+	t->active = 0;
+}
+
+void tsoGPUTimerCollect( tsoContext * ctx )
+{
+	tsoGPUTimer * t = &ctx->tsoGPUTiming;
+	tsoFrameStats * stats = &ctx->tsoStats;
+	int slot;
+
+	for( slot = 0; slot < TSO_GPU_TIMER_FRAMES; slot++ )
+	{
+		if( !t->pending[slot] ) continue;
+
+		// Timestamps land in order, so once the last one is available they all are.
+		int numMarks = t->numMarks[slot];
+		GLuint available = 0;
+		tsoglGetQueryObjectuiv( t->queries[slot][numMarks-1], GL_QUERY_RESULT_AVAILABLE, &available );
+		if( !available ) continue;
+		t->pending[slot] = 0;
+
+		// Only ever move forward; an older slot can finish after a newer one was read.
+		if( t->frameNumber[slot] <= stats->gpuFrameNumber ) continue;
+
+		uint64_t stamps[TSO_MAX_VIEWS+2];
+		int m;
+		for( m = 0; m < numMarks; m++ )
+			tsoglGetQueryObjectui64v( t->queries[slot][m], GL_QUERY_RESULT, &stamps[m] );
+
+		stats->gpuRender = ( stamps[numMarks-1] - stamps[0] ) * 0.000000001;
+		stats->gpuViewCount = 0;
+		for( m = 1; m < numMarks - 1; m++ )
+		{
+			int view = t->markView[slot][m];
+			stats->gpuView[view] = ( stamps[m+1] - stamps[m] ) * 0.000000001;
+			if( view >= stats->gpuViewCount ) stats->gpuViewCount = view + 1;
+		}
+		stats->gpuFrameNumber = t->frameNumber[slot];
+	}
+}
+
 
 
 int tsoHandleLoop( tsoContext * ctx )
@@ -1231,6 +2887,59 @@ int tsoHandleLoop( tsoContext * ctx )
 	return 0;
 }
 
+static int tsoMirrorSwapchain( tsoContext * ctx )
+{
+	return tsoSwapchainForView( ctx, ctx->tsoMirrorView );
+}
+
+static void tsoMirrorCapture( tsoContext * ctx, const tsoSwapchainInfo * viewSwapchain )
+{
+	double now = OGGetAbsoluteTime();
+	if( ctx->tsoMirrorRate > 0 && now - ctx->tsoMirrorLastTime < 1.0 / ctx->tsoMirrorRate ) return;
+
+	int x = 0;
+	int w = viewSwapchain->width;
+	int h = viewSwapchain->height;
+	if( ctx->flags & TSO_DOUBLEWIDE )
+	{
+		int perSwapchain = tsoViewsPerSwapchain( ctx );
+		w /= perSwapchain;
+		x = w * ( ctx->tsoMirrorView % perSwapchain );
+	}
+
+	int mw = ctx->tsoMirrorWidth ? ctx->tsoMirrorWidth : w;
+	int mh = ctx->tsoMirrorHeight ? ctx->tsoMirrorHeight : h;
+	tsoRenderTarget * rt = &ctx->tsoMirrorTarget;
+
+	// This runs inside tsoReleaseSwapchain, so leave the caller's framebuffers alone.
+	GLint drawFBO = 0, readFBO = 0;
+	glGetIntegerv( GL_DRAW_FRAMEBUFFER_BINDING, &drawFBO );
+	glGetIntegerv( GL_READ_FRAMEBUFFER_BINDING, &readFBO );
+
+	if( rt->width != mw || rt->height != mh )
+	{
+		tsoRenderTargetDestroy( rt );
+		if( tsoRenderTargetCreate( rt, mw, mh, 0 ) )
+		{
+			tsoglBindFramebuffer( GL_DRAW_FRAMEBUFFER, drawFBO );
+			tsoglBindFramebuffer( GL_READ_FRAMEBUFFER, readFBO );
+			return;
+		}
+	}
+
+	// GPU to GPU; the driver queues this behind the eye's rendering without a sync.
+	tsoglBindFramebuffer( GL_READ_FRAMEBUFFER, ctx->tsoMirrorReadFBO );
+	tsoglFramebufferTexture2D( GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, ctx->tsoMirrorImage, 0 );
+	tsoglBindFramebuffer( GL_DRAW_FRAMEBUFFER, rt->fbo );
+	tsoglBlitFramebuffer( x, 0, x + w, h, 0, 0, mw, mh, GL_COLOR_BUFFER_BIT, GL_LINEAR );
+	tsoglFramebufferTexture2D( GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0 );
+	tsoglBindFramebuffer( GL_DRAW_FRAMEBUFFER, drawFBO );
+	tsoglBindFramebuffer( GL_READ_FRAMEBUFFER, readFBO );
+
+	ctx->tsoMirrorLastTime = now;
+	ctx->tsoMirrorPending = 1;
+}
+
 int tsoAcquireSwapchain( tsoContext * ctx, int swapchainNumber, uint32_t * swapchainImageIndex )
 {
 	const tsoSwapchainInfo * viewSwapchain = ctx->tsoSwapchains + swapchainNumber;
@@ -1249,6 +2958,11 @@ int tsoAcquireSwapchain( tsoContext * ctx, int swapchainNumber, uint32_t * swapc
 	{
 		return result;
 	}
+
+	if( ctx->tsoMirrorReadFBO && swapchainNumber == tsoMirrorSwapchain( ctx ) )
+	{
+		ctx->tsoMirrorImage = ctx->tsoSwapchainImages[swapchainNumber][*swapchainImageIndex].image;
+	}
 	
 	return 0;
 }
@@ -1257,6 +2971,19 @@ int tsoReleaseSwapchain( tsoContext * ctx, int swapchainNumber )
 {
 	const tsoSwapchainInfo * viewSwapchain = ctx->tsoSwapchains + swapchainNumber;
 
+	// Inside tsoRenderLayer with a latched frame: tsoLateLatchEnd releases it once the slot is final.
+	if( ctx->tsoLateLatch && ctx->tsoLateLatchSlot >= 0 && swapchainNumber < 32 )
+	{
+		ctx->tsoLateLatchReleases |= 1u << swapchainNumber;
+		return 0;
+	}
+
+	if( ctx->tsoMirrorImage && swapchainNumber == tsoMirrorSwapchain( ctx ) )
+	{
+		tsoMirrorCapture( ctx, viewSwapchain );
+		ctx->tsoMirrorImage = 0;
+	}
+
 	XrResult result;
 	XrSwapchainImageReleaseInfo ri = { XR_TYPE_SWAPCHAIN_IMAGE_RELEASE_INFO };
 	result = xrReleaseSwapchainImage( viewSwapchain->handle, &ri );
@@ -1267,18 +2994,436 @@ int tsoReleaseSwapchain( tsoContext * ctx, int swapchainNumber )
 	return 0;
 }
 
-int tsoDestroySwapchains( tsoContext * ctx )
+int tsoEnableReverseZ( tsoContext * ctx, int enable )
+{
+	tsoLoadGL( ctx );
+	if( !tsoglClipControl )
+	{
+		if( enable ) TSOPENXR_ERROR( "Reverse-Z requested, but glClipControl is not available.\n" );
+		return -1;
+	}
+	ctx->tsoReverseZ = !!enable;
+	return 0;
+}
+
+int tsoRenderTargetCreate( tsoRenderTarget * rt, int width, int height, int withDepth )
+{
+	tsoLoadGL( 0 );
+	memset( rt, 0, sizeof( *rt ) );
+	if( !tsoglGenFramebuffers || !tsoglFramebufferTexture2D ) return -1;
+
+	rt->width = width;
+	rt->height = height;
+
+	glGenTextures( 1, &rt->color );
+	glBindTexture( GL_TEXTURE_2D, rt->color );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+	glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0 );
+
+	if( withDepth )
+	{
+		glGenTextures( 1, &rt->depth );
+		glBindTexture( GL_TEXTURE_2D, rt->depth );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+		glTexImage2D( GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, 0 );
+	}
+	glBindTexture( GL_TEXTURE_2D, 0 );
+
+	tsoglGenFramebuffers( 1, &rt->fbo );
+	tsoglBindFramebuffer( GL_FRAMEBUFFER, rt->fbo );
+	tsoglFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, rt->color, 0 );
+	if( rt->depth )
+		tsoglFramebufferTexture2D( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, rt->depth, 0 );
+	tsoglBindFramebuffer( GL_FRAMEBUFFER, 0 );
+	return 0;
+}
+
+void tsoRenderTargetBind( tsoRenderTarget * rt )
+{
+	tsoglBindFramebuffer( GL_FRAMEBUFFER, rt ? rt->fbo : 0 );
+	if( rt ) glViewport( 0, 0, rt->width, rt->height );
+}
+
+void tsoRenderTargetDestroy( tsoRenderTarget * rt )
+{
+	if( rt->fbo ) tsoglDeleteFramebuffers( 1, &rt->fbo );
+	if( rt->color ) glDeleteTextures( 1, &rt->color );
+	if( rt->depth ) glDeleteTextures( 1, &rt->depth );
+	memset( rt, 0, sizeof( *rt ) );
+}
+
+// Works on both core (glGetStringi) and compatibility (one big string) contexts.
+static int tsoGLExtensionSupported( const char * name )
+{
+	if( tsoglGetStringi )
+	{
+		GLint num = 0;
+		int i;
+		glGetIntegerv( GL_NUM_EXTENSIONS, &num );
+		for( i = 0; i < num; i++ )
+		{
+			const char * ext = (const char *)tsoglGetStringi( GL_EXTENSIONS, i );
+			if( ext && strcmp( ext, name ) == 0 ) return 1;
+		}
+		if( num ) return 0;
+	}
+	const char * all = (const char *)glGetString( GL_EXTENSIONS );
+	size_t len = strlen( name );
+	while( all && ( all = strstr( all, name ) ) )
+	{
+		if( all[len] == ' ' || all[len] == 0 ) return 1;
+		all += len;
+	}
+	return 0;
+}
+
+int tsoStereoInit( tsoStereo * st )
+{
+	memset( st, 0, sizeof( *st ) );
+	tsoLoadGL( 0 );
+	if( !tsoglGenBuffers || !tsoglBufferData || !tsoglBindBufferBase || !tsoglGetUniformBlockIndex ||
+		!tsoglUniformBlockBinding || !tsoglDrawArraysInstanced || !tsoglDrawElementsInstanced )
+	{
+		return -1;
+	}
+
+	st->mode = TSO_STEREO_CLIP_DISTANCE;
+	st->shaderHeader = "";
+	if( tsoglViewportArrayv )
+	{
+		if( tsoGLExtensionSupported( "GL_ARB_shader_viewport_layer_array" ) )
+		{
+			st->mode = TSO_STEREO_VIEWPORT_INDEX;
+			st->shaderHeader = "#extension GL_ARB_shader_viewport_layer_array : require\n#define TSO_STEREO_VIEWPORT_INDEX\n";
+		}
+		else if( tsoGLExtensionSupported( "GL_AMD_vertex_shader_viewport_index" ) )
+		{
+			st->mode = TSO_STEREO_VIEWPORT_INDEX;
+			st->shaderHeader = "#extension GL_AMD_vertex_shader_viewport_index : require\n#define TSO_STEREO_VIEWPORT_INDEX\n";
+		}
+	}
+
+	tsoglGenBuffers( 1, &st->ubo );
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, st->ubo );
+	tsoglBufferData( GL_UNIFORM_BUFFER, 4 * 16 * sizeof( float ), 0, GL_STREAM_DRAW );
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, 0 );
+	return 0;
+}
+
+void tsoStereoDestroy( tsoStereo * st )
+{
+	if( st->ubo ) tsoglDeleteBuffers( 1, &st->ubo );
+	memset( st, 0, sizeof( *st ) );
+}
+
+void tsoStereoBindProgram( tsoStereo * st, uint32_t program )
+{
+	GLuint block = tsoglGetUniformBlockIndex( program, "tsoStereoBlock" );
+	if( block != 0xffffffff )
+		tsoglUniformBlockBinding( program, block, 0 );
+}
+
+int tsoStereoBegin( tsoStereo * st, const XrCompositionLayerProjectionView * views, const tsoViewMatrices * matrices, int viewCount )
+{
+	float block[4][16];
+	if( !st->ubo || viewCount != 2 || views[0].subImage.swapchain != views[1].subImage.swapchain ) return -1;
+
+	memcpy( block[0], matrices[0].viewProj, sizeof( block[0] ) );
+	memcpy( block[1], matrices[1].viewProj, sizeof( block[1] ) );
+	memcpy( block[2], matrices[0].view, sizeof( block[2] ) );
+	memcpy( block[3], matrices[1].view, sizeof( block[3] ) );
+
+	// Orphan rather than update in place so we never wait on last frame's draws.
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, st->ubo );
+	tsoglBufferData( GL_UNIFORM_BUFFER, sizeof( block ), block, GL_STREAM_DRAW );
+	tsoglBindBuffer( GL_UNIFORM_BUFFER, 0 );
+	tsoglBindBufferBase( GL_UNIFORM_BUFFER, 0, st->ubo );
+
+	const XrRect2Di * l = &views[0].subImage.imageRect;
+	const XrRect2Di * r = &views[1].subImage.imageRect;
+	if( st->mode == TSO_STEREO_VIEWPORT_INDEX )
+	{
+		const float vp[8] = {
+			l->offset.x, l->offset.y, l->extent.width, l->extent.height,
+			r->offset.x, r->offset.y, r->extent.width, r->extent.height };
+		tsoglViewportArrayv( 0, 2, vp );
+	}
+	else
+	{
+		glViewport( l->offset.x, l->offset.y, r->offset.x + r->extent.width - l->offset.x, l->extent.height );
+		glEnable( GL_CLIP_DISTANCE0 );
+	}
+	st->instances = viewCount;
+	return 0;
+}
+
+void tsoStereoEnd( tsoStereo * st )
+{
+	if( st->instances && st->mode == TSO_STEREO_CLIP_DISTANCE )
+		glDisable( GL_CLIP_DISTANCE0 );
+	st->instances = 0;
+}
+
+void tsoStereoDrawArrays( tsoStereo * st, uint32_t mode, int first, int count )
+{
+	if( st->instances )
+		tsoglDrawArraysInstanced( mode, first, count, st->instances );
+}
+
+void tsoStereoDrawElements( tsoStereo * st, uint32_t mode, int count, uint32_t type, const void * indices )
+{
+	if( st->instances )
+		tsoglDrawElementsInstanced( mode, count, type, indices, st->instances );
+}
+
+int tsoDebugDrawInit( tsoDebugDraw * dd )
+{
+	memset( dd, 0, sizeof( *dd ) );
+	tsoLoadGL( 0 );
+	if( !tsoglGenBuffers || !tsoglBindBuffer || !tsoglBufferData || !tsoglVertexAttribPointer ||
+		!tsoglEnableVertexAttribArray || !tsoglUniformMatrix4fv )
+	{
+		return -1;
+	}
+	tsoglGenBuffers( 1, &dd->vbo );
+	return 0;
+}
+
+void tsoDebugDrawDestroy( tsoDebugDraw * dd )
+{
+	if( dd->vbo ) tsoglDeleteBuffers( 1, &dd->vbo );
+	free( dd->verts );
+	memset( dd, 0, sizeof( *dd ) );
+}
+
+void tsoDebugDrawReset( tsoDebugDraw * dd )
+{
+	dd->count = 0;
+	dd->dirty = 1;
+}
+
+static tsoDebugVertex * tsoDebugAlloc( tsoDebugDraw * dd, int n )
+{
+	if( dd->count + n > dd->capacity )
+	{
+		int cap = dd->capacity ? dd->capacity : 1024;
+		while( cap < dd->count + n ) cap *= 2;
+		tsoDebugVertex * v = realloc( dd->verts, cap * sizeof( tsoDebugVertex ) );
+		if( !v ) return 0;
+		dd->verts = v;
+		dd->capacity = cap;
+	}
+	tsoDebugVertex * ret = dd->verts + dd->count;
+	dd->count += n;
+	dd->dirty = 1;
+	return ret;
+}
+
+void tsoDebugLine( tsoDebugDraw * dd, const float * a, const float * b, uint32_t color )
+{
+	tsoDebugVertex * v = tsoDebugAlloc( dd, 2 );
+	if( !v ) return;
+	memcpy( v[0].pos, a, sizeof( v[0].pos ) );
+	memcpy( v[1].pos, b, sizeof( v[1].pos ) );
+	v[0].color = v[1].color = color;
+}
+
+void tsoDebugBox( tsoDebugDraw * dd, const float * mins, const float * maxs, uint32_t color )
 {
+	// Corner i takes x from bit 0, y from bit 1 and z from bit 2.  Each edge flips one bit.
+	static const uint8_t edges[24] = { 0,1, 2,3, 4,5, 6,7, 0,2, 1,3, 4,6, 5,7, 0,4, 1,5, 2,6, 3,7 };
+	tsoDebugVertex * v = tsoDebugAlloc( dd, 24 );
 	int i;
-	XrResult result;
-	for( i = 0; i < ctx->tsoNumViewConfigs; i++ )
+	if( !v ) return;
+	for( i = 0; i < 24; i++ )
+	{
+		int c = edges[i];
+		v[i].pos[0] = ( c & 1 ) ? maxs[0] : mins[0];
+		v[i].pos[1] = ( c & 2 ) ? maxs[1] : mins[1];
+		v[i].pos[2] = ( c & 4 ) ? maxs[2] : mins[2];
+		v[i].color = color;
+	}
+}
+
+void tsoDebugAxes( tsoDebugDraw * dd, const XrPosef * pose, float size )
+{
+	static const uint32_t colors[3] = { 0xff0000ff, 0xff00ff00, 0xffff0000 };
+	float m[16];
+	int i;
+	tsoDebugVertex * v = tsoDebugAlloc( dd, 6 );
+	if( !v ) return;
+	tsoUtilInitPoseMat( m, pose );
+	for( i = 0; i < 3; i++ )
+	{
+		memcpy( v[i*2+0].pos, m + 12, sizeof( v[0].pos ) );
+		v[i*2+1].pos[0] = m[12] + m[i*4+0] * size;
+		v[i*2+1].pos[1] = m[13] + m[i*4+1] * size;
+		v[i*2+1].pos[2] = m[14] + m[i*4+2] * size;
+		v[i*2+0].color = v[i*2+1].color = colors[i];
+	}
+}
+
+#ifdef _CNFG_H
+void tsoDebugText( tsoDebugDraw * dd, const tsoViewMatrices * facing, const float * pos, float height, uint32_t color, const char * text )
+{
+	static const float defaultRight[3] = { 1, 0, 0 };
+	static const float defaultUp[3] = { 0, 1, 0 };
+	const float * right = facing ? facing->invView + 0 : defaultRight;
+	const float * up = facing ? facing->invView + 4 : defaultUp;
+	// The font is laid out on a grid where a line is 6 units tall and a character 3 wide.
+	float unit = height / 6.0f;
+	float ox = 0, oy = 0;
+	float a[3], b[3];
+
+	for( ; *text; text++ )
+	{
+		unsigned char c = *text;
+		if( c == 9 ) { ox += 12; continue; }
+		if( c == 10 ) { ox = 0; oy += 6; continue; }
+		unsigned short index = RawdrawFontCharMap[c];
+		if( index != 65535 )
+		{
+			const unsigned char * lmap = &RawdrawFontCharData[index];
+			int start = 1;
+			unsigned char data;
+			do
+			{
+				data = *(lmap++);
+				float gx = ( ox + ( ( data >> 4 ) & 0x07 ) ) * unit;
+				float gy = ( oy + ( data & 0x07 ) ) * unit;
+				b[0] = pos[0] + right[0] * gx - up[0] * gy;
+				b[1] = pos[1] + right[1] * gx - up[1] * gy;
+				b[2] = pos[2] + right[2] * gx - up[2] * gy;
+				if( start )
+				{
+					// A lone point; give it a little length so it shows up.
+					if( data & 0x08 )
+					{
+						float p[3] = { b[0] + right[0] * unit * 0.5f, b[1] + right[1] * unit * 0.5f, b[2] + right[2] * unit * 0.5f };
+						tsoDebugLine( dd, b, p, color );
+					}
+					start = 0;
+				}
+				else
+				{
+					tsoDebugLine( dd, a, b, color );
+				}
+				memcpy( a, b, sizeof( a ) );
+				if( data & 0x08 ) start = 1;
+			} while( !( data & 0x80 ) );
+		}
+		ox += 3;
+	}
+}
+#endif
+
+static int tsoDebugDrawBind( tsoDebugDraw * dd )
+{
+	if( !dd->count || !dd->vbo ) return 0;
+	tsoglBindBuffer( GL_ARRAY_BUFFER, dd->vbo );
+	if( dd->dirty )
+	{
+		tsoglBufferData( GL_ARRAY_BUFFER, dd->count * sizeof( tsoDebugVertex ), dd->verts, GL_STREAM_DRAW );
+		dd->dirty = 0;
+	}
+	tsoglEnableVertexAttribArray( 0 );
+	tsoglEnableVertexAttribArray( 1 );
+	tsoglVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, sizeof( tsoDebugVertex ), (const void *)0 );
+	tsoglVertexAttribPointer( 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( tsoDebugVertex ), (const void *)offsetof( tsoDebugVertex, color ) );
+	return dd->count;
+}
+
+void tsoDebugDrawView( tsoDebugDraw * dd, int viewProjUniform, const float * viewProj )
+{
+	int count = tsoDebugDrawBind( dd );
+	if( !count ) return;
+	if( viewProjUniform >= 0 )
+		tsoglUniformMatrix4fv( viewProjUniform, 1, GL_FALSE, viewProj );
+	glDrawArrays( GL_LINES, 0, count );
+	tsoglBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+void tsoDebugDrawStereo( tsoDebugDraw * dd, tsoStereo * st )
+{
+	int count = tsoDebugDrawBind( dd );
+	if( !count ) return;
+	tsoStereoDrawArrays( st, GL_LINES, 0, count );
+	tsoglBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+int tsoSetMirror( tsoContext * ctx, int view, float rateHz, int width, int height )
+{
+	ctx->tsoMirrorView = view;
+	ctx->tsoMirrorRate = rateHz;
+	ctx->tsoMirrorWidth = width;
+	ctx->tsoMirrorHeight = height;
+	ctx->tsoMirrorPending = 0;
+
+	if( view < 0 )
+	{
+		if( ctx->tsoMirrorReadFBO ) tsoglDeleteFramebuffers( 1, &ctx->tsoMirrorReadFBO );
+		ctx->tsoMirrorReadFBO = 0;
+		tsoRenderTargetDestroy( &ctx->tsoMirrorTarget );
+		return 0;
+	}
+
+	tsoLoadGL( ctx );
+	if( !tsoglBlitFramebuffer || !tsoglGenFramebuffers )
+	{
+		TSOPENXR_ERROR( "Mirror requested, but glBlitFramebuffer is not available.\n" );
+		return -1;
+	}
+	if( !ctx->tsoMirrorReadFBO ) tsoglGenFramebuffers( 1, &ctx->tsoMirrorReadFBO );
+	return 0;
+}
+
+int tsoMirrorToWindow( tsoContext * ctx, int windowWidth, int windowHeight )
+{
+	tsoRenderTarget * rt = &ctx->tsoMirrorTarget;
+	if( !ctx->tsoMirrorPending || !rt->fbo || windowWidth <= 0 || windowHeight <= 0 ) return 0;
+
+	// Crop the mirror to the window's aspect ratio, keeping the middle.
+	int sw = rt->width;
+	int sh = rt->width * windowHeight / windowWidth;
+	if( sh > rt->height )
 	{
-		result = xrDestroySwapchain( ctx->tsoSwapchains[i].handle);
-		if( tsoCheck(ctx, result, "xrDestroySwapchain") ) return result;
+		sh = rt->height;
+		sw = rt->height * windowWidth / windowHeight;
 	}
+	int sx = ( rt->width - sw ) / 2;
+	int sy = ( rt->height - sh ) / 2;
+
+	tsoglBindFramebuffer( GL_READ_FRAMEBUFFER, rt->fbo );
+	tsoglBindFramebuffer( GL_DRAW_FRAMEBUFFER, 0 );
+	tsoglBlitFramebuffer( sx, sy, sx + sw, sy + sh, 0, 0, windowWidth, windowHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR );
+	tsoglBindFramebuffer( GL_FRAMEBUFFER, 0 );
+
+	ctx->tsoMirrorPending = 0;
+	return 1;
+}
+
+int tsoDestroySwapchains( tsoContext * ctx )
+{
+	int i;
+	for( i = 0; i < ctx->tsoSwapchainPoolSize; i++ )
+		ctx->tsoSwapchainPool[i].inUse = 0;
+	int ret = tsoTrimSwapchainPool( ctx, 0 );
+
+	free( ctx->tsoSwapchainPool );
 	free( ctx->tsoSwapchains );
+	free( ctx->tsoSwapchainLengths );
+	free( ctx->tsoSwapchainImages );
+	ctx->tsoSwapchainPool = 0;
+	ctx->tsoSwapchainPoolSize = 0;
 	ctx->tsoSwapchains = 0;
-	return 0;
+	ctx->tsoSwapchainLengths = 0;
+	ctx->tsoSwapchainImages = 0;
+	ctx->numSwapchainsPerFrame = 0;
+	return ret;
 }
 
 int tsoTeardown( tsoContext * ctx )
@@ -1287,6 +3432,29 @@ int tsoTeardown( tsoContext * ctx )
 	int ret = 0;
 	tsoDestroySwapchains( ctx );
 
+	tsoSetMirror( ctx, -1, 0, 0, 0 );
+	tsoEnableLateLatch( ctx, 0 );
+
+	while( ctx->tsoNumQuadLayers )
+		tsoQuadLayerDestroy( ctx, ctx->tsoQuadLayers[0] );
+	if( ctx->tsoQuadLayerFBO ) tsoglDeleteFramebuffers( 1, &ctx->tsoQuadLayerFBO );
+	ctx->tsoQuadLayerFBO = 0;
+
+	int i;
+	for( i = 0; i < TSO_FRAME_FENCES; i++ )
+	{
+		tsoFrameFence * f = &ctx->tsoFrameFences[i];
+		if( f->sync ) tsoglDeleteSync( f->sync );
+		if( f->query ) tsoglDeleteQueries( 1, &f->query );
+		f->sync = 0;
+		f->query = 0;
+	}
+
+	if( ctx->flags & TSO_GPU_TIMING )
+	{
+		tsoglDeleteQueries( TSO_GPU_TIMER_FRAMES * (TSO_MAX_VIEWS+2), &ctx->tsoGPUTiming.queries[0][0] );
+	}
+
 	result = xrDestroySpace(ctx->tsoStageSpace);
 	tsoCheck(ctx, result, "xrDestroySpace");
 	ret |= result;
@@ -1303,6 +3471,9 @@ int tsoTeardown( tsoContext * ctx )
 	ctx->tsoInstance = 0;
 	tsoCheck(ctx, result, "xrDestroyInstance");
 	ret |= result;
+
+	free( ctx->tsoSwapchainFormats );
+	free( ctx->tsoLastProjectionViews );
 	
 	memset( ctx, 0, sizeof( *ctx ) );
 	return ret;
@@ -1310,8 +3481,9 @@ int tsoTeardown( tsoContext * ctx )
 
 
 // Utility functions from copied from https://github.com/hyperlogic/openxrstub/blob/main/src/main.cpp
+// These are the reference versions, the SIMD versions below do the same operations in the same order.
 
-void tsoUtilInitPoseMat(float* result, const XrPosef * pose)
+void tsoUtilInitPoseMatScalar(float* result, const XrPosef * pose)
 {
 	const float x2  = pose->orientation.x + pose->orientation.x;
 	const float y2  = pose->orientation.y + pose->orientation.y;
@@ -1349,7 +3521,7 @@ void tsoUtilInitPoseMat(float* result, const XrPosef * pose)
 	result[15] = 1.0;
 }
 
-void tsoMultiplyMat(float* result, const float* a, const float* b)
+void tsoMultiplyMatScalar(float* result, const float* a, const float* b)
 {
 	result[0] = a[0] * b[0] + a[4] * b[1] + a[8] * b[2] + a[12] * b[3];
 	result[1] = a[1] * b[0] + a[5] * b[1] + a[9] * b[2] + a[13] * b[3];
@@ -1372,7 +3544,7 @@ void tsoMultiplyMat(float* result, const float* a, const float* b)
 	result[15] = a[3] * b[12] + a[7] * b[13] + a[11] * b[14] + a[15] * b[15];
 }
 
-void tsoInvertOrthogonalMat(float* result, float* src)
+void tsoInvertOrthogonalMatScalar(float* result, const float* src)
 {
 	result[0] = src[0];
 	result[1] = src[4];
@@ -1392,21 +3564,178 @@ void tsoInvertOrthogonalMat(float* result, float* src)
 	result[15] = 1.0f;
 }
 
-void tsoUtilInitProjectionMat(XrCompositionLayerProjectionView * layerView, float* projMat, float * invViewMat, float * viewMat, float * modelViewProjMat,
-								enum GraphicsAPI graphicsApi, 
-								const float nearZ, const float farZ)
+#if TSO_SIMD_SSE2
+
+void tsoUtilInitPoseMat(float* result, const XrPosef * pose)
 {
-	// convert XrFovf into an OpenGL projection matrix.
-	const float tanAngleLeft = tan(layerView->fov.angleLeft);
-	const float tanAngleRight = tan(layerView->fov.angleRight);
-	const float tanAngleDown = tan(layerView->fov.angleDown);
-	const float tanAngleUp = tan(layerView->fov.angleUp);
-	
-	const float tanAngleWidth = tanAngleRight - tanAngleLeft;
+	// Lane 3 of every sign vector is 0 to clear out the w row.
+	__m128 q = _mm_loadu_ps( &pose->orientation.x ); // x y z w
+	__m128 q2 = _mm_add_ps( q, q );
+
+	__m128 u0 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 0, 0, 1 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 2, 1, 1 ) ) ); // yy2 xy2 xz2
+	__m128 v0 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 3, 3, 2 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 1, 2, 2 ) ) ); // zz2 wz2 wy2
+	__m128 u1 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 1, 0, 0 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 2, 0, 1 ) ) ); // xy2 xx2 yz2
+	__m128 v1 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 3, 2, 3 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 0, 2, 2 ) ) ); // wz2 zz2 wx2
+	__m128 u2 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 0, 1, 0 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 0, 2, 2 ) ) ); // xz2 yz2 xx2
+	__m128 v2 = _mm_mul_ps( _mm_shuffle_ps( q, q, _MM_SHUFFLE( 3, 1, 3, 3 ) ), _mm_shuffle_ps( q2, q2, _MM_SHUFFLE( 3, 1, 0, 1 ) ) ); // wy2 wx2 yy2
+
+	__m128 c0 = _mm_add_ps( _mm_add_ps( _mm_setr_ps( 1, 0, 0, 0 ), _mm_mul_ps( u0, _mm_setr_ps( -1, 1, 1, 0 ) ) ), _mm_mul_ps( v0, _mm_setr_ps( -1, 1, -1, 0 ) ) );
+	__m128 c1 = _mm_add_ps( _mm_add_ps( _mm_setr_ps( 0, 1, 0, 0 ), _mm_mul_ps( u1, _mm_setr_ps( 1, -1, 1, 0 ) ) ), _mm_mul_ps( v1, _mm_setr_ps( -1, -1, 1, 0 ) ) );
+	__m128 c2 = _mm_add_ps( _mm_add_ps( _mm_setr_ps( 0, 0, 1, 0 ), _mm_mul_ps( u2, _mm_setr_ps( 1, 1, -1, 0 ) ) ), _mm_mul_ps( v2, _mm_setr_ps( 1, -1, -1, 0 ) ) );
+
+	_mm_storeu_ps( result + 0, c0 );
+	_mm_storeu_ps( result + 4, c1 );
+	_mm_storeu_ps( result + 8, c2 );
+	result[12] = pose->position.x;
+	result[13] = pose->position.y;
+	result[14] = pose->position.z;
+	result[15] = 1.0;
+}
 
-	// Set to tanAngleDown - tanAngleUp for a clip space with positive Y down (Vulkan).
-	// Set to tanAngleUp - tanAngleDown for a clip space with positive Y up (OpenGL / D3D / Metal).
-	const float tanAngleHeight = graphicsApi == GRAPHICS_VULKAN ? (tanAngleDown - tanAngleUp) : (tanAngleUp - tanAngleDown);
+void tsoMultiplyMat(float* result, const float* a, const float* b)
+{
+	__m128 a0 = _mm_loadu_ps( a + 0 );
+	__m128 a1 = _mm_loadu_ps( a + 4 );
+	__m128 a2 = _mm_loadu_ps( a + 8 );
+	__m128 a3 = _mm_loadu_ps( a + 12 );
+	__m128 r[4];
+	int i;
+
+	// Load all of b first so result may alias either input.
+	for( i = 0; i < 4; i++ )
+	{
+		__m128 c = _mm_mul_ps( a0, _mm_set1_ps( b[i*4+0] ) );
+		c = _mm_add_ps( c, _mm_mul_ps( a1, _mm_set1_ps( b[i*4+1] ) ) );
+		c = _mm_add_ps( c, _mm_mul_ps( a2, _mm_set1_ps( b[i*4+2] ) ) );
+		r[i] = _mm_add_ps( c, _mm_mul_ps( a3, _mm_set1_ps( b[i*4+3] ) ) );
+	}
+	for( i = 0; i < 4; i++ )
+		_mm_storeu_ps( result + i*4, r[i] );
+}
+
+void tsoInvertOrthogonalMat(float* result, const float* src)
+{
+	__m128 r0 = _mm_loadu_ps( src + 0 );
+	__m128 r1 = _mm_loadu_ps( src + 4 );
+	__m128 r2 = _mm_loadu_ps( src + 8 );
+	__m128 r3 = _mm_setzero_ps();
+	__m128 tx = _mm_set1_ps( src[12] );
+	__m128 ty = _mm_set1_ps( src[13] );
+	__m128 tz = _mm_set1_ps( src[14] );
+	_MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+	__m128 t = _mm_add_ps( _mm_add_ps( _mm_mul_ps( r0, tx ), _mm_mul_ps( r1, ty ) ), _mm_mul_ps( r2, tz ) );
+	t = _mm_sub_ps( _mm_setr_ps( 0, 0, 0, 1 ), t );
+
+	_mm_storeu_ps( result + 0, r0 );
+	_mm_storeu_ps( result + 4, r1 );
+	_mm_storeu_ps( result + 8, r2 );
+	_mm_storeu_ps( result + 12, t );
+}
+
+#elif TSO_SIMD_NEON
+
+void tsoUtilInitPoseMat(float* result, const XrPosef * pose)
+{
+	const float x = pose->orientation.x, y = pose->orientation.y, z = pose->orientation.z, w = pose->orientation.w;
+	const float x2 = x + x, y2 = y + y, z2 = z + z;
+	const float lu0[4] = { y, x, x, 0 }, ru0[4] = { y2, y2, z2, 0 };
+	const float lv0[4] = { z, w, w, 0 }, rv0[4] = { z2, z2, y2, 0 };
+	const float lu1[4] = { x, x, y, 0 }, ru1[4] = { y2, x2, z2, 0 };
+	const float lv1[4] = { w, z, w, 0 }, rv1[4] = { z2, z2, x2, 0 };
+	const float lu2[4] = { x, y, x, 0 }, ru2[4] = { z2, z2, x2, 0 };
+	const float lv2[4] = { w, w, y, 0 }, rv2[4] = { y2, x2, y2, 0 };
+	static const float base[3][4] = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 } };
+	static const float su[3][4] = { { -1, 1, 1, 0 }, { 1, -1, 1, 0 }, { 1, 1, -1, 0 } };
+	static const float sv[3][4] = { { -1, 1, -1, 0 }, { -1, -1, 1, 0 }, { 1, -1, -1, 0 } };
+
+	float32x4_t u0 = vmulq_f32( vld1q_f32( lu0 ), vld1q_f32( ru0 ) );
+	float32x4_t v0 = vmulq_f32( vld1q_f32( lv0 ), vld1q_f32( rv0 ) );
+	float32x4_t u1 = vmulq_f32( vld1q_f32( lu1 ), vld1q_f32( ru1 ) );
+	float32x4_t v1 = vmulq_f32( vld1q_f32( lv1 ), vld1q_f32( rv1 ) );
+	float32x4_t u2 = vmulq_f32( vld1q_f32( lu2 ), vld1q_f32( ru2 ) );
+	float32x4_t v2 = vmulq_f32( vld1q_f32( lv2 ), vld1q_f32( rv2 ) );
+
+	// vmul then vadd, never vmla/vfma, so the rounding matches the scalar version.
+	vst1q_f32( result + 0, vaddq_f32( vaddq_f32( vld1q_f32( base[0] ), vmulq_f32( u0, vld1q_f32( su[0] ) ) ), vmulq_f32( v0, vld1q_f32( sv[0] ) ) ) );
+	vst1q_f32( result + 4, vaddq_f32( vaddq_f32( vld1q_f32( base[1] ), vmulq_f32( u1, vld1q_f32( su[1] ) ) ), vmulq_f32( v1, vld1q_f32( sv[1] ) ) ) );
+	vst1q_f32( result + 8, vaddq_f32( vaddq_f32( vld1q_f32( base[2] ), vmulq_f32( u2, vld1q_f32( su[2] ) ) ), vmulq_f32( v2, vld1q_f32( sv[2] ) ) ) );
+	result[12] = pose->position.x;
+	result[13] = pose->position.y;
+	result[14] = pose->position.z;
+	result[15] = 1.0;
+}
+
+void tsoMultiplyMat(float* result, const float* a, const float* b)
+{
+	float32x4_t a0 = vld1q_f32( a + 0 );
+	float32x4_t a1 = vld1q_f32( a + 4 );
+	float32x4_t a2 = vld1q_f32( a + 8 );
+	float32x4_t a3 = vld1q_f32( a + 12 );
+	float32x4_t r[4];
+	int i;
+
+	for( i = 0; i < 4; i++ )
+	{
+		float32x4_t c = vmulq_n_f32( a0, b[i*4+0] );
+		c = vaddq_f32( c, vmulq_n_f32( a1, b[i*4+1] ) );
+		c = vaddq_f32( c, vmulq_n_f32( a2, b[i*4+2] ) );
+		r[i] = vaddq_f32( c, vmulq_n_f32( a3, b[i*4+3] ) );
+	}
+	for( i = 0; i < 4; i++ )
+		vst1q_f32( result + i*4, r[i] );
+}
+
+void tsoInvertOrthogonalMat(float* result, const float* src)
+{
+	// De-interleaving load is a transpose: val[n] = { src[n], src[n+4], src[n+8], src[n+12] }.
+	float32x4x4_t m = vld4q_f32( src );
+	float32x4_t r0 = vsetq_lane_f32( 0, m.val[0], 3 );
+	float32x4_t r1 = vsetq_lane_f32( 0, m.val[1], 3 );
+	float32x4_t r2 = vsetq_lane_f32( 0, m.val[2], 3 );
+
+	float32x4_t t = vaddq_f32( vaddq_f32( vmulq_n_f32( r0, src[12] ), vmulq_n_f32( r1, src[13] ) ), vmulq_n_f32( r2, src[14] ) );
+	static const float one[4] = { 0, 0, 0, 1 };
+	t = vsubq_f32( vld1q_f32( one ), t );
+
+	vst1q_f32( result + 0, r0 );
+	vst1q_f32( result + 4, r1 );
+	vst1q_f32( result + 8, r2 );
+	vst1q_f32( result + 12, t );
+}
+
+#else
+
+void tsoUtilInitPoseMat(float* result, const XrPosef * pose)
+{
+	tsoUtilInitPoseMatScalar( result, pose );
+}
+
+void tsoMultiplyMat(float* result, const float* a, const float* b)
+{
+	tsoMultiplyMatScalar( result, a, b );
+}
+
+void tsoInvertOrthogonalMat(float* result, const float* src)
+{
+	tsoInvertOrthogonalMatScalar( result, src );
+}
+
+#endif
+
+void tsoUtilInitFovProjectionMat(float* projMat, const XrFovf * fov, enum GraphicsAPI graphicsApi, const float nearZ, const float farZ)
+{
+	// convert XrFovf into an OpenGL projection matrix.
+	const float tanAngleLeft = tan(fov->angleLeft);
+	const float tanAngleRight = tan(fov->angleRight);
+	const float tanAngleDown = tan(fov->angleDown);
+	const float tanAngleUp = tan(fov->angleUp);
+	
+	const float tanAngleWidth = tanAngleRight - tanAngleLeft;
+
+	// Set to tanAngleDown - tanAngleUp for a clip space with positive Y down (Vulkan).
+	// Set to tanAngleUp - tanAngleDown for a clip space with positive Y up (OpenGL / D3D / Metal).
+	const float tanAngleHeight = graphicsApi == GRAPHICS_VULKAN ? (tanAngleDown - tanAngleUp) : (tanAngleUp - tanAngleDown);
 
 	// Set to nearZ for a [-1,1] Z clip space (OpenGL / OpenGL ES).
 	// Set to zero for a [0,1] Z clip space (Vulkan / D3D / Metal).
@@ -1458,14 +3787,913 @@ void tsoUtilInitProjectionMat(XrCompositionLayerProjectionView * layerView, floa
 		projMat[11] = -1;
 		projMat[15] = 0;
 	}
-	
-	
+}
+
+void tsoUtilInitReverseZProjectionMat(float* projMat, const XrFovf * fov, enum GraphicsAPI graphicsApi, const float nearZ, const float farZ)
+{
+	// Start from the [0,1] projection for x, y and w, only depth differs.
+	tsoUtilInitFovProjectionMat(projMat, fov, GRAPHICS_D3D, nearZ, farZ);
+	if (graphicsApi == GRAPHICS_VULKAN)
+	{
+		projMat[5] = -projMat[5];
+		projMat[9] = -projMat[9];
+	}
+
+	if (farZ <= nearZ)
+	{
+		// depth = near / -z, which approaches 0 at infinity.
+		projMat[10] = 0;
+		projMat[14] = nearZ;
+	}
+	else
+	{
+		projMat[10] = nearZ / (farZ - nearZ);
+		projMat[14] = (farZ * nearZ) / (farZ - nearZ);
+	}
+}
+
+void tsoUtilInitProjectionMat(XrCompositionLayerProjectionView * layerView, float* projMat, float * invViewMat, float * viewMat, float * modelViewProjMat,
+								enum GraphicsAPI graphicsApi, 
+								const float nearZ, const float farZ)
+{
+	tsoUtilInitFovProjectionMat(projMat, &layerView->fov, graphicsApi, nearZ, farZ);
+
 	// compute view matrix by inverting the pose
 	tsoUtilInitPoseMat(invViewMat, &layerView->pose);
 	tsoInvertOrthogonalMat(viewMat, invViewMat);
 	tsoMultiplyMat(modelViewProjMat, projMat, viewMat);
 }
 
+void tsoQuatMultiply(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b)
+{
+	XrQuaternionf r;
+	r.x = a->w * b->x + a->x * b->w + a->y * b->z - a->z * b->y;
+	r.y = a->w * b->y - a->x * b->z + a->y * b->w + a->z * b->x;
+	r.z = a->w * b->z + a->x * b->y - a->y * b->x + a->z * b->w;
+	r.w = a->w * b->w - a->x * b->x - a->y * b->y - a->z * b->z;
+	*result = r;
+}
+
+void tsoQuatRotateVector(XrVector3f * result, const XrQuaternionf * q, const XrVector3f * v)
+{
+	// v' = v + w*t + q.xyz x t, where t = 2 * ( q.xyz x v )
+	const float tx = 2.0f * ( q->y * v->z - q->z * v->y );
+	const float ty = 2.0f * ( q->z * v->x - q->x * v->z );
+	const float tz = 2.0f * ( q->x * v->y - q->y * v->x );
+	XrVector3f r;
+	r.x = v->x + q->w * tx + ( q->y * tz - q->z * ty );
+	r.y = v->y + q->w * ty + ( q->z * tx - q->x * tz );
+	r.z = v->z + q->w * tz + ( q->x * ty - q->y * tx );
+	*result = r;
+}
+
+void tsoQuatNlerp(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b, float t)
+{
+	float dot = a->x * b->x + a->y * b->y + a->z * b->z + a->w * b->w;
+	float tb = ( dot < 0 ) ? -t : t; // Take the short way around.
+	float ta = 1.0f - t;
+	XrQuaternionf r;
+	r.x = a->x * ta + b->x * tb;
+	r.y = a->y * ta + b->y * tb;
+	r.z = a->z * ta + b->z * tb;
+	r.w = a->w * ta + b->w * tb;
+	float len = sqrtf( r.x * r.x + r.y * r.y + r.z * r.z + r.w * r.w );
+	float inv = ( len > 0 ) ? 1.0f / len : 0;
+	result->x = r.x * inv;
+	result->y = r.y * inv;
+	result->z = r.z * inv;
+	result->w = r.w * inv;
+}
+
+void tsoQuatSlerp(XrQuaternionf * result, const XrQuaternionf * a, const XrQuaternionf * b, float t)
+{
+	float dot = a->x * b->x + a->y * b->y + a->z * b->z + a->w * b->w;
+	float sign = 1.0f;
+	if( dot < 0 )
+	{
+		dot = -dot;
+		sign = -1.0f;
+	}
+
+	// Nearly parallel, where slerp's divide gets unstable and nlerp is indistinguishable.
+	if( dot > 0.9995f )
+	{
+		tsoQuatNlerp( result, a, b, t );
+		return;
+	}
+
+	float theta = acosf( dot );
+	float invSin = 1.0f / sinf( theta );
+	float ta = sinf( ( 1.0f - t ) * theta ) * invSin;
+	float tb = sinf( t * theta ) * invSin * sign;
+	XrQuaternionf r;
+	r.x = a->x * ta + b->x * tb;
+	r.y = a->y * ta + b->y * tb;
+	r.z = a->z * ta + b->z * tb;
+	r.w = a->w * ta + b->w * tb;
+	*result = r;
+}
+
+void tsoPoseMultiply(XrPosef * result, const XrPosef * a, const XrPosef * b)
+{
+	XrPosef r;
+	tsoQuatRotateVector( &r.position, &a->orientation, &b->position );
+	r.position.x += a->position.x;
+	r.position.y += a->position.y;
+	r.position.z += a->position.z;
+	tsoQuatMultiply( &r.orientation, &a->orientation, &b->orientation );
+	*result = r;
+}
+
+void tsoPoseInvert(XrPosef * result, const XrPosef * pose)
+{
+	XrPosef r;
+	r.orientation.x = -pose->orientation.x;
+	r.orientation.y = -pose->orientation.y;
+	r.orientation.z = -pose->orientation.z;
+	r.orientation.w = pose->orientation.w;
+	tsoQuatRotateVector( &r.position, &r.orientation, &pose->position );
+	r.position.x = -r.position.x;
+	r.position.y = -r.position.y;
+	r.position.z = -r.position.z;
+	*result = r;
+}
+
+void tsoPoseTransformPoint(XrVector3f * result, const XrPosef * pose, const XrVector3f * point)
+{
+	XrVector3f r;
+	tsoQuatRotateVector( &r, &pose->orientation, point );
+	result->x = r.x + pose->position.x;
+	result->y = r.y + pose->position.y;
+	result->z = r.z + pose->position.z;
+}
+
+void tsoPoseTransformVector(XrVector3f * result, const XrPosef * pose, const XrVector3f * vector)
+{
+	tsoQuatRotateVector( result, &pose->orientation, vector );
+}
+
+void tsoPoseInterpolate(XrPosef * result, const XrPosef * a, const XrPosef * b, float t)
+{
+	tsoQuatSlerp( &result->orientation, &a->orientation, &b->orientation, t );
+	result->position.x = a->position.x + ( b->position.x - a->position.x ) * t;
+	result->position.y = a->position.y + ( b->position.y - a->position.y ) * t;
+	result->position.z = a->position.z + ( b->position.z - a->position.z ) * t;
+}
+
+void tsoPoseMultiplyArray(XrPosef * result, const XrPosef * parent, const XrPosef * poses, int count)
+{
+	XrPosef p = *parent; // In case result overlaps parent.
+	int i;
+	for( i = 0; i < count; i++ )
+		tsoPoseMultiply( result + i, &p, poses + i );
+}
+
+// Batched transforms work on 4 points at a time, split into x, y and z vectors.
+static void tsoPoseTransformArray(XrVector3f * result, const XrPosef * pose, const XrVector3f * in, int count, int translate)
+{
+	const float qx = pose->orientation.x, qy = pose->orientation.y, qz = pose->orientation.z, qw = pose->orientation.w;
+	const float px = translate ? pose->position.x : 0;
+	const float py = translate ? pose->position.y : 0;
+	const float pz = translate ? pose->position.z : 0;
+	int i = 0;
+
+#if TSO_SIMD_SSE2
+	const __m128 vqx = _mm_set1_ps( qx ), vqy = _mm_set1_ps( qy ), vqz = _mm_set1_ps( qz ), vqw = _mm_set1_ps( qw );
+	const __m128 vpx = _mm_set1_ps( px ), vpy = _mm_set1_ps( py ), vpz = _mm_set1_ps( pz );
+	const __m128 two = _mm_set1_ps( 2.0f );
+	for( ; i + 4 <= count; i += 4 )
+	{
+		const float * src = &in[i].x;
+		float * dst = &result[i].x;
+		__m128 a = _mm_loadu_ps( src + 0 ); // x0 y0 z0 x1
+		__m128 b = _mm_loadu_ps( src + 4 ); // y1 z1 x2 y2
+		__m128 c = _mm_loadu_ps( src + 8 ); // z2 x3 y3 z3
+		__m128 x = _mm_shuffle_ps( a, _mm_shuffle_ps( b, c, _MM_SHUFFLE( 1, 1, 2, 2 ) ), _MM_SHUFFLE( 2, 0, 3, 0 ) );
+		__m128 y = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 0, 0, 1, 1 ) ), _mm_shuffle_ps( b, c, _MM_SHUFFLE( 2, 2, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+		__m128 z = _mm_shuffle_ps( _mm_shuffle_ps( a, b, _MM_SHUFFLE( 1, 1, 2, 2 ) ), _mm_shuffle_ps( c, c, _MM_SHUFFLE( 3, 3, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) );
+
+		__m128 tx = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( vqy, z ), _mm_mul_ps( vqz, y ) ) );
+		__m128 ty = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( vqz, x ), _mm_mul_ps( vqx, z ) ) );
+		__m128 tz = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( vqx, y ), _mm_mul_ps( vqy, x ) ) );
+		x = _mm_add_ps( _mm_add_ps( _mm_add_ps( x, _mm_mul_ps( vqw, tx ) ), _mm_sub_ps( _mm_mul_ps( vqy, tz ), _mm_mul_ps( vqz, ty ) ) ), vpx );
+		y = _mm_add_ps( _mm_add_ps( _mm_add_ps( y, _mm_mul_ps( vqw, ty ) ), _mm_sub_ps( _mm_mul_ps( vqz, tx ), _mm_mul_ps( vqx, tz ) ) ), vpy );
+		z = _mm_add_ps( _mm_add_ps( _mm_add_ps( z, _mm_mul_ps( vqw, tz ) ), _mm_sub_ps( _mm_mul_ps( vqx, ty ), _mm_mul_ps( vqy, tx ) ) ), vpz );
+
+		__m128 xylo = _mm_unpacklo_ps( x, y ); // x0 y0 x1 y1
+		__m128 xyhi = _mm_unpackhi_ps( x, y ); // x2 y2 x3 y3
+		_mm_storeu_ps( dst + 0, _mm_shuffle_ps( xylo, _mm_shuffle_ps( z, x, _MM_SHUFFLE( 1, 1, 0, 0 ) ), _MM_SHUFFLE( 2, 0, 1, 0 ) ) );
+		_mm_storeu_ps( dst + 4, _mm_shuffle_ps( _mm_shuffle_ps( y, z, _MM_SHUFFLE( 1, 1, 1, 1 ) ), xyhi, _MM_SHUFFLE( 1, 0, 2, 0 ) ) );
+		_mm_storeu_ps( dst + 8, _mm_shuffle_ps( _mm_shuffle_ps( z, x, _MM_SHUFFLE( 3, 3, 2, 2 ) ), _mm_shuffle_ps( y, z, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+	}
+#elif TSO_SIMD_NEON
+	const float32x4_t vpx = vdupq_n_f32( px ), vpy = vdupq_n_f32( py ), vpz = vdupq_n_f32( pz );
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float32x4x3_t v = vld3q_f32( &in[i].x );
+		float32x4_t x = v.val[0], y = v.val[1], z = v.val[2];
+		float32x4_t tx = vmulq_n_f32( vsubq_f32( vmulq_n_f32( z, qy ), vmulq_n_f32( y, qz ) ), 2.0f );
+		float32x4_t ty = vmulq_n_f32( vsubq_f32( vmulq_n_f32( x, qz ), vmulq_n_f32( z, qx ) ), 2.0f );
+		float32x4_t tz = vmulq_n_f32( vsubq_f32( vmulq_n_f32( y, qx ), vmulq_n_f32( x, qy ) ), 2.0f );
+		v.val[0] = vaddq_f32( vaddq_f32( vaddq_f32( x, vmulq_n_f32( tx, qw ) ), vsubq_f32( vmulq_n_f32( tz, qy ), vmulq_n_f32( ty, qz ) ) ), vpx );
+		v.val[1] = vaddq_f32( vaddq_f32( vaddq_f32( y, vmulq_n_f32( ty, qw ) ), vsubq_f32( vmulq_n_f32( tx, qz ), vmulq_n_f32( tz, qx ) ) ), vpy );
+		v.val[2] = vaddq_f32( vaddq_f32( vaddq_f32( z, vmulq_n_f32( tz, qw ) ), vsubq_f32( vmulq_n_f32( ty, qx ), vmulq_n_f32( tx, qy ) ) ), vpz );
+		vst3q_f32( &result[i].x, v );
+	}
+#endif
+
+	for( ; i < count; i++ )
+	{
+		XrVector3f r;
+		tsoQuatRotateVector( &r, &pose->orientation, in + i );
+		result[i].x = r.x + px;
+		result[i].y = r.y + py;
+		result[i].z = r.z + pz;
+	}
+}
+
+void tsoPoseTransformPoints(XrVector3f * result, const XrPosef * pose, const XrVector3f * points, int count)
+{
+	tsoPoseTransformArray( result, pose, points, count, 1 );
+}
+
+void tsoPoseTransformVectors(XrVector3f * result, const XrPosef * pose, const XrVector3f * vectors, int count)
+{
+	tsoPoseTransformArray( result, pose, vectors, count, 0 );
+}
+
+void tsoFrustumFromViews(tsoFrustum * frustum, const XrCompositionLayerProjectionView * views, int viewCount, float nearZ, float farZ)
+{
+	XrVector3f normals[TSO_MAX_VIEWS+1][6];
+	XrVector3f corners[TSO_MAX_VIEWS*8];
+	XrVector3f centroid = { 0, 0, 0 };
+	int infinite = farZ <= nearZ;
+	float cornerZ = infinite ? TSO_CULL_INFINITE_FAR : farZ;
+	int i, p, c;
+
+	if( viewCount > TSO_MAX_VIEWS ) viewCount = TSO_MAX_VIEWS;
+	int numCorners = viewCount * 8;
+
+	memset( normals[viewCount], 0, sizeof( normals[viewCount] ) );
+	for( i = 0; i < viewCount; i++ )
+	{
+		const XrFovf * fov = &views[i].fov;
+		const float tl = tanf( fov->angleLeft ), tr = tanf( fov->angleRight );
+		const float td = tanf( fov->angleDown ), tu = tanf( fov->angleUp );
+		XrVector3f local[6] = {
+			{ cosf( fov->angleLeft ), 0, sinf( fov->angleLeft ) },
+			{ -cosf( fov->angleRight ), 0, -sinf( fov->angleRight ) },
+			{ 0, cosf( fov->angleDown ), sinf( fov->angleDown ) },
+			{ 0, -cosf( fov->angleUp ), -sinf( fov->angleUp ) },
+			{ 0, 0, -1 },
+			{ 0, 0, 1 } };
+		for( p = 0; p < 6; p++ )
+		{
+			XrVector3f * n = &normals[i][p];
+			tsoQuatRotateVector( n, &views[i].pose.orientation, &local[p] );
+			normals[viewCount][p].x += n->x;
+			normals[viewCount][p].y += n->y;
+			normals[viewCount][p].z += n->z;
+		}
+
+		XrVector3f * vc = corners + i * 8;
+		for( c = 0; c < 8; c++ )
+		{
+			float z = ( c & 4 ) ? cornerZ : nearZ;
+			vc[c].x = ( ( c & 1 ) ? tr : tl ) * z;
+			vc[c].y = ( ( c & 2 ) ? tu : td ) * z;
+			vc[c].z = -z;
+		}
+		tsoPoseTransformPoints( vc, &views[i].pose, vc, 8 );
+	}
+
+	for( c = 0; c < numCorners; c++ )
+	{
+		centroid.x += corners[c].x / numCorners;
+		centroid.y += corners[c].y / numCorners;
+		centroid.z += corners[c].z / numCorners;
+	}
+
+	// Any normal works as long as the plane is then pushed out to contain every view's corners.
+	// Try each view's own plane and the average of them, and keep whichever hugs the corners
+	// tightest (smallest distance from their centroid).  For near-parallel eyes, that is the
+	// outer eye's plane on each side.
+	for( p = 0; p < 6; p++ )
+	{
+		float bestScore = 1e30f;
+		int candidate;
+		for( candidate = 0; candidate <= viewCount; candidate++ )
+		{
+			XrVector3f n = normals[candidate][p];
+			float len = sqrtf( n.x * n.x + n.y * n.y + n.z * n.z );
+			if( len <= 0 ) continue;
+			n.x /= len; n.y /= len; n.z /= len;
+
+			float d = -1e30f;
+			for( c = 0; c < numCorners; c++ )
+			{
+				float cd = -( n.x * corners[c].x + n.y * corners[c].y + n.z * corners[c].z );
+				if( cd > d ) d = cd;
+			}
+
+			float score = d + n.x * centroid.x + n.y * centroid.y + n.z * centroid.z;
+			if( score < bestScore )
+			{
+				bestScore = score;
+				frustum->planes[p][0] = n.x;
+				frustum->planes[p][1] = n.y;
+				frustum->planes[p][2] = n.z;
+				frustum->planes[p][3] = d;
+			}
+		}
+	}
+
+	if( infinite )
+	{
+		float * pl = frustum->planes[5];
+		pl[0] = pl[1] = pl[2] = 0;
+		pl[3] = 1;
+	}
+}
+
+int tsoCullSpheres(const tsoFrustum * frustum, const float * x, const float * y, const float * z, const float * radius, int count, uint32_t * visible)
+{
+	int i = 0, p;
+	int numVisible = 0;
+	memset( visible, 0, ( ( count + 31 ) / 32 ) * sizeof( uint32_t ) );
+
+#if TSO_SIMD_SSE2
+	for( ; i + 4 <= count; i += 4 )
+	{
+		__m128 vx = _mm_loadu_ps( x + i ), vy = _mm_loadu_ps( y + i ), vz = _mm_loadu_ps( z + i );
+		__m128 nr = _mm_sub_ps( _mm_setzero_ps(), _mm_loadu_ps( radius + i ) );
+		__m128 in = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			__m128 d = _mm_add_ps( _mm_add_ps( _mm_mul_ps( vx, _mm_set1_ps( pl[0] ) ), _mm_mul_ps( vy, _mm_set1_ps( pl[1] ) ) ),
+				_mm_add_ps( _mm_mul_ps( vz, _mm_set1_ps( pl[2] ) ), _mm_set1_ps( pl[3] ) ) );
+			in = _mm_and_ps( in, _mm_cmpge_ps( d, nr ) );
+		}
+		uint32_t bits = _mm_movemask_ps( in );
+		visible[i>>5] |= bits << ( i & 31 );
+		numVisible += ( bits & 1 ) + ( ( bits >> 1 ) & 1 ) + ( ( bits >> 2 ) & 1 ) + ( bits >> 3 );
+	}
+#elif TSO_SIMD_NEON
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float32x4_t vx = vld1q_f32( x + i ), vy = vld1q_f32( y + i ), vz = vld1q_f32( z + i );
+		float32x4_t nr = vnegq_f32( vld1q_f32( radius + i ) );
+		uint32x4_t in = vdupq_n_u32( 0xffffffff );
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			float32x4_t d = vaddq_f32( vaddq_f32( vmulq_n_f32( vx, pl[0] ), vmulq_n_f32( vy, pl[1] ) ),
+				vaddq_f32( vmulq_n_f32( vz, pl[2] ), vdupq_n_f32( pl[3] ) ) );
+			in = vandq_u32( in, vcgeq_f32( d, nr ) );
+		}
+		static const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+		uint32x4_t b = vandq_u32( in, vld1q_u32( laneBits ) );
+		uint32x2_t b2 = vpadd_u32( vget_low_u32( b ), vget_high_u32( b ) );
+		uint32_t bits = vget_lane_u32( vpadd_u32( b2, b2 ), 0 );
+		visible[i>>5] |= bits << ( i & 31 );
+		numVisible += ( bits & 1 ) + ( ( bits >> 1 ) & 1 ) + ( ( bits >> 2 ) & 1 ) + ( bits >> 3 );
+	}
+#endif
+
+	for( ; i < count; i++ )
+	{
+		int in = 1;
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			if( ( x[i] * pl[0] + y[i] * pl[1] ) + ( z[i] * pl[2] + pl[3] ) < -radius[i] ) { in = 0; break; }
+		}
+		if( in )
+		{
+			visible[i>>5] |= 1u << ( i & 31 );
+			numVisible++;
+		}
+	}
+	return numVisible;
+}
+
+int tsoCullAABBs(const tsoFrustum * frustum, const float * minX, const float * minY, const float * minZ,
+	const float * maxX, const float * maxY, const float * maxZ, int count, uint32_t * visible)
+{
+	int i = 0, p;
+	int numVisible = 0;
+	memset( visible, 0, ( ( count + 31 ) / 32 ) * sizeof( uint32_t ) );
+
+	// Center/extent form: a box is outside a plane when dot( n, center ) + d < -dot( |n|, extent ).
+#if TSO_SIMD_SSE2
+	const __m128 half = _mm_set1_ps( 0.5f );
+	for( ; i + 4 <= count; i += 4 )
+	{
+		__m128 x0 = _mm_loadu_ps( minX + i ), x1 = _mm_loadu_ps( maxX + i );
+		__m128 y0 = _mm_loadu_ps( minY + i ), y1 = _mm_loadu_ps( maxY + i );
+		__m128 z0 = _mm_loadu_ps( minZ + i ), z1 = _mm_loadu_ps( maxZ + i );
+		__m128 cx = _mm_mul_ps( _mm_add_ps( x0, x1 ), half ), ex = _mm_mul_ps( _mm_sub_ps( x1, x0 ), half );
+		__m128 cy = _mm_mul_ps( _mm_add_ps( y0, y1 ), half ), ey = _mm_mul_ps( _mm_sub_ps( y1, y0 ), half );
+		__m128 cz = _mm_mul_ps( _mm_add_ps( z0, z1 ), half ), ez = _mm_mul_ps( _mm_sub_ps( z1, z0 ), half );
+		__m128 in = _mm_castsi128_ps( _mm_set1_epi32( -1 ) );
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			__m128 d = _mm_add_ps( _mm_add_ps( _mm_mul_ps( cx, _mm_set1_ps( pl[0] ) ), _mm_mul_ps( cy, _mm_set1_ps( pl[1] ) ) ),
+				_mm_add_ps( _mm_mul_ps( cz, _mm_set1_ps( pl[2] ) ), _mm_set1_ps( pl[3] ) ) );
+			__m128 r = _mm_add_ps( _mm_add_ps( _mm_mul_ps( ex, _mm_set1_ps( fabsf( pl[0] ) ) ), _mm_mul_ps( ey, _mm_set1_ps( fabsf( pl[1] ) ) ) ),
+				_mm_mul_ps( ez, _mm_set1_ps( fabsf( pl[2] ) ) ) );
+			in = _mm_and_ps( in, _mm_cmpge_ps( _mm_add_ps( d, r ), _mm_setzero_ps() ) );
+		}
+		uint32_t bits = _mm_movemask_ps( in );
+		visible[i>>5] |= bits << ( i & 31 );
+		numVisible += ( bits & 1 ) + ( ( bits >> 1 ) & 1 ) + ( ( bits >> 2 ) & 1 ) + ( bits >> 3 );
+	}
+#elif TSO_SIMD_NEON
+	for( ; i + 4 <= count; i += 4 )
+	{
+		float32x4_t x0 = vld1q_f32( minX + i ), x1 = vld1q_f32( maxX + i );
+		float32x4_t y0 = vld1q_f32( minY + i ), y1 = vld1q_f32( maxY + i );
+		float32x4_t z0 = vld1q_f32( minZ + i ), z1 = vld1q_f32( maxZ + i );
+		float32x4_t cx = vmulq_n_f32( vaddq_f32( x0, x1 ), 0.5f ), ex = vmulq_n_f32( vsubq_f32( x1, x0 ), 0.5f );
+		float32x4_t cy = vmulq_n_f32( vaddq_f32( y0, y1 ), 0.5f ), ey = vmulq_n_f32( vsubq_f32( y1, y0 ), 0.5f );
+		float32x4_t cz = vmulq_n_f32( vaddq_f32( z0, z1 ), 0.5f ), ez = vmulq_n_f32( vsubq_f32( z1, z0 ), 0.5f );
+		uint32x4_t in = vdupq_n_u32( 0xffffffff );
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			float32x4_t d = vaddq_f32( vaddq_f32( vmulq_n_f32( cx, pl[0] ), vmulq_n_f32( cy, pl[1] ) ),
+				vaddq_f32( vmulq_n_f32( cz, pl[2] ), vdupq_n_f32( pl[3] ) ) );
+			float32x4_t r = vaddq_f32( vaddq_f32( vmulq_n_f32( ex, fabsf( pl[0] ) ), vmulq_n_f32( ey, fabsf( pl[1] ) ) ),
+				vmulq_n_f32( ez, fabsf( pl[2] ) ) );
+			in = vandq_u32( in, vcgeq_f32( vaddq_f32( d, r ), vdupq_n_f32( 0 ) ) );
+		}
+		static const uint32_t laneBits[4] = { 1, 2, 4, 8 };
+		uint32x4_t b = vandq_u32( in, vld1q_u32( laneBits ) );
+		uint32x2_t b2 = vpadd_u32( vget_low_u32( b ), vget_high_u32( b ) );
+		uint32_t bits = vget_lane_u32( vpadd_u32( b2, b2 ), 0 );
+		visible[i>>5] |= bits << ( i & 31 );
+		numVisible += ( bits & 1 ) + ( ( bits >> 1 ) & 1 ) + ( ( bits >> 2 ) & 1 ) + ( bits >> 3 );
+	}
+#endif
+
+	for( ; i < count; i++ )
+	{
+		float cx = ( minX[i] + maxX[i] ) * 0.5f, ex = ( maxX[i] - minX[i] ) * 0.5f;
+		float cy = ( minY[i] + maxY[i] ) * 0.5f, ey = ( maxY[i] - minY[i] ) * 0.5f;
+		float cz = ( minZ[i] + maxZ[i] ) * 0.5f, ez = ( maxZ[i] - minZ[i] ) * 0.5f;
+		int in = 1;
+		for( p = 0; p < 6; p++ )
+		{
+			const float * pl = frustum->planes[p];
+			float d = ( cx * pl[0] + cy * pl[1] ) + ( cz * pl[2] + pl[3] );
+			float r = ( ex * fabsf( pl[0] ) + ey * fabsf( pl[1] ) ) + ez * fabsf( pl[2] );
+			if( d + r < 0 ) { in = 0; break; }
+		}
+		if( in )
+		{
+			visible[i>>5] |= 1u << ( i & 31 );
+			numVisible++;
+		}
+	}
+	return numVisible;
+}
+
+void tsoComputeViewMatrices( tsoContext * ctx, const XrCompositionLayerProjectionView * projectionLayerViews, int viewCount )
+{
+	int i;
+	if( viewCount > TSO_MAX_VIEWS ) viewCount = TSO_MAX_VIEWS;
+	for( i = 0; i < viewCount; i++ )
+	{
+		const XrCompositionLayerProjectionView * layerView = projectionLayerViews + i;
+		tsoViewMatrices * m = ctx->tsoMatrices + i;
+		tsoProjectionCacheKey * key = ctx->tsoProjectionCache + i;
+
+		if( !key->valid || memcmp( &key->fov, &layerView->fov, sizeof( XrFovf ) ) ||
+			key->nearZ != ctx->tsoNearZ || key->farZ != ctx->tsoFarZ || key->reverseZ != ctx->tsoReverseZ )
+		{
+			if( ctx->tsoReverseZ )
+				tsoUtilInitReverseZProjectionMat( m->proj, &layerView->fov, GRAPHICS_OPENGL, ctx->tsoNearZ, ctx->tsoFarZ );
+			else
+				tsoUtilInitFovProjectionMat( m->proj, &layerView->fov, GRAPHICS_OPENGL, ctx->tsoNearZ, ctx->tsoFarZ );
+			key->fov = layerView->fov;
+			key->nearZ = ctx->tsoNearZ;
+			key->farZ = ctx->tsoFarZ;
+			key->reverseZ = ctx->tsoReverseZ;
+			key->valid = 1;
+		}
+
+		tsoUtilInitPoseMat( m->invView, &layerView->pose );
+		tsoInvertOrthogonalMat( m->view, m->invView );
+		tsoMultiplyMat( m->viewProj, m->proj, m->view );
+	}
+}
+
+#if TSOPENXR_ENABLE_SOFTRASTER
+
+#define TSO_SR_PIXEL     0
+#define TSO_SR_SEGMENT   1
+#define TSO_SR_RECTANGLE 2
+#define TSO_SR_TRIANGLE  3
+
+static void tsoSoftRasterRunTiles( tsoSoftRaster * sr );
+
+static void * tsoSoftRasterWorker( void * v )
+{
+	tsoSoftRaster * sr = (tsoSoftRaster*)v;
+	while( 1 )
+	{
+		OGLockSema( sr->workSema );
+		if( sr->quitting ) break;
+		tsoSoftRasterRunTiles( sr );
+		OGUnlockSema( sr->doneSema );
+	}
+	return 0;
+}
+
+int tsoSoftRasterCreate( tsoSoftRaster * sr, int numThreads )
+{
+	int i;
+	memset( sr, 0, sizeof( *sr ) );
+	if( numThreads > TSO_SOFTRASTER_MAX_THREADS ) numThreads = TSO_SOFTRASTER_MAX_THREADS;
+	if( numThreads < 0 ) numThreads = 0;
+	sr->curView = -1;
+	sr->curColor = 0xffffffff;
+	sr->workSema = OGCreateSema();
+	sr->doneSema = OGCreateSema();
+	sr->tileMutex = OGCreateMutex();
+	for( i = 0; i < numThreads; i++ )
+	{
+		sr->threads[i] = OGCreateThread( tsoSoftRasterWorker, sr );
+		if( !sr->threads[i] )
+		{
+			TSOPENXR_ERROR( "tsoSoftRasterCreate: could not create thread %d\n", i );
+			break;
+		}
+	}
+	sr->numThreads = i;
+	return 0;
+}
+
+void tsoSoftRasterDestroy( tsoSoftRaster * sr )
+{
+	int i;
+	sr->quitting = 1;
+	for( i = 0; i < sr->numThreads; i++ )
+		OGUnlockSema( sr->workSema );
+	for( i = 0; i < sr->numThreads; i++ )
+		OGJoinThread( sr->threads[i] );
+	OGDeleteSema( sr->workSema );
+	OGDeleteSema( sr->doneSema );
+	OGDeleteMutex( sr->tileMutex );
+
+	for( i = 0; i < sr->numViews; i++ )
+		free( sr->buffers[i] );
+	for( i = 0; i < sr->numTiles; i++ )
+		free( sr->tiles[i].cmds );
+	free( sr->buffers );
+	free( sr->tiles );
+	free( sr->cmds );
+	memset( sr, 0, sizeof( *sr ) );
+}
+
+int tsoSoftRasterBegin( tsoSoftRaster * sr, int numViews, int width, int height )
+{
+	int i;
+	if( numViews <= 0 || width <= 0 || height <= 0 ) return -1;
+
+	if( numViews != sr->numViews || width != sr->width || height != sr->height )
+	{
+		for( i = 0; i < sr->numViews; i++ )
+			free( sr->buffers[i] );
+		for( i = 0; i < sr->numTiles; i++ )
+			free( sr->tiles[i].cmds );
+
+		sr->numViews = numViews;
+		sr->width = width;
+		sr->height = height;
+		sr->buffers = realloc( sr->buffers, numViews * sizeof( uint32_t * ) );
+		for( i = 0; i < numViews; i++ )
+			sr->buffers[i] = calloc( width * height, sizeof( uint32_t ) );
+
+		sr->tilesX = ( width + TSO_SOFTRASTER_TILE - 1 ) / TSO_SOFTRASTER_TILE;
+		sr->tilesY = ( height + TSO_SOFTRASTER_TILE - 1 ) / TSO_SOFTRASTER_TILE;
+		sr->numTiles = sr->tilesX * sr->tilesY * numViews;
+		sr->tiles = realloc( sr->tiles, sr->numTiles * sizeof( tsoSoftRasterTile ) );
+		memset( sr->tiles, 0, sr->numTiles * sizeof( tsoSoftRasterTile ) );
+	}
+
+	sr->numCmds = 0;
+	sr->curView = -1;
+	return 0;
+}
+
+void tsoSoftRasterSetView( tsoSoftRaster * sr, int view )
+{
+	sr->curView = view;
+}
+
+uint32_t tsoSoftRasterColor( tsoSoftRaster * sr, uint32_t RGBA )
+{
+	// 0xRRGGBBAA -> R,G,B,A bytes in memory, which is what GL_RGBA + GL_UNSIGNED_BYTE wants.
+	sr->curColor = ( ( RGBA >> 24 ) & 0xff ) | ( ( RGBA >> 8 ) & 0xff00 ) | ( ( RGBA << 8 ) & 0xff0000 ) | ( ( RGBA & 0xff ) << 24 );
+	return sr->curColor;
+}
+
+static tsoSoftRasterCmd * tsoSoftRasterNewCmd( tsoSoftRaster * sr, int type )
+{
+	if( sr->numCmds == sr->maxCmds )
+	{
+		sr->maxCmds = sr->maxCmds ? sr->maxCmds * 2 : 1024;
+		sr->cmds = realloc( sr->cmds, sr->maxCmds * sizeof( tsoSoftRasterCmd ) );
+	}
+	tsoSoftRasterCmd * c = sr->cmds + sr->numCmds++;
+	c->type = type;
+	c->view = sr->curView;
+	c->color = sr->curColor;
+	return c;
+}
+
+void tsoSoftRasterPixel( tsoSoftRaster * sr, short x, short y )
+{
+	tsoSoftRasterCmd * c = tsoSoftRasterNewCmd( sr, TSO_SR_PIXEL );
+	c->x0 = c->minx = c->maxx = x;
+	c->y0 = c->miny = c->maxy = y;
+}
+
+void tsoSoftRasterSegment( tsoSoftRaster * sr, short x1, short y1, short x2, short y2 )
+{
+	tsoSoftRasterCmd * c = tsoSoftRasterNewCmd( sr, TSO_SR_SEGMENT );
+	c->x0 = x1; c->y0 = y1;
+	c->x1 = x2; c->y1 = y2;
+	c->minx = (x1<x2)?x1:x2;
+	c->maxx = (x1<x2)?x2:x1;
+	c->miny = (y1<y2)?y1:y2;
+	c->maxy = (y1<y2)?y2:y1;
+}
+
+void tsoSoftRasterRectangle( tsoSoftRaster * sr, short x1, short y1, short x2, short y2 )
+{
+	tsoSoftRasterCmd * c = tsoSoftRasterNewCmd( sr, TSO_SR_RECTANGLE );
+	c->minx = (x1<x2)?x1:x2;
+	c->maxx = (x1<x2)?x2:x1;
+	c->miny = (y1<y2)?y1:y2;
+	c->maxy = (y1<y2)?y2:y1;
+}
+
+void tsoSoftRasterClear( tsoSoftRaster * sr, uint32_t RGBA )
+{
+	uint32_t lastColor = sr->curColor;
+	tsoSoftRasterColor( sr, RGBA );
+	tsoSoftRasterRectangle( sr, 0, 0, sr->width - 1, sr->height - 1 );
+	sr->curColor = lastColor;
+}
+
+void tsoSoftRasterTriangle( tsoSoftRaster * sr, short x0, short y0, short x1, short y1, short x2, short y2 )
+{
+	tsoSoftRasterCmd * c = tsoSoftRasterNewCmd( sr, TSO_SR_TRIANGLE );
+	c->x0 = x0; c->y0 = y0;
+	c->x1 = x1; c->y1 = y1;
+	c->x2 = x2; c->y2 = y2;
+	c->minx = x0; if( x1 < c->minx ) c->minx = x1; if( x2 < c->minx ) c->minx = x2;
+	c->maxx = x0; if( x1 > c->maxx ) c->maxx = x1; if( x2 > c->maxx ) c->maxx = x2;
+	c->miny = y0; if( y1 < c->miny ) c->miny = y1; if( y2 < c->miny ) c->miny = y2;
+	c->maxy = y0; if( y1 > c->maxy ) c->maxy = y1; if( y2 > c->maxy ) c->maxy = y2;
+}
+
+static inline int64_t tsoSoftRasterEdge( int ax, int ay, int bx, int by, int px, int py )
+{
+	return (int64_t)(bx-ax)*(py-ay) - (int64_t)(by-ay)*(px-ax);
+}
+
+static void tsoSoftRasterDoTile( tsoSoftRaster * sr, int tileNo )
+{
+	const int tilesPerView = sr->tilesX * sr->tilesY;
+	const int view = tileNo / tilesPerView;
+	const int t = tileNo % tilesPerView;
+	const int w = sr->width;
+	const int h = sr->height;
+	const int cx0 = ( t % sr->tilesX ) * TSO_SOFTRASTER_TILE;
+	const int cy0 = ( t / sr->tilesX ) * TSO_SOFTRASTER_TILE;
+	const int cx1 = ( cx0 + TSO_SOFTRASTER_TILE > w ) ? w - 1 : cx0 + TSO_SOFTRASTER_TILE - 1;
+	const int cy1 = ( cy0 + TSO_SOFTRASTER_TILE > h ) ? h - 1 : cy0 + TSO_SOFTRASTER_TILE - 1;
+	tsoSoftRasterTile * tile = sr->tiles + tileNo;
+
+	// Rows are stored bottom-up so the buffer can go straight into a GL texture.
+	uint32_t * rows = sr->buffers[view] + ( h - 1 ) * w;
+	#define TSO_SR_ROW( y ) ( rows - (y) * w )
+
+	int i, x, y;
+	for( i = 0; i < tile->numCmds; i++ )
+	{
+		const tsoSoftRasterCmd * c = sr->cmds + tile->cmds[i];
+		const uint32_t color = c->color;
+		int minx = ( c->minx < cx0 ) ? cx0 : c->minx;
+		int maxx = ( c->maxx > cx1 ) ? cx1 : c->maxx;
+		int miny = ( c->miny < cy0 ) ? cy0 : c->miny;
+		int maxy = ( c->maxy > cy1 ) ? cy1 : c->maxy;
+		if( minx > maxx || miny > maxy ) continue;
+
+		switch( c->type )
+		{
+		case TSO_SR_PIXEL:
+		case TSO_SR_RECTANGLE:
+			for( y = miny; y <= maxy; y++ )
+			{
+				uint32_t * row = TSO_SR_ROW( y );
+				for( x = minx; x <= maxx; x++ )
+					row[x] = color;
+			}
+			break;
+		case TSO_SR_SEGMENT:
+		{
+			// Same stepping as rawdraw's rasterizer, but only walk the part of the major axis inside this tile.
+			int dx = c->x1 - c->x0;
+			int dy = c->y1 - c->y0;
+			if( ( dx < 0 ? -dx : dx ) > ( dy < 0 ? -dy : dy ) )
+			{
+				int sx = ( c->x0 < c->x1 ) ? c->x0 : c->x1;
+				int sy = ( c->x0 < c->x1 ) ? c->y0 : c->y1;
+				float slope = (float)( ( c->x0 < c->x1 ) ? dy : -dy ) / (float)( dx < 0 ? -dx : dx );
+				for( x = minx; x <= maxx; x++ )
+				{
+					y = (int)( sy + slope * ( x - sx ) );
+					if( y < cy0 || y > cy1 ) continue;
+					TSO_SR_ROW( y )[x] = color;
+				}
+			}
+			else if( dy )
+			{
+				int sx = ( c->y0 < c->y1 ) ? c->x0 : c->x1;
+				int sy = ( c->y0 < c->y1 ) ? c->y0 : c->y1;
+				float slope = (float)( ( c->y0 < c->y1 ) ? dx : -dx ) / (float)( dy < 0 ? -dy : dy );
+				for( y = miny; y <= maxy; y++ )
+				{
+					x = (int)( sx + slope * ( y - sy ) );
+					if( x < cx0 || x > cx1 ) continue;
+					TSO_SR_ROW( y )[x] = color;
+				}
+			}
+			else
+			{
+				TSO_SR_ROW( c->y0 )[c->x0] = color;
+			}
+			break;
+		}
+		case TSO_SR_TRIANGLE:
+		{
+			int ax = c->x0, ay = c->y0;
+			int bx = c->x1, by = c->y1;
+			int qx = c->x2, qy = c->y2;
+			int64_t area = tsoSoftRasterEdge( ax, ay, bx, by, qx, qy );
+			if( area == 0 ) break;
+			if( area < 0 )
+			{
+				int tx = bx, ty = by;
+				bx = qx; by = qy;
+				qx = tx; qy = ty;
+			}
+
+			// Edge functions, stepped incrementally across the clipped bounding box.
+			int64_t w0row = tsoSoftRasterEdge( bx, by, qx, qy, minx, miny );
+			int64_t w1row = tsoSoftRasterEdge( qx, qy, ax, ay, minx, miny );
+			int64_t w2row = tsoSoftRasterEdge( ax, ay, bx, by, minx, miny );
+			const int64_t a0 = by - qy, b0 = qx - bx;
+			const int64_t a1 = qy - ay, b1 = ax - qx;
+			const int64_t a2 = ay - by, b2 = bx - ax;
+			for( y = miny; y <= maxy; y++ )
+			{
+				uint32_t * row = TSO_SR_ROW( y );
+				int64_t w0 = w0row, w1 = w1row, w2 = w2row;
+				for( x = minx; x <= maxx; x++ )
+				{
+					if( ( w0 | w1 | w2 ) >= 0 ) row[x] = color;
+					w0 += a0; w1 += a1; w2 += a2;
+				}
+				w0row += b0; w1row += b1; w2row += b2;
+			}
+			break;
+		}
+		}
+	}
+	#undef TSO_SR_ROW
+}
+
+static void tsoSoftRasterRunTiles( tsoSoftRaster * sr )
+{
+	while( 1 )
+	{
+		OGLockMutex( sr->tileMutex );
+		int t = sr->nextTile++;
+		OGUnlockMutex( sr->tileMutex );
+		if( t >= sr->numTiles ) break;
+		if( sr->tiles[t].numCmds ) tsoSoftRasterDoTile( sr, t );
+	}
+}
+
+int tsoSoftRasterFinish( tsoSoftRaster * sr )
+{
+	int i, v, tx, ty;
+	const int tilesPerView = sr->tilesX * sr->tilesY;
+
+	for( i = 0; i < sr->numTiles; i++ )
+		sr->tiles[i].numCmds = 0;
+
+	// Bin by bounding box, keeping submission order within each tile.
+	for( i = 0; i < sr->numCmds; i++ )
+	{
+		const tsoSoftRasterCmd * c = sr->cmds + i;
+		if( c->maxx < 0 || c->maxy < 0 || c->minx >= sr->width || c->miny >= sr->height ) continue;
+		int tx0 = ( c->minx < 0 ) ? 0 : c->minx / TSO_SOFTRASTER_TILE;
+		int ty0 = ( c->miny < 0 ) ? 0 : c->miny / TSO_SOFTRASTER_TILE;
+		int tx1 = ( c->maxx >= sr->width ) ? sr->tilesX - 1 : c->maxx / TSO_SOFTRASTER_TILE;
+		int ty1 = ( c->maxy >= sr->height ) ? sr->tilesY - 1 : c->maxy / TSO_SOFTRASTER_TILE;
+		int v0 = ( c->view < 0 ) ? 0 : c->view;
+		int v1 = ( c->view < 0 ) ? sr->numViews - 1 : c->view;
+		if( v1 >= sr->numViews ) continue;
+		for( v = v0; v <= v1; v++ )
+		for( ty = ty0; ty <= ty1; ty++ )
+		for( tx = tx0; tx <= tx1; tx++ )
+		{
+			tsoSoftRasterTile * tile = sr->tiles + v * tilesPerView + ty * sr->tilesX + tx;
+			if( tile->numCmds == tile->maxCmds )
+			{
+				tile->maxCmds = tile->maxCmds ? tile->maxCmds * 2 : 64;
+				tile->cmds = realloc( tile->cmds, tile->maxCmds * sizeof( int ) );
+			}
+			tile->cmds[tile->numCmds++] = i;
+		}
+	}
+
+	sr->nextTile = 0;
+	for( i = 0; i < sr->numThreads; i++ )
+		OGUnlockSema( sr->workSema );
+	tsoSoftRasterRunTiles( sr );
+	for( i = 0; i < sr->numThreads; i++ )
+		OGLockSema( sr->doneSema );
+
+	sr->numCmds = 0;
+	return 0;
+}
+
+int tsoSoftRasterSubmit( tsoContext * ctx, tsoSoftRaster * sr, XrCompositionLayerProjectionView * projectionLayerViews, int viewCountOutput )
+{
+	int numViews = ( viewCountOutput < sr->numViews ) ? viewCountOutput : sr->numViews;
+	int v, r;
+
+	for( v = 0; v < numViews; v++ )
+	{
+		XrCompositionLayerProjectionView * layerView = projectionLayerViews + v;
+		int swapchain = tsoSwapchainForView( ctx, v );
+
+		if( v == 0 || swapchain != tsoSwapchainForView( ctx, v - 1 ) )
+		{
+			uint32_t swapchainImageIndex;
+			if( ( r = tsoAcquireSwapchain( ctx, swapchain, &swapchainImageIndex ) ) ) return r;
+
+			#ifdef XR_USE_PLATFORM_XLIB
+			glXMakeCurrent( CNFGDisplay, CNFGWindow, CNFGCtx );
+			#endif
+
+			glBindTexture( GL_TEXTURE_2D, ctx->tsoSwapchainImages[swapchain][swapchainImageIndex].image );
+		}
+
+		int w = layerView->subImage.imageRect.extent.width;
+		int h = layerView->subImage.imageRect.extent.height;
+		if( w > sr->width ) w = sr->width;
+		if( h > sr->height ) h = sr->height;
+
+		// Buffer is stored bottom-up, so the last h rows line up with the bottom of the subImage.
+		uint32_t * src = sr->buffers[v] + ( sr->height - h ) * sr->width;
+		if( w == sr->width )
+		{
+			glTexSubImage2D( GL_TEXTURE_2D, 0,
+				layerView->subImage.imageRect.offset.x, layerView->subImage.imageRect.offset.y,
+				w, h, GL_RGBA, GL_UNSIGNED_BYTE, src );
+		}
+		else
+		{
+			int y;
+			for( y = 0; y < h; y++ )
+			{
+				glTexSubImage2D( GL_TEXTURE_2D, 0,
+					layerView->subImage.imageRect.offset.x, layerView->subImage.imageRect.offset.y + y,
+					w, 1, GL_RGBA, GL_UNSIGNED_BYTE, src + y * sr->width );
+			}
+		}
+
+		if( v == numViews - 1 || swapchain != tsoSwapchainForView( ctx, v + 1 ) )
+		{
+			glBindTexture( GL_TEXTURE_2D, 0 );
+			if( ( r = tsoReleaseSwapchain( ctx, swapchain ) ) ) return r;
+		}
+	}
+	return 0;
+}
+
+#endif
+
 #endif // TSOPENXR_IMPLEMENTATION
 
 #endif // _TSOPENXR_H